@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "orteaf/internal/base/math_utils.h"
+
+namespace orteaf::internal::base {
+
+/**
+ * @brief Fixed-capacity lock-free multi-producer / single-consumer queue.
+ *
+ * Each cell carries a sequence number (Vyukov's bounded queue), so producers
+ * only contend on one CAS of the enqueue position and never block each other
+ * or the consumer. tryPush fails instead of waiting when the queue is full;
+ * callers are expected to fall back to a slower path.
+ *
+ * Any number of threads may call tryPush concurrently. tryPop and the
+ * size estimate must only be used by a single consumer thread at a time.
+ * The capacity is rounded up to a power of two.
+ */
+template <typename T>
+class BoundedMpscQueue {
+public:
+    explicit BoundedMpscQueue(std::size_t capacity)
+        : capacity_(nextPowerOfTwo(capacity < 2 ? 2 : capacity)),
+          mask_(capacity_ - 1),
+          cells_(std::make_unique<Cell[]>(capacity_)) {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+    BoundedMpscQueue(BoundedMpscQueue&&) = delete;
+    BoundedMpscQueue& operator=(BoundedMpscQueue&&) = delete;
+    ~BoundedMpscQueue() = default;
+
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief Enqueues value; returns false (leaving value untouched) if full.
+     */
+    bool tryPush(T& value) {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                              static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                                       std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(T&& value) { return tryPush(value); }
+
+    /**
+     * @brief Dequeues the oldest published element (consumer thread only).
+     */
+    bool tryPop(T& out) {
+        Cell& cell = cells_[dequeue_pos_ & mask_];
+        const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != dequeue_pos_ + 1) {
+            return false;
+        }
+        out = std::move(cell.value);
+        cell.value = T{};
+        cell.sequence.store(dequeue_pos_ + capacity_, std::memory_order_release);
+        ++dequeue_pos_;
+        return true;
+    }
+
+    /**
+     * @brief Number of claimed slots not yet popped (consumer thread only).
+     *
+     * Includes pushes that are still being written, so it may briefly exceed
+     * what tryPop can return.
+     */
+    std::size_t sizeApprox() const noexcept {
+        return enqueue_pos_.load(std::memory_order_acquire) - dequeue_pos_;
+    }
+
+    bool emptyApprox() const noexcept { return sizeApprox() == 0; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence{0};
+        T value{};
+    };
+
+    std::size_t capacity_;
+    std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+    alignas(64) std::atomic<std::size_t> enqueue_pos_{0};
+    alignas(64) std::size_t dequeue_pos_{0};
+};
+
+}  // namespace orteaf::internal::base
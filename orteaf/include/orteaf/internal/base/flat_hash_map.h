@@ -0,0 +1,299 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "orteaf/internal/base/flat_hash_table.h"
+
+namespace orteaf::internal::base {
+
+namespace detail {
+
+template <typename Key, typename T> struct FlatMapPolicy {
+  using key_type = Key;
+  using slot_type = std::pair<const Key, T>;
+
+  static const Key &key(const slot_type &slot) noexcept { return slot.first; }
+};
+
+} // namespace detail
+
+/**
+ * @brief Open-addressing hash map with elements stored inline in one array.
+ *
+ * Intended for lookup-heavy runtime caches (graph, library and pipeline keys
+ * to pool indices). Compared with std::unordered_map there is no node per
+ * element and a lookup usually touches one control group plus one slot.
+ *
+ * Differences from std::unordered_map:
+ * - Inserting may rehash and move elements, which invalidates iterators,
+ *   pointers and references. Keep pool handles (see Handle / FlatHash) when a
+ *   stable reference is needed.
+ * - Erasing invalidates only the erased element.
+ * - emplace(key, args...) has try-emplace semantics: nothing is constructed
+ *   when the key is already present.
+ *
+ * When both Hash and KeyEqual define is_transparent (the default for
+ * std::string keys), find/contains/count/at/erase/tryEmplace accept any type
+ * comparable with Key, e.g. std::string_view for std::string.
+ */
+template <typename Key, typename T, typename Hash = FlatHash<Key>,
+          typename KeyEqual = std::equal_to<>>
+class FlatHashMap {
+  using Table = detail::RawFlatHashTable<detail::FlatMapPolicy<Key, T>, Hash,
+                                         KeyEqual>;
+
+public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const Key, T>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = detail::FlatHashIterator<value_type>;
+  using const_iterator = detail::FlatHashIterator<const value_type>;
+
+private:
+  // Lookup overloads taking K are only enabled for transparent tables; the
+  // const Key & overloads keep implicit conversions working otherwise.
+  template <typename K>
+  static constexpr bool kHeterogeneous =
+      Table::kTransparent && !std::is_same_v<std::remove_cvref_t<K>, Key> &&
+      !std::is_convertible_v<K, const_iterator> &&
+      !std::is_convertible_v<K, iterator>;
+
+public:
+  FlatHashMap() = default;
+
+  /// @brief Constructs an empty map able to hold @p count elements without
+  /// rehashing.
+  explicit FlatHashMap(size_type count, const Hash &hash = Hash(),
+                       const KeyEqual &eq = KeyEqual())
+      : table_(hash, eq) {
+    table_.reserve(count);
+  }
+
+  FlatHashMap(std::initializer_list<value_type> init) {
+    table_.reserve(init.size());
+    for (const auto &value : init) {
+      insert(value);
+    }
+  }
+
+  iterator begin() noexcept {
+    return table_.template beginIterator<value_type>();
+  }
+  const_iterator begin() const noexcept {
+    return table_.template beginIterator<const value_type>();
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  iterator end() noexcept {
+    return table_.template iteratorAt<value_type>(Table::npos);
+  }
+  const_iterator end() const noexcept {
+    return table_.template iteratorAt<const value_type>(Table::npos);
+  }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  /// @brief Number of slots (occupancy never exceeds 7/8 of it).
+  size_type capacity() const noexcept { return table_.capacity(); }
+
+  void clear() noexcept { table_.clear(); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return tryEmplace(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return tryEmplace(value.first, std::move(value.second));
+  }
+
+  /**
+   * @brief Inserts {key, T(args...)} unless @p key is already present.
+   */
+  template <typename K, typename... Args>
+    requires std::constructible_from<Key, K &&>
+  std::pair<iterator, bool> emplace(K &&key, Args &&...args) {
+    if constexpr (std::is_same_v<std::remove_cvref_t<K>, Key>) {
+      return tryEmplace(std::forward<K>(key), std::forward<Args>(args)...);
+    } else {
+      return tryEmplace(Key(std::forward<K>(key)),
+                        std::forward<Args>(args)...);
+    }
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> tryEmplace(const Key &key, Args &&...args) {
+    return tryEmplaceImpl(key, key, std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> tryEmplace(Key &&key, Args &&...args) {
+    return tryEmplaceImpl(key, std::move(key), std::forward<Args>(args)...);
+  }
+
+  /// @brief Heterogeneous overload; Key is only built when inserting.
+  template <typename K, typename... Args>
+    requires(kHeterogeneous<K> && std::constructible_from<Key, K &&>)
+  std::pair<iterator, bool> tryEmplace(K &&key, Args &&...args) {
+    return tryEmplaceImpl(key, std::forward<K>(key),
+                          std::forward<Args>(args)...);
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insertOrAssign(const Key &key, M &&value) {
+    auto result = tryEmplace(key, std::forward<M>(value));
+    if (!result.second) {
+      result.first->second = std::forward<M>(value);
+    }
+    return result;
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insertOrAssign(Key &&key, M &&value) {
+    auto result = tryEmplace(std::move(key), std::forward<M>(value));
+    if (!result.second) {
+      result.first->second = std::forward<M>(value);
+    }
+    return result;
+  }
+
+  T &operator[](const Key &key) { return tryEmplace(key).first->second; }
+  T &operator[](Key &&key) { return tryEmplace(std::move(key)).first->second; }
+
+  T &at(const Key &key) { return atImpl(*this, key); }
+  const T &at(const Key &key) const { return atImpl(*this, key); }
+  template <typename K>
+    requires kHeterogeneous<K>
+  T &at(const K &key) {
+    return atImpl(*this, key);
+  }
+  template <typename K>
+    requires kHeterogeneous<K>
+  const T &at(const K &key) const {
+    return atImpl(*this, key);
+  }
+
+  iterator find(const Key &key) {
+    return table_.template iteratorAt<value_type>(table_.find(key));
+  }
+  const_iterator find(const Key &key) const {
+    return table_.template iteratorAt<const value_type>(table_.find(key));
+  }
+  template <typename K>
+    requires kHeterogeneous<K>
+  iterator find(const K &key) {
+    return table_.template iteratorAt<value_type>(table_.find(key));
+  }
+  template <typename K>
+    requires kHeterogeneous<K>
+  const_iterator find(const K &key) const {
+    return table_.template iteratorAt<const value_type>(table_.find(key));
+  }
+
+  bool contains(const Key &key) const {
+    return table_.find(key) != Table::npos;
+  }
+  template <typename K>
+    requires kHeterogeneous<K>
+  bool contains(const K &key) const {
+    return table_.find(key) != Table::npos;
+  }
+
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  template <typename K>
+    requires kHeterogeneous<K>
+  size_type count(const K &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  /// @brief Erases the element at @p pos and returns the following one.
+  iterator erase(const_iterator pos) noexcept {
+    const std::size_t index = table_.indexOf(pos);
+    table_.eraseAt(index);
+    auto next = table_.template iteratorAt<value_type>(index);
+    ++next;
+    return next;
+  }
+
+  iterator erase(iterator pos) noexcept { return erase(const_iterator(pos)); }
+
+  size_type erase(const Key &key) { return eraseImpl(key); }
+  template <typename K>
+    requires kHeterogeneous<K>
+  size_type erase(const K &key) {
+    return eraseImpl(key);
+  }
+
+  void swap(FlatHashMap &other) noexcept { table_.swap(other.table_); }
+
+  hasher hash_function() const { return table_.hashFunction(); }
+  key_equal key_eq() const { return table_.keyEqual(); }
+
+  friend bool operator==(const FlatHashMap &lhs, const FlatHashMap &rhs) {
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (const auto &[key, value] : lhs) {
+      auto it = rhs.find(key);
+      if (it == rhs.end() || !(it->second == value)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  template <typename Self, typename K>
+  static decltype(auto) atImpl(Self &self, const K &key) {
+    const std::size_t index = self.table_.find(key);
+    if (index == Table::npos) {
+      throw std::out_of_range("FlatHashMap::at key not found");
+    }
+    return (self.table_.slotAt(index).second);
+  }
+
+  template <typename K> size_type eraseImpl(const K &key) {
+    const std::size_t index = table_.find(key);
+    if (index == Table::npos) {
+      return 0;
+    }
+    table_.eraseAt(index);
+    return 1;
+  }
+
+  template <typename K, typename KeyArg, typename... Args>
+  std::pair<iterator, bool> tryEmplaceImpl(const K &lookup, KeyArg &&key,
+                                           Args &&...args) {
+    auto [index, inserted] =
+        table_.findOrInsert(lookup, [&](value_type *slot) {
+          std::construct_at(slot, std::piecewise_construct,
+                            std::forward_as_tuple(std::forward<KeyArg>(key)),
+                            std::forward_as_tuple(std::forward<Args>(args)...));
+        });
+    return {table_.template iteratorAt<value_type>(index), inserted};
+  }
+
+  Table table_{};
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void swap(FlatHashMap<Key, T, Hash, KeyEqual> &lhs,
+          FlatHashMap<Key, T, Hash, KeyEqual> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+} // namespace orteaf::internal::base
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "orteaf/internal/base/flat_hash_table.h"
+
+namespace orteaf::internal::base {
+
+namespace detail {
+
+template <typename Key> struct FlatSetPolicy {
+  using key_type = Key;
+  using slot_type = Key;
+
+  static const Key &key(const slot_type &slot) noexcept { return slot; }
+};
+
+} // namespace detail
+
+/**
+ * @brief Open-addressing hash set; the key-only counterpart of FlatHashMap.
+ *
+ * Same storage, probing and invalidation rules as FlatHashMap: inserting may
+ * move elements, erasing invalidates only the erased element. Lookup and
+ * erase accept any comparable type when Hash and KeyEqual are transparent.
+ */
+template <typename Key, typename Hash = FlatHash<Key>,
+          typename KeyEqual = std::equal_to<>>
+class FlatHashSet {
+  using Table =
+      detail::RawFlatHashTable<detail::FlatSetPolicy<Key>, Hash, KeyEqual>;
+
+public:
+  using key_type = Key;
+  using value_type = Key;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using reference = const value_type &;
+  using const_reference = const value_type &;
+  using iterator = detail::FlatHashIterator<const value_type>;
+  using const_iterator = iterator;
+
+private:
+  template <typename K>
+  static constexpr bool kHeterogeneous =
+      Table::kTransparent && !std::is_same_v<std::remove_cvref_t<K>, Key> &&
+      !std::is_convertible_v<K, const_iterator>;
+
+public:
+  FlatHashSet() = default;
+
+  /// @brief Constructs an empty set able to hold @p count elements without
+  /// rehashing.
+  explicit FlatHashSet(size_type count, const Hash &hash = Hash(),
+                       const KeyEqual &eq = KeyEqual())
+      : table_(hash, eq) {
+    table_.reserve(count);
+  }
+
+  FlatHashSet(std::initializer_list<value_type> init) {
+    table_.reserve(init.size());
+    for (const auto &value : init) {
+      insert(value);
+    }
+  }
+
+  iterator begin() const noexcept {
+    return table_.template beginIterator<const value_type>();
+  }
+  iterator cbegin() const noexcept { return begin(); }
+  iterator end() const noexcept {
+    return table_.template iteratorAt<const value_type>(Table::npos);
+  }
+  iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return table_.empty(); }
+  size_type size() const noexcept { return table_.size(); }
+  /// @brief Number of slots (occupancy never exceeds 7/8 of it).
+  size_type capacity() const noexcept { return table_.capacity(); }
+
+  void clear() noexcept { table_.clear(); }
+  void reserve(size_type count) { table_.reserve(count); }
+
+  std::pair<iterator, bool> insert(const Key &key) {
+    return insertImpl(key, key);
+  }
+
+  std::pair<iterator, bool> insert(Key &&key) {
+    return insertImpl(key, std::move(key));
+  }
+
+  /// @brief Heterogeneous overload; Key is only built when inserting.
+  template <typename K>
+    requires(kHeterogeneous<K> && std::is_constructible_v<Key, K &&>)
+  std::pair<iterator, bool> insert(K &&key) {
+    return insertImpl(key, std::forward<K>(key));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    return insert(Key(std::forward<Args>(args)...));
+  }
+
+  iterator find(const Key &key) const {
+    return table_.template iteratorAt<const value_type>(table_.find(key));
+  }
+  template <typename K>
+    requires kHeterogeneous<K>
+  iterator find(const K &key) const {
+    return table_.template iteratorAt<const value_type>(table_.find(key));
+  }
+
+  bool contains(const Key &key) const {
+    return table_.find(key) != Table::npos;
+  }
+  template <typename K>
+    requires kHeterogeneous<K>
+  bool contains(const K &key) const {
+    return table_.find(key) != Table::npos;
+  }
+
+  size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+  template <typename K>
+    requires kHeterogeneous<K>
+  size_type count(const K &key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  /// @brief Erases the element at @p pos and returns the following one.
+  iterator erase(const_iterator pos) noexcept {
+    const std::size_t index = table_.indexOf(pos);
+    table_.eraseAt(index);
+    auto next = table_.template iteratorAt<const value_type>(index);
+    ++next;
+    return next;
+  }
+
+  size_type erase(const Key &key) { return eraseImpl(key); }
+  template <typename K>
+    requires kHeterogeneous<K>
+  size_type erase(const K &key) {
+    return eraseImpl(key);
+  }
+
+  void swap(FlatHashSet &other) noexcept { table_.swap(other.table_); }
+
+  hasher hash_function() const { return table_.hashFunction(); }
+  key_equal key_eq() const { return table_.keyEqual(); }
+
+  friend bool operator==(const FlatHashSet &lhs, const FlatHashSet &rhs) {
+    if (lhs.size() != rhs.size()) {
+      return false;
+    }
+    for (const auto &key : lhs) {
+      if (!rhs.contains(key)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  template <typename K, typename KeyArg>
+  std::pair<iterator, bool> insertImpl(const K &lookup, KeyArg &&key) {
+    auto [index, inserted] = table_.findOrInsert(lookup, [&](Key *slot) {
+      std::construct_at(slot, std::forward<KeyArg>(key));
+    });
+    return {table_.template iteratorAt<const value_type>(index), inserted};
+  }
+
+  template <typename K> size_type eraseImpl(const K &key) {
+    const std::size_t index = table_.find(key);
+    if (index == Table::npos) {
+      return 0;
+    }
+    table_.eraseAt(index);
+    return 1;
+  }
+
+  Table table_{};
+};
+
+template <typename Key, typename Hash, typename KeyEqual>
+void swap(FlatHashSet<Key, Hash, KeyEqual> &lhs,
+          FlatHashSet<Key, Hash, KeyEqual> &rhs) noexcept {
+  lhs.swap(rhs);
+}
+
+} // namespace orteaf::internal::base
@@ -0,0 +1,716 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ORTEAF_FLAT_HASH_SSE2 1
+#endif
+
+#include "orteaf/internal/base/handle.h"
+
+namespace orteaf::internal::base {
+
+/**
+ * @brief Default hasher of FlatHashMap / FlatHashSet.
+ *
+ * Forwards to std::hash. The table post-mixes every hash, so identity hashes
+ * (integers, pointers) are fine. Specializations below add transparent
+ * string hashing and handle hashing.
+ */
+template <typename T> struct FlatHash {
+  std::size_t operator()(const T &value) const
+      noexcept(noexcept(std::hash<T>{}(value))) {
+    return std::hash<T>{}(value);
+  }
+};
+
+/**
+ * @brief Transparent string hasher: std::string keys can be looked up with a
+ *        std::string_view or a string literal without allocating.
+ */
+template <> struct FlatHash<std::string> {
+  using is_transparent = void;
+
+  std::size_t operator()(std::string_view value) const noexcept {
+    return std::hash<std::string_view>{}(value);
+  }
+};
+
+template <> struct FlatHash<std::string_view> : FlatHash<std::string> {};
+
+/**
+ * @brief Hashes a pool handle by index and generation.
+ *
+ * Slots of a FlatHashMap move on rehash, so caches that need stable
+ * references keep pool handles (or indices) as keys/values instead of
+ * pointers into the table.
+ */
+template <class Tag, class Index, class Generation>
+struct FlatHash<Handle<Tag, Index, Generation>> {
+  std::size_t
+  operator()(const Handle<Tag, Index, Generation> &handle) const noexcept {
+    std::uint64_t bits = static_cast<std::uint64_t>(handle.index);
+    if constexpr (Handle<Tag, Index, Generation>::has_generation) {
+      bits ^= static_cast<std::uint64_t>(handle.generation) << 32;
+    }
+    return static_cast<std::size_t>(bits);
+  }
+};
+
+namespace detail {
+
+/**
+ * @brief Control byte of a flat hash table slot.
+ *
+ * Full slots store the low 7 bits of the hash (0..127); empty and deleted
+ * slots have the sign bit set.
+ */
+using FlatCtrl = std::int8_t;
+inline constexpr FlatCtrl kFlatEmpty = -128;  // 0b10000000
+inline constexpr FlatCtrl kFlatDeleted = -2;  // 0b11111110
+
+constexpr bool isFlatFull(FlatCtrl ctrl) noexcept { return ctrl >= 0; }
+
+/**
+ * @brief Set of matching slot positions within one probed group.
+ *
+ * @tparam T     Mask word.
+ * @tparam Width Number of slots in a group.
+ * @tparam Shift log2 of the number of mask bits per slot.
+ */
+template <typename T, std::size_t Width, int Shift> class FlatBitMask {
+public:
+  explicit constexpr FlatBitMask(T mask) noexcept : mask_(mask) {}
+
+  explicit constexpr operator bool() const noexcept { return mask_ != 0; }
+
+  /// @brief Position of the first match (mask must be non-empty).
+  constexpr std::uint32_t lowestBitSet() const noexcept {
+    return static_cast<std::uint32_t>(std::countr_zero(mask_)) >> Shift;
+  }
+
+  constexpr void clearLowestBit() noexcept { mask_ &= (mask_ - 1); }
+
+  /// @brief Number of non-matching slots before the first match.
+  constexpr std::uint32_t trailingZeros() const noexcept {
+    return static_cast<std::uint32_t>(std::countr_zero(mask_)) >> Shift;
+  }
+
+  /// @brief Number of non-matching slots after the last match.
+  constexpr std::uint32_t leadingZeros() const noexcept {
+    constexpr int kExtraBits =
+        static_cast<int>(sizeof(T) * 8) - static_cast<int>(Width << Shift);
+    return static_cast<std::uint32_t>(std::countl_zero(mask_) - kExtraBits) >>
+           Shift;
+  }
+
+private:
+  T mask_;
+};
+
+/**
+ * @brief Portable 8-slot group matched with 64-bit SWAR arithmetic.
+ *
+ * match() may report false positives for slots that follow a true match;
+ * callers always confirm with the key comparison.
+ */
+struct FlatGroupPortable {
+  static constexpr std::size_t kWidth = 8;
+  using Mask = FlatBitMask<std::uint64_t, kWidth, 3>;
+
+  explicit FlatGroupPortable(const FlatCtrl *pos) noexcept {
+    // Assembled byte by byte so the layout is little-endian on every target;
+    // compilers fold this into a single load.
+    ctrl = 0;
+    for (std::size_t i = 0; i < kWidth; ++i) {
+      ctrl |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(pos[i]))
+              << (8 * i);
+    }
+  }
+
+  Mask match(std::uint8_t h2) const noexcept {
+    const std::uint64_t x = ctrl ^ (kLsbs * h2);
+    return Mask((x - kLsbs) & ~x & kMsbs);
+  }
+
+  Mask matchEmpty() const noexcept {
+    return Mask(ctrl & ~(ctrl << 6) & kMsbs);
+  }
+
+  Mask matchEmptyOrDeleted() const noexcept { return Mask(ctrl & kMsbs); }
+
+  std::uint32_t countLeadingEmptyOrDeleted() const noexcept {
+    return static_cast<std::uint32_t>(std::countr_zero(~ctrl & kMsbs)) >> 3;
+  }
+
+  std::uint64_t ctrl;
+
+private:
+  static constexpr std::uint64_t kLsbs = 0x0101010101010101ull;
+  static constexpr std::uint64_t kMsbs = 0x8080808080808080ull;
+};
+
+#if defined(ORTEAF_FLAT_HASH_SSE2)
+/**
+ * @brief 16-slot group matched with one SSE2 compare per query.
+ */
+struct FlatGroupSse2 {
+  static constexpr std::size_t kWidth = 16;
+  using Mask = FlatBitMask<std::uint32_t, kWidth, 0>;
+
+  explicit FlatGroupSse2(const FlatCtrl *pos) noexcept
+      : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+  Mask match(std::uint8_t h2) const noexcept {
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(h2));
+    return Mask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(pattern, ctrl))));
+  }
+
+  Mask matchEmpty() const noexcept {
+    const __m128i empty = _mm_set1_epi8(static_cast<char>(kFlatEmpty));
+    return Mask(static_cast<std::uint32_t>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(empty, ctrl))));
+  }
+
+  Mask matchEmptyOrDeleted() const noexcept {
+    return Mask(static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl)));
+  }
+
+  std::uint32_t countLeadingEmptyOrDeleted() const noexcept {
+    return static_cast<std::uint32_t>(std::countr_one(
+        static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl))));
+  }
+
+  __m128i ctrl;
+};
+
+using FlatGroup = FlatGroupSse2;
+#else
+using FlatGroup = FlatGroupPortable;
+#endif
+
+inline constexpr std::size_t kFlatGroupWidth = FlatGroup::kWidth;
+
+/**
+ * @brief Mixes a user hash so both the probe start (H1) and the 7-bit tag
+ *        (H2) depend on every input bit.
+ */
+constexpr std::uint64_t flatHashMix(std::uint64_t hash) noexcept {
+  hash *= 0x9E3779B97F4A7C15ull;
+  return hash ^ (hash >> 32);
+}
+
+constexpr std::size_t flatH1(std::uint64_t hash) noexcept {
+  return static_cast<std::size_t>(hash >> 7);
+}
+
+constexpr std::uint8_t flatH2(std::uint64_t hash) noexcept {
+  return static_cast<std::uint8_t>(hash & 0x7F);
+}
+
+/**
+ * @brief Triangular probe over groups; visits every group of a power-of-two
+ *        table exactly once before repeating.
+ */
+class FlatProbeSeq {
+public:
+  constexpr FlatProbeSeq(std::size_t h1, std::size_t mask) noexcept
+      : mask_(mask), offset_(h1 & mask) {}
+
+  constexpr std::size_t offset() const noexcept { return offset_; }
+  constexpr std::size_t offset(std::size_t i) const noexcept {
+    return (offset_ + i) & mask_;
+  }
+
+  constexpr void next() noexcept {
+    index_ += kFlatGroupWidth;
+    offset_ = (offset_ + index_) & mask_;
+  }
+
+private:
+  std::size_t mask_;
+  std::size_t offset_;
+  std::size_t index_{0};
+};
+
+/**
+ * @brief Forward iterator over the full slots of a flat hash table.
+ *
+ * @tparam Value Element type seen through the iterator (const-qualified for
+ *               const iterators).
+ */
+template <typename Value> class FlatHashIterator {
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using reference = Value &;
+  using pointer = Value *;
+
+  FlatHashIterator() noexcept = default;
+  FlatHashIterator(const FlatCtrl *ctrl, Value *slot,
+                   const FlatCtrl *ctrl_end) noexcept
+      : ctrl_(ctrl), slot_(slot), ctrl_end_(ctrl_end) {}
+
+  template <typename Other>
+    requires(std::is_const_v<Value> &&
+             std::is_same_v<Other, std::remove_const_t<Value>>)
+  FlatHashIterator(const FlatHashIterator<Other> &other) noexcept
+      : ctrl_(other.ctrl_), slot_(other.slot_), ctrl_end_(other.ctrl_end_) {}
+
+  reference operator*() const noexcept { return *slot_; }
+  pointer operator->() const noexcept { return slot_; }
+
+  FlatHashIterator &operator++() noexcept {
+    ++ctrl_;
+    ++slot_;
+    skipEmptyOrDeleted();
+    return *this;
+  }
+
+  FlatHashIterator operator++(int) noexcept {
+    FlatHashIterator copy = *this;
+    ++*this;
+    return copy;
+  }
+
+  friend bool operator==(const FlatHashIterator &lhs,
+                         const FlatHashIterator &rhs) noexcept {
+    return lhs.ctrl_ == rhs.ctrl_;
+  }
+
+  /// @brief Advances to the next full slot (or the end).
+  void skipEmptyOrDeleted() noexcept {
+    while (ctrl_ != ctrl_end_ && !isFlatFull(*ctrl_)) {
+      // Control bytes past ctrl_end_ are the cloned head, so one group load
+      // is always in bounds; only the step is clamped.
+      std::size_t step = FlatGroup(ctrl_).countLeadingEmptyOrDeleted();
+      const auto remaining = static_cast<std::size_t>(ctrl_end_ - ctrl_);
+      step = step < remaining ? step : remaining;
+      ctrl_ += step;
+      slot_ += step;
+    }
+  }
+
+private:
+  template <typename> friend class FlatHashIterator;
+  template <typename, typename, typename> friend class RawFlatHashTable;
+
+  const FlatCtrl *ctrl_{nullptr};
+  Value *slot_{nullptr};
+  const FlatCtrl *ctrl_end_{nullptr};
+};
+
+template <typename Hash, typename KeyEqual>
+inline constexpr bool kFlatHashTransparent =
+    requires {
+      typename Hash::is_transparent;
+      typename KeyEqual::is_transparent;
+    };
+
+/**
+ * @brief Swiss-table style open-addressing storage shared by FlatHashMap and
+ *        FlatHashSet.
+ *
+ * Layout: one allocation holding capacity + kFlatGroupWidth control bytes
+ * (the first group is cloned after the last slot so unaligned group loads
+ * never wrap) followed by the slot array. Capacity is a power of two and at
+ * most 7/8 of it is ever occupied (live + deleted). Lookups compare 7-bit
+ * hash tags for a whole group at once and only touch slots whose tag matches.
+ *
+ * Erased slots become tombstones unless no probe can have passed them, in
+ * which case they are returned to empty immediately. Running out of growth
+ * either rebuilds at the same capacity (mostly tombstones) or doubles.
+ *
+ * @tparam Policy Provides slot_type, key_type and key(const slot_type &).
+ */
+template <typename Policy, typename Hash, typename KeyEqual>
+class RawFlatHashTable {
+public:
+  using slot_type = typename Policy::slot_type;
+  using key_type = typename Policy::key_type;
+
+  static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+  static constexpr std::size_t kMinCapacity = kFlatGroupWidth;
+  static constexpr bool kTransparent = kFlatHashTransparent<Hash, KeyEqual>;
+
+  RawFlatHashTable() = default;
+
+  RawFlatHashTable(const Hash &hash, const KeyEqual &eq)
+      : hash_(hash), eq_(eq) {}
+
+  RawFlatHashTable(const RawFlatHashTable &other)
+      : hash_(other.hash_), eq_(other.eq_) {
+    reserve(other.size_);
+    try {
+      for (std::size_t i = 0; i < other.capacity_; ++i) {
+        if (isFlatFull(other.ctrl_[i])) {
+          insertUnique(other.slots_[i]);
+        }
+      }
+    } catch (...) {
+      destroySlotsAndDeallocate();
+      throw;
+    }
+  }
+
+  RawFlatHashTable(RawFlatHashTable &&other) noexcept
+      : ctrl_(std::exchange(other.ctrl_, nullptr)),
+        slots_(std::exchange(other.slots_, nullptr)),
+        capacity_(std::exchange(other.capacity_, 0)),
+        size_(std::exchange(other.size_, 0)),
+        growth_left_(std::exchange(other.growth_left_, 0)),
+        hash_(other.hash_), eq_(other.eq_) {}
+
+  RawFlatHashTable &operator=(const RawFlatHashTable &other) {
+    if (this != &other) {
+      RawFlatHashTable copy(other);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  RawFlatHashTable &operator=(RawFlatHashTable &&other) noexcept {
+    if (this != &other) {
+      destroySlotsAndDeallocate();
+      ctrl_ = std::exchange(other.ctrl_, nullptr);
+      slots_ = std::exchange(other.slots_, nullptr);
+      capacity_ = std::exchange(other.capacity_, 0);
+      size_ = std::exchange(other.size_, 0);
+      growth_left_ = std::exchange(other.growth_left_, 0);
+      hash_ = other.hash_;
+      eq_ = other.eq_;
+    }
+    return *this;
+  }
+
+  ~RawFlatHashTable() { destroySlotsAndDeallocate(); }
+
+  void swap(RawFlatHashTable &other) noexcept {
+    using std::swap;
+    swap(ctrl_, other.ctrl_);
+    swap(slots_, other.slots_);
+    swap(capacity_, other.capacity_);
+    swap(size_, other.size_);
+    swap(growth_left_, other.growth_left_);
+    swap(hash_, other.hash_);
+    swap(eq_, other.eq_);
+  }
+
+  std::size_t size() const noexcept { return size_; }
+  std::size_t capacity() const noexcept { return capacity_; }
+  bool empty() const noexcept { return size_ == 0; }
+  const Hash &hashFunction() const noexcept { return hash_; }
+  const KeyEqual &keyEqual() const noexcept { return eq_; }
+
+  slot_type &slotAt(std::size_t index) noexcept { return slots_[index]; }
+  const slot_type &slotAt(std::size_t index) const noexcept {
+    return slots_[index];
+  }
+
+  /// @brief Iterator to slot @p index (npos maps to end()).
+  template <typename Value>
+  FlatHashIterator<Value> iteratorAt(std::size_t index) const noexcept {
+    if (index == npos) {
+      index = capacity_;
+    }
+    return FlatHashIterator<Value>(ctrl_ + index, slots_ + index,
+                                   ctrl_ + capacity_);
+  }
+
+  template <typename Value> FlatHashIterator<Value> beginIterator() const {
+    auto it = iteratorAt<Value>(0);
+    it.skipEmptyOrDeleted();
+    return it;
+  }
+
+  template <typename Value>
+  std::size_t indexOf(const FlatHashIterator<Value> &it) const noexcept {
+    return static_cast<std::size_t>(it.ctrl_ - ctrl_);
+  }
+
+  /**
+   * @brief Returns the slot index holding @p key, or npos.
+   */
+  template <typename K> std::size_t find(const K &key) const {
+    if (size_ == 0) {
+      return npos;
+    }
+    return findWithHash(key, hashOf(key));
+  }
+
+  /**
+   * @brief Finds @p key or inserts a new slot built by @p construct.
+   *
+   * @p construct(slot_type *) placement-constructs the element. If it throws
+   * the table is left without the new element.
+   *
+   * @return Slot index and whether an insertion took place.
+   */
+  template <typename K, typename Construct>
+  std::pair<std::size_t, bool> findOrInsert(const K &key,
+                                            Construct &&construct) {
+    const std::uint64_t hash = hashOf(key);
+    if (size_ != 0) {
+      const std::size_t found = findWithHash(key, hash);
+      if (found != npos) {
+        return {found, false};
+      }
+    }
+    const std::size_t target = prepareInsert(hash);
+    std::forward<Construct>(construct)(slots_ + target);
+    commitInsert(target, hash);
+    return {target, true};
+  }
+
+  /**
+   * @brief Destroys the element in slot @p index.
+   */
+  void eraseAt(std::size_t index) noexcept {
+    std::destroy_at(slots_ + index);
+    --size_;
+    if (wasNeverFull(index)) {
+      setCtrl(ctrl_, capacity_, index, kFlatEmpty);
+      ++growth_left_;
+    } else {
+      setCtrl(ctrl_, capacity_, index, kFlatDeleted);
+    }
+  }
+
+  /**
+   * @brief Destroys every element; the allocation is kept for reuse.
+   */
+  void clear() noexcept {
+    if (capacity_ == 0) {
+      return;
+    }
+    destroySlots();
+    std::memset(ctrl_, static_cast<unsigned char>(kFlatEmpty),
+                capacity_ + kFlatGroupWidth);
+    size_ = 0;
+    growth_left_ = capacityToGrowth(capacity_);
+  }
+
+  /**
+   * @brief Makes room for @p count elements without further rehashing.
+   */
+  void reserve(std::size_t count) {
+    if (count == 0) {
+      return;
+    }
+    std::size_t capacity = kMinCapacity;
+    while (capacityToGrowth(capacity) < count) {
+      capacity *= 2;
+    }
+    if (capacity > capacity_) {
+      resize(capacity);
+    }
+  }
+
+  static constexpr std::size_t capacityToGrowth(std::size_t capacity) noexcept {
+    return capacity - capacity / 8;
+  }
+
+private:
+  template <typename K> std::uint64_t hashOf(const K &key) const {
+    return flatHashMix(static_cast<std::uint64_t>(hash_(key)));
+  }
+
+  template <typename K>
+  std::size_t findWithHash(const K &key, std::uint64_t hash) const {
+    FlatProbeSeq seq(flatH1(hash), capacity_ - 1);
+    const std::uint8_t h2 = flatH2(hash);
+    while (true) {
+      const FlatGroup group(ctrl_ + seq.offset());
+      for (auto bits = group.match(h2); bits; bits.clearLowestBit()) {
+        const std::size_t index = seq.offset(bits.lowestBitSet());
+        if (eq_(Policy::key(slots_[index]), key)) {
+          return index;
+        }
+      }
+      if (group.matchEmpty()) {
+        return npos;
+      }
+      seq.next();
+    }
+  }
+
+  static std::size_t findFirstNonFull(const FlatCtrl *ctrl,
+                                      std::size_t capacity,
+                                      std::uint64_t hash) noexcept {
+    FlatProbeSeq seq(flatH1(hash), capacity - 1);
+    while (true) {
+      const auto bits = FlatGroup(ctrl + seq.offset()).matchEmptyOrDeleted();
+      if (bits) {
+        return seq.offset(bits.lowestBitSet());
+      }
+      seq.next();
+    }
+  }
+
+  static void setCtrl(FlatCtrl *ctrl, std::size_t capacity, std::size_t index,
+                      FlatCtrl value) noexcept {
+    ctrl[index] = value;
+    if (index < kFlatGroupWidth) {
+      ctrl[capacity + index] = value;
+    }
+  }
+
+  std::size_t prepareInsert(std::uint64_t hash) {
+    if (capacity_ == 0) {
+      resize(kMinCapacity);
+    }
+    std::size_t target = findFirstNonFull(ctrl_, capacity_, hash);
+    if (growth_left_ == 0 && ctrl_[target] != kFlatDeleted) {
+      rehashAndGrow();
+      target = findFirstNonFull(ctrl_, capacity_, hash);
+    }
+    return target;
+  }
+
+  void commitInsert(std::size_t target, std::uint64_t hash) noexcept {
+    if (ctrl_[target] == kFlatEmpty) {
+      --growth_left_;
+    }
+    setCtrl(ctrl_, capacity_, target, static_cast<FlatCtrl>(flatH2(hash)));
+    ++size_;
+  }
+
+  template <typename Slot> void insertUnique(Slot &&slot) {
+    const std::uint64_t hash = hashOf(Policy::key(slot));
+    const std::size_t target = prepareInsert(hash);
+    std::construct_at(slots_ + target, std::forward<Slot>(slot));
+    commitInsert(target, hash);
+  }
+
+  /**
+   * @brief True when no probe sequence can have stepped over slot @p index,
+   *        i.e. every group window containing it still has an empty slot.
+   */
+  bool wasNeverFull(std::size_t index) const noexcept {
+    const std::size_t before = (index - kFlatGroupWidth) & (capacity_ - 1);
+    const auto empty_after = FlatGroup(ctrl_ + index).matchEmpty();
+    const auto empty_before = FlatGroup(ctrl_ + before).matchEmpty();
+    return empty_before && empty_after &&
+           static_cast<std::size_t>(empty_after.trailingZeros() +
+                                    empty_before.leadingZeros()) <
+               kFlatGroupWidth;
+  }
+
+  void rehashAndGrow() {
+    // Mostly tombstones: rebuilding in place frees them without doubling.
+    if (capacity_ > kMinCapacity && size_ * 32 <= capacity_ * 25) {
+      resize(capacity_);
+    } else {
+      resize(capacity_ * 2);
+    }
+  }
+
+  static constexpr std::size_t kSlotAlign =
+      alignof(slot_type) > 16 ? alignof(slot_type) : 16;
+
+  static constexpr std::size_t slotOffset(std::size_t capacity) noexcept {
+    const std::size_t ctrl_bytes = capacity + kFlatGroupWidth;
+    return (ctrl_bytes + alignof(slot_type) - 1) & ~(alignof(slot_type) - 1);
+  }
+
+  static constexpr std::size_t allocationSize(std::size_t capacity) noexcept {
+    return slotOffset(capacity) + capacity * sizeof(slot_type);
+  }
+
+  /**
+   * @brief Moves every element into a fresh allocation of @p new_capacity.
+   *
+   * Elements are relocated with std::move_if_noexcept, so a throwing copy
+   * leaves the table unchanged.
+   */
+  void resize(std::size_t new_capacity) {
+    void *memory = ::operator new(allocationSize(new_capacity),
+                                  std::align_val_t{kSlotAlign});
+    auto *new_ctrl = static_cast<FlatCtrl *>(memory);
+    auto *new_slots = reinterpret_cast<slot_type *>(
+        static_cast<unsigned char *>(memory) + slotOffset(new_capacity));
+    std::memset(new_ctrl, static_cast<unsigned char>(kFlatEmpty),
+                new_capacity + kFlatGroupWidth);
+
+    std::size_t moved = 0;
+    try {
+      for (std::size_t i = 0; i < capacity_; ++i) {
+        if (!isFlatFull(ctrl_[i])) {
+          continue;
+        }
+        const std::uint64_t hash = hashOf(Policy::key(slots_[i]));
+        const std::size_t target =
+            findFirstNonFull(new_ctrl, new_capacity, hash);
+        std::construct_at(new_slots + target,
+                          std::move_if_noexcept(slots_[i]));
+        setCtrl(new_ctrl, new_capacity, target,
+                static_cast<FlatCtrl>(flatH2(hash)));
+        ++moved;
+      }
+    } catch (...) {
+      for (std::size_t i = 0; moved != 0 && i < new_capacity; ++i) {
+        if (isFlatFull(new_ctrl[i])) {
+          std::destroy_at(new_slots + i);
+          --moved;
+        }
+      }
+      ::operator delete(memory, std::align_val_t{kSlotAlign});
+      throw;
+    }
+
+    destroySlotsAndDeallocate();
+    ctrl_ = new_ctrl;
+    slots_ = new_slots;
+    capacity_ = new_capacity;
+    growth_left_ = capacityToGrowth(new_capacity) - size_;
+  }
+
+  void destroySlots() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<slot_type>) {
+      for (std::size_t i = 0; i < capacity_; ++i) {
+        if (isFlatFull(ctrl_[i])) {
+          std::destroy_at(slots_ + i);
+        }
+      }
+    }
+  }
+
+  void destroySlotsAndDeallocate() noexcept {
+    if (capacity_ == 0) {
+      return;
+    }
+    destroySlots();
+    ::operator delete(static_cast<void *>(ctrl_), std::align_val_t{kSlotAlign});
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    growth_left_ = 0;
+  }
+
+  FlatCtrl *ctrl_{nullptr};
+  slot_type *slots_{nullptr};
+  std::size_t capacity_{0};
+  std::size_t size_{0};
+  std::size_t growth_left_{0};
+  [[no_unique_address]] Hash hash_{};
+  [[no_unique_address]] KeyEqual eq_{};
+};
+
+} // namespace detail
+
+} // namespace orteaf::internal::base
@@ -0,0 +1,271 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <thread>
+
+namespace orteaf::internal::base {
+
+/**
+ * @brief Counting policy used by the control blocks for strong/weak counts.
+ *
+ * increment()/decrement() must be balanced by the caller. decrement() on a
+ * zero count is ignored and returns false. tryIncrementIfNonZero() only
+ * succeeds while the count is non-zero (weak -> strong promotion).
+ */
+template <typename T>
+concept RefCountPolicy = std::default_initializable<T> &&
+                         requires(T &count, const T &ccount, std::uint32_t v) {
+                           count.increment();
+                           { count.decrement() } -> std::same_as<bool>;
+                           { count.tryIncrementIfNonZero() } -> std::same_as<bool>;
+                           { ccount.load() } -> std::same_as<std::uint32_t>;
+                           count.reset(v);
+                         };
+
+/**
+ * @brief Reference count backed by std::atomic (the default policy).
+ *
+ * Safe to update from any number of threads.
+ */
+class AtomicRefCount {
+public:
+  static constexpr bool kThreadSafe = true;
+
+  AtomicRefCount() = default;
+  AtomicRefCount(const AtomicRefCount &) = delete;
+  AtomicRefCount &operator=(const AtomicRefCount &) = delete;
+
+  void increment() noexcept { count_.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * @return True when this call drops the count from 1 to 0.
+   */
+  bool decrement() noexcept {
+    auto current = count_.load(std::memory_order_acquire);
+    while (current > 0) {
+      if (count_.compare_exchange_weak(current, current - 1,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_relaxed)) {
+        return current == 1;
+      }
+    }
+    return false;
+  }
+
+  bool tryIncrementIfNonZero() noexcept {
+    auto current = count_.load(std::memory_order_acquire);
+    while (current > 0) {
+      if (count_.compare_exchange_weak(current, current + 1,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::uint32_t load() const noexcept {
+    return count_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Overwrites the count (control-block move only; not synchronized).
+   */
+  void reset(std::uint32_t value) noexcept {
+    count_.store(value, std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<std::uint32_t> count_{0};
+};
+
+/**
+ * @brief Plain integer reference count for single-threaded managers.
+ *
+ * No atomic instructions at all; every lease referring to the control block
+ * must be created, copied and destroyed on one thread at a time.
+ */
+class PlainRefCount {
+public:
+  static constexpr bool kThreadSafe = false;
+
+  PlainRefCount() = default;
+  PlainRefCount(const PlainRefCount &) = delete;
+  PlainRefCount &operator=(const PlainRefCount &) = delete;
+
+  void increment() noexcept { ++count_; }
+
+  bool decrement() noexcept {
+    if (count_ == 0) {
+      return false;
+    }
+    return --count_ == 0;
+  }
+
+  bool tryIncrementIfNonZero() noexcept {
+    if (count_ == 0) {
+      return false;
+    }
+    ++count_;
+    return true;
+  }
+
+  std::uint32_t load() const noexcept { return count_; }
+
+  void reset(std::uint32_t value) noexcept { count_ = value; }
+
+private:
+  std::uint32_t count_{0};
+};
+
+/**
+ * @brief Reference count biased towards the thread that took the first
+ *        reference.
+ *
+ * The thread that moves the count from 0 to 1 becomes the owner. While the
+ * count stays biased, the owner updates it with plain loads and stores (no
+ * locked read-modify-write). The first update from any other thread revokes
+ * the bias and from then on every thread, the owner included, uses atomic
+ * read-modify-write. The count is biased again when it next returns to zero
+ * and is re-acquired.
+ *
+ * Revocation is not a handshake with the owner, so a lease may be handed to
+ * another thread only through a synchronizing hand-off (queue, future, ...)
+ * after which the owner no longer touches that control block concurrently.
+ * Control blocks whose leases are copied or dropped on several threads at
+ * the same time must use AtomicRefCount.
+ */
+class BiasedRefCount {
+public:
+  static constexpr bool kThreadSafe = false;
+
+  BiasedRefCount() = default;
+  BiasedRefCount(const BiasedRefCount &) = delete;
+  BiasedRefCount &operator=(const BiasedRefCount &) = delete;
+
+  void increment() noexcept {
+    if (isOwnerFastPath()) {
+      count_.store(count_.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_relaxed);
+      return;
+    }
+    std::uint32_t current = count_.load(std::memory_order_relaxed);
+    if (current == 0) {
+      // 0 -> 1 has no other holder to race with; take the bias.
+      owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+      biased_.store(true, std::memory_order_relaxed);
+      count_.store(1, std::memory_order_release);
+      return;
+    }
+    revokeBias();
+    count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  bool decrement() noexcept {
+    if (isOwnerFastPath()) {
+      const std::uint32_t current = count_.load(std::memory_order_relaxed);
+      if (current == 0) {
+        return false;
+      }
+      count_.store(current - 1, std::memory_order_relaxed);
+      return current == 1;
+    }
+    revokeBias();
+    auto current = count_.load(std::memory_order_acquire);
+    while (current > 0) {
+      if (count_.compare_exchange_weak(current, current - 1,
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_relaxed)) {
+        return current == 1;
+      }
+    }
+    return false;
+  }
+
+  bool tryIncrementIfNonZero() noexcept {
+    if (isOwnerFastPath()) {
+      const std::uint32_t current = count_.load(std::memory_order_relaxed);
+      if (current == 0) {
+        return false;
+      }
+      count_.store(current + 1, std::memory_order_relaxed);
+      return true;
+    }
+    revokeBias();
+    auto current = count_.load(std::memory_order_acquire);
+    while (current > 0) {
+      if (count_.compare_exchange_weak(current, current + 1,
+                                       std::memory_order_acquire,
+                                       std::memory_order_relaxed)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::uint32_t load() const noexcept {
+    return count_.load(std::memory_order_acquire);
+  }
+
+  void reset(std::uint32_t value) noexcept {
+    count_.store(value, std::memory_order_relaxed);
+    biased_.store(false, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief True while the owner thread may update the count without RMW.
+   */
+  bool isBiased() const noexcept {
+    return biased_.load(std::memory_order_relaxed);
+  }
+
+private:
+  bool isOwnerFastPath() const noexcept {
+    return biased_.load(std::memory_order_relaxed) &&
+           owner_.load(std::memory_order_relaxed) == std::this_thread::get_id();
+  }
+
+  void revokeBias() noexcept {
+    if (biased_.load(std::memory_order_relaxed)) {
+      biased_.store(false, std::memory_order_release);
+    }
+  }
+
+  std::atomic<std::uint32_t> count_{0};
+  std::atomic<bool> biased_{false};
+  std::atomic<std::thread::id> owner_{};
+};
+
+/**
+ * @brief Rebinds the counting policy of a control block template.
+ *
+ * RebindRefCountT<SharedControlBlock<H, P, Pool>, PlainRefCount> is
+ * SharedControlBlock<H, P, Pool, PlainRefCount>. Types that are not control
+ * block specializations are left unchanged; callers that rely on the rebind
+ * should check the result with ControlBlockUsesRefCount.
+ */
+template <typename ControlBlockT, typename CountT> struct RebindRefCount {
+  using type = ControlBlockT;
+};
+
+template <template <typename, typename, typename, typename> class ControlBlockT,
+          typename HandleT, typename PayloadT, typename PoolT, typename OldT,
+          typename CountT>
+struct RebindRefCount<ControlBlockT<HandleT, PayloadT, PoolT, OldT>, CountT> {
+  using type = ControlBlockT<HandleT, PayloadT, PoolT, CountT>;
+};
+
+template <typename ControlBlockT, typename CountT>
+using RebindRefCountT = typename RebindRefCount<ControlBlockT, CountT>::type;
+
+/**
+ * @brief True if @p ControlBlockT counts references with @p CountT.
+ */
+template <typename ControlBlockT, typename CountT>
+concept ControlBlockUsesRefCount =
+    requires { typename ControlBlockT::RefCount; } &&
+    std::same_as<typename ControlBlockT::RefCount, CountT>;
+
+} // namespace orteaf::internal::base
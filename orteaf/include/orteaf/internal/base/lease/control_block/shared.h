@@ -1,12 +1,12 @@
 #pragma once
 
-#include <atomic>
 #include <concepts>
 #include <cstdint>
 #include <type_traits>
 #include <utility>
 
 #include <orteaf/internal/base/lease/category.h>
+#include <orteaf/internal/base/lease/control_block/ref_count.h>
 
 namespace orteaf::internal::base {
 
@@ -22,39 +22,39 @@ namespace orteaf::internal::base {
  * coordinates release to the pool. Payload lifetime rules are enforced by the
  * manager and/or pool implementation.
  *
- * Thread-safety: reference counts use atomics. Payload binding methods are not
- * synchronized and must be externally serialized.
+ * Thread-safety: reference counts follow CountT (atomic by default; see
+ * ref_count.h for PlainRefCount/BiasedRefCount). Payload binding methods are
+ * not synchronized and must be externally serialized.
  *
  * @tparam HandleT Handle type with Handle::invalid() and isValid().
  * @tparam PayloadT Payload type stored in the pool.
  * @tparam PoolT Pool type providing release(handle) -> bool.
+ * @tparam CountT Counting policy satisfying RefCountPolicy.
  */
-template <typename HandleT, typename PayloadT, typename PoolT>
+template <typename HandleT, typename PayloadT, typename PoolT,
+          RefCountPolicy CountT = AtomicRefCount>
 class SharedControlBlock {
 public:
   using Category = lease_category::Shared;
   using Handle = HandleT;
   using Payload = PayloadT;
   using Pool = PoolT;
+  using RefCount = CountT;
 
   SharedControlBlock() = default;
   SharedControlBlock(const SharedControlBlock &) = delete;
   SharedControlBlock &operator=(const SharedControlBlock &) = delete;
   SharedControlBlock(SharedControlBlock &&other) noexcept {
-    strong_count_.store(other.strong_count_.load(std::memory_order_relaxed),
-                        std::memory_order_relaxed);
-    weak_count_.store(other.weak_count_.load(std::memory_order_relaxed),
-                      std::memory_order_relaxed);
+    strong_count_.reset(other.strong_count_.load());
+    weak_count_.reset(other.weak_count_.load());
     payload_handle_ = other.payload_handle_;
     payload_ptr_ = other.payload_ptr_;
     payload_pool_ = other.payload_pool_;
   }
   SharedControlBlock &operator=(SharedControlBlock &&other) noexcept {
     if (this != &other) {
-      strong_count_.store(other.strong_count_.load(std::memory_order_relaxed),
-                          std::memory_order_relaxed);
-      weak_count_.store(other.weak_count_.load(std::memory_order_relaxed),
-                        std::memory_order_relaxed);
+      strong_count_.reset(other.strong_count_.load());
+      weak_count_.reset(other.weak_count_.load());
       payload_handle_ = other.payload_handle_;
       payload_ptr_ = other.payload_ptr_;
       payload_pool_ = other.payload_pool_;
@@ -119,7 +119,7 @@ public:
    * @brief Increments the strong reference count.
    */
   void acquireStrong() noexcept {
-    strong_count_.fetch_add(1, std::memory_order_relaxed);
+    strong_count_.increment();
   }
 
   /**
@@ -131,33 +131,25 @@ public:
    * @return True when this call drops the count from 1 to 0.
    */
   bool releaseStrong() noexcept {
-    auto current = strong_count_.load(std::memory_order_acquire);
-    while (current > 0) {
-      if (strong_count_.compare_exchange_weak(current, current - 1,
-                                              std::memory_order_acq_rel,
-                                              std::memory_order_relaxed)) {
-        if (current == 1) {
-          tryReleasePayload();
-          return true;
-        }
-        return false;
-      }
+    if (!strong_count_.decrement()) {
+      return false;
     }
-    return false;
+    tryReleasePayload();
+    return true;
   }
 
   /**
    * @brief Returns the current strong reference count.
    */
   std::uint32_t strongCount() const noexcept {
-    return strong_count_.load(std::memory_order_acquire);
+    return strong_count_.load();
   }
 
   /**
    * @brief Increments the weak reference count.
    */
   void acquireWeak() noexcept {
-    weak_count_.fetch_add(1, std::memory_order_relaxed);
+    weak_count_.increment();
   }
 
   /**
@@ -166,28 +158,20 @@ public:
    * @return True if this call observed the transition from 1 to 0.
    */
   bool releaseWeak() noexcept {
-    auto current = weak_count_.load(std::memory_order_acquire);
-    while (current > 0) {
-      if (weak_count_.compare_exchange_weak(current, current - 1,
-                                            std::memory_order_acq_rel,
-                                            std::memory_order_relaxed)) {
-        if (current == 1) {
-          if (canShutdown()) {
-            clearPayload();
-          }
-          return true;
-        }
-        return false;
-      }
+    if (!weak_count_.decrement()) {
+      return false;
     }
-    return false;
+    if (canShutdown()) {
+      clearPayload();
+    }
+    return true;
   }
 
   /**
    * @brief Returns the current weak reference count.
    */
   std::uint32_t weakCount() const noexcept {
-    return weak_count_.load(std::memory_order_acquire);
+    return weak_count_.load();
   }
 
   /**
@@ -198,15 +182,7 @@ public:
    * higher-level systems.
    */
   bool tryPromoteWeakToStrong() noexcept {
-    std::uint32_t current = strong_count_.load(std::memory_order_acquire);
-    while (current > 0) {
-      if (strong_count_.compare_exchange_weak(current, current + 1,
-                                              std::memory_order_acquire,
-                                              std::memory_order_relaxed)) {
-        return true;
-      }
-    }
-    return false;
+    return strong_count_.tryIncrementIfNonZero();
   }
 
   /**
@@ -264,8 +240,8 @@ private:
     payload_pool_ = nullptr;
   }
 
-  std::atomic<std::uint32_t> strong_count_{0};
-  std::atomic<std::uint32_t> weak_count_{0};
+  CountT strong_count_{};
+  CountT weak_count_{};
   Handle payload_handle_{Handle::invalid()};
   Payload *payload_ptr_{nullptr};
   Pool *payload_pool_{nullptr};
@@ -1,12 +1,12 @@
 #pragma once
 
-#include <atomic>
 #include <concepts>
 #include <cstdint>
 #include <type_traits>
 #include <utility>
 
 #include <orteaf/internal/base/lease/category.h>
+#include <orteaf/internal/base/lease/control_block/ref_count.h>
 
 namespace orteaf::internal::base {
 
@@ -24,35 +24,37 @@ namespace orteaf::internal::base {
  * coordinates release to the pool. Payload lifetime rules are enforced by the
  * manager and/or pool implementation.
  *
- * Thread-safety: reference counts use atomics. Payload binding methods are not
- * synchronized and must be externally serialized.
+ * Thread-safety: reference counts follow CountT (atomic by default; see
+ * ref_count.h for PlainRefCount/BiasedRefCount). Payload binding methods are
+ * not synchronized and must be externally serialized.
  *
  * @tparam HandleT Handle type with Handle::invalid() and isValid().
  * @tparam PayloadT Payload type stored in the pool.
  * @tparam PoolT Pool type providing release(handle) -> bool.
+ * @tparam CountT Counting policy satisfying RefCountPolicy.
  */
-template <typename HandleT, typename PayloadT, typename PoolT>
+template <typename HandleT, typename PayloadT, typename PoolT,
+          RefCountPolicy CountT = AtomicRefCount>
 class StrongControlBlock {
 public:
   using Category = lease_category::Strong;
   using Handle = HandleT;
   using Payload = PayloadT;
   using Pool = PoolT;
+  using RefCount = CountT;
 
   StrongControlBlock() = default;
   StrongControlBlock(const StrongControlBlock &) = delete;
   StrongControlBlock &operator=(const StrongControlBlock &) = delete;
   StrongControlBlock(StrongControlBlock &&other) noexcept {
-    strong_count_.store(other.strong_count_.load(std::memory_order_relaxed),
-                        std::memory_order_relaxed);
+    strong_count_.reset(other.strong_count_.load());
     payload_handle_ = other.payload_handle_;
     payload_ptr_ = other.payload_ptr_;
     payload_pool_ = other.payload_pool_;
   }
   StrongControlBlock &operator=(StrongControlBlock &&other) noexcept {
     if (this != &other) {
-      strong_count_.store(other.strong_count_.load(std::memory_order_relaxed),
-                          std::memory_order_relaxed);
+      strong_count_.reset(other.strong_count_.load());
       payload_handle_ = other.payload_handle_;
       payload_ptr_ = other.payload_ptr_;
       payload_pool_ = other.payload_pool_;
@@ -117,7 +119,7 @@ public:
    * @brief Increments the strong reference count.
    */
   void acquireStrong() noexcept {
-    strong_count_.fetch_add(1, std::memory_order_relaxed);
+    strong_count_.increment();
   }
 
   /**
@@ -129,26 +131,18 @@ public:
    * @return True when this call drops the count from 1 to 0.
    */
   bool releaseStrong() noexcept {
-    auto current = strong_count_.load(std::memory_order_acquire);
-    while (current > 0) {
-      if (strong_count_.compare_exchange_weak(current, current - 1,
-                                              std::memory_order_acq_rel,
-                                              std::memory_order_relaxed)) {
-        if (current == 1) {
-          tryReleasePayload();
-          return true;
-        }
-        return false;
-      }
+    if (!strong_count_.decrement()) {
+      return false;
     }
-    return false;
+    tryReleasePayload();
+    return true;
   }
 
   /**
    * @brief Returns the current strong reference count.
    */
   std::uint32_t strongCount() const noexcept {
-    return strong_count_.load(std::memory_order_acquire);
+    return strong_count_.load();
   }
 
   /**
@@ -204,7 +198,7 @@ private:
     payload_pool_ = nullptr;
   }
 
-  std::atomic<std::uint32_t> strong_count_{0};
+  CountT strong_count_{};
   Handle payload_handle_{Handle::invalid()};
   Payload *payload_ptr_{nullptr};
   Pool *payload_pool_{nullptr};
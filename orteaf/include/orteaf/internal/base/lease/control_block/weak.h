@@ -1,10 +1,10 @@
 #pragma once
 
-#include <atomic>
 #include <cstdint>
 #include <cstdio>
 
 #include <orteaf/internal/base/lease/category.h>
+#include <orteaf/internal/base/lease/control_block/ref_count.h>
 
 namespace orteaf::internal::base {
 
@@ -20,35 +20,37 @@ namespace orteaf::internal::base {
  * The control block does not create/destroy payloads directly and does not
  * release payloads on weak count transition; it only tracks weak lifetime.
  *
- * Thread-safety: reference counts use atomics. Payload binding methods are not
- * synchronized and must be externally serialized.
+ * Thread-safety: reference counts follow CountT (atomic by default; see
+ * ref_count.h for PlainRefCount/BiasedRefCount). Payload binding methods are
+ * not synchronized and must be externally serialized.
  *
  * @tparam HandleT Handle type with Handle::invalid() and isValid().
  * @tparam PayloadT Payload type stored in the pool.
  * @tparam PoolT Pool type providing release(handle) -> bool (unused here).
+ * @tparam CountT Counting policy satisfying RefCountPolicy.
  */
-template <typename HandleT, typename PayloadT, typename PoolT>
+template <typename HandleT, typename PayloadT, typename PoolT,
+          RefCountPolicy CountT = AtomicRefCount>
 class WeakControlBlock {
 public:
   using Category = lease_category::Weak;
   using Handle = HandleT;
   using Payload = PayloadT;
   using Pool = PoolT;
+  using RefCount = CountT;
 
   WeakControlBlock() = default;
   WeakControlBlock(const WeakControlBlock &) = delete;
   WeakControlBlock &operator=(const WeakControlBlock &) = delete;
   WeakControlBlock(WeakControlBlock &&other) noexcept {
-    weak_count_.store(other.weak_count_.load(std::memory_order_relaxed),
-                      std::memory_order_relaxed);
+    weak_count_.reset(other.weak_count_.load());
     payload_handle_ = other.payload_handle_;
     payload_ptr_ = other.payload_ptr_;
     payload_pool_ = other.payload_pool_;
   }
   WeakControlBlock &operator=(WeakControlBlock &&other) noexcept {
     if (this != &other) {
-      weak_count_.store(other.weak_count_.load(std::memory_order_relaxed),
-                        std::memory_order_relaxed);
+      weak_count_.reset(other.weak_count_.load());
       payload_handle_ = other.payload_handle_;
       payload_ptr_ = other.payload_ptr_;
       payload_pool_ = other.payload_pool_;
@@ -113,7 +115,7 @@ public:
    * @brief Increments the weak reference count.
    */
   void acquireWeak() noexcept {
-    weak_count_.fetch_add(1, std::memory_order_relaxed);
+    weak_count_.increment();
   }
 
   /**
@@ -122,26 +124,18 @@ public:
    * @return True if this call observed the transition from 1 to 0.
    */
   bool releaseWeak() noexcept {
-    auto current = weak_count_.load(std::memory_order_acquire);
-    while (current > 0) {
-      if (weak_count_.compare_exchange_weak(current, current - 1,
-                                            std::memory_order_acq_rel,
-                                            std::memory_order_relaxed)) {
-        if (current == 1) {
-          clearPayload();
-          return true;
-        }
-        return false;
-      }
+    if (!weak_count_.decrement()) {
+      return false;
     }
-    return false;
+    clearPayload();
+    return true;
   }
 
   /**
    * @brief Returns the current weak reference count.
    */
   std::uint32_t weakCount() const noexcept {
-    return weak_count_.load(std::memory_order_acquire);
+    return weak_count_.load();
   }
 
   /**
@@ -179,7 +173,7 @@ private:
     payload_pool_ = nullptr;
   }
 
-  std::atomic<std::uint32_t> weak_count_{0};
+  CountT weak_count_{};
   Handle payload_handle_{Handle::invalid()};
   Payload *payload_ptr_{nullptr};
   Pool *payload_pool_{nullptr};
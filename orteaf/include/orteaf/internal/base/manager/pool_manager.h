@@ -1,16 +1,22 @@
 #pragma once
 
+#include <array>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 #include <orteaf/internal/base/lease/concepts.h>
+#include <orteaf/internal/base/lease/control_block/ref_count.h>
 #include <orteaf/internal/base/lease/strong_lease.h>
 #include <orteaf/internal/base/lease/weak_lease.h>
+#include <orteaf/internal/base/pool/concurrent_slot_pool.h>
 #include <orteaf/internal/base/pool/default_control_block_pool_traits.h>
 #include <orteaf/internal/base/pool/pool_concepts.h>
+#include <orteaf/internal/base/small_vector.h>
 #include <orteaf/internal/diagnostics/error/error.h>
 
 namespace orteaf::internal::base {
@@ -28,6 +34,14 @@ namespace orteaf::internal::base {
  *   struct ControlBlockTag {};       // ControlBlock Handle識別用のタグ
  *   using PayloadHandle = ...;       // Payload識別用のHandle型
  *   static constexpr const char* Name = "...";  // エラーメッセージ用の名前
+ *
+ * Optional members:
+ *   // true で ControlBlock Pool に ConcurrentSlotPool を使う
+ *   // （Lease の取得・解放を複数スレッドから行うManager向け）
+ *   static constexpr bool concurrent_control_block_pool = true;
+ *   // ControlBlock の参照カウント方式を差し替える
+ *   // （AtomicRefCount / PlainRefCount / BiasedRefCount）
+ *   using RefCountPolicy = PlainRefCount;
  */
 template <typename Traits>
 concept PoolManagerTraitsConcept = requires {
@@ -38,6 +52,29 @@ concept PoolManagerTraitsConcept = requires {
   { Traits::Name } -> std::convertible_to<const char *>;
 };
 
+namespace detail {
+
+/// Traits::RefCountPolicy があれば ControlBlock の参照カウント方式を差し替える
+template <typename Traits> struct ManagedControlBlock {
+  using type = typename Traits::ControlBlock;
+};
+
+template <typename Traits>
+  requires requires { typename Traits::RefCountPolicy; }
+struct ManagedControlBlock<Traits> {
+  static_assert(RefCountPolicy<typename Traits::RefCountPolicy>,
+                "Traits::RefCountPolicy must satisfy RefCountPolicy");
+  using type = RebindRefCountT<typename Traits::ControlBlock,
+                               typename Traits::RefCountPolicy>;
+  // RebindRefCount は差し替えられない型をそのまま返すため、ここで確認する
+  static_assert(
+      ControlBlockUsesRefCount<type, typename Traits::RefCountPolicy>,
+      "Traits::RefCountPolicy requires a ControlBlock template whose last "
+      "parameter is the RefCount policy");
+};
+
+} // namespace detail
+
 // =============================================================================
 // PoolManager
 // =============================================================================
@@ -66,13 +103,30 @@ public:
   // ===========================================================================
 
   using PayloadPool = typename Traits::PayloadPool;
-  using ControlBlock = typename Traits::ControlBlock;
+  using ControlBlock = typename detail::ManagedControlBlock<Traits>::type;
   using ControlBlockTag = typename Traits::ControlBlockTag;
   using ControlBlockHandle = pool::ControlBlockHandle<ControlBlockTag>;
   using ControlBlockPoolTraits =
       pool::DefaultControlBlockPoolTraits<ControlBlock, ControlBlockTag>;
-  using ControlBlockPool = pool::SlotPool<ControlBlockPoolTraits>;
+  static constexpr bool kConcurrentControlBlockPool = [] {
+    if constexpr (requires { Traits::concurrent_control_block_pool; }) {
+      return static_cast<bool>(Traits::concurrent_control_block_pool);
+    }
+    return false;
+  }();
+  using ControlBlockPool =
+      std::conditional_t<kConcurrentControlBlockPool,
+                         pool::ConcurrentSlotPool<ControlBlockPoolTraits>,
+                         pool::SlotPool<ControlBlockPoolTraits>>;
+  static_assert(!kConcurrentControlBlockPool || [] {
+    if constexpr (requires { ControlBlock::RefCount::kThreadSafe; }) {
+      return ControlBlock::RefCount::kThreadSafe;
+    }
+    return true;
+  }(), "concurrent_control_block_pool requires a thread-safe RefCountPolicy");
   using PayloadHandle = typename Traits::PayloadHandle;
+  /// acquireStrongLeases の戻り値・解放バッファのインライン要素数
+  static constexpr std::size_t kLeaseBatchInlineCapacity = 16;
 
   // Lease types - PoolManager is the friend (ManagerT) for these leases
   using WeakLeaseType = WeakLease<ControlBlockHandle, ControlBlock,
@@ -151,6 +205,11 @@ public:
     setPayloadBlockSize(config.payload_block_size);
     resizePayloadPool(config.payload_capacity);
 
+    // release(handle) で destroy するために Context を必要とする Pool へ渡す
+    if constexpr (requires { payload_pool_.bindReleaseContext(context); }) {
+      payload_pool_.bindReleaseContext(context);
+    }
+
     // ControlBlock の設定
     applyControlBlockConfig(config);
 
@@ -409,6 +468,118 @@ public:
     return acquireLeaseImpl<StrongLeaseType>(handle);
   }
 
+  /**
+   * @brief 複数の StrongLease をまとめて取得
+   *
+   * 設定確認と ControlBlock Pool の拡張を一度にまとめ、ControlBlock は
+   * Pool から一括で取り出す。handle の検証はすべて取得前に行うため、
+   * 例外時に Lease が部分的に残ることはない。
+   *
+   * @tparam InlineCapacity 戻り値の SmallVector のインライン要素数
+   * @param handles Payload handles
+   * @return handles と同じ順序の StrongLease
+   * @throws InvalidArgument いずれかの handle が無効な場合
+   * @throws InvalidState いずれかの payload が利用不可の場合
+   */
+  template <std::size_t InlineCapacity = kLeaseBatchInlineCapacity>
+  SmallVector<StrongLeaseType, InlineCapacity>
+  acquireStrongLeases(std::span<const PayloadHandle> handles)
+    requires StrongControlBlockConcept<ControlBlock>
+  {
+    ensureConfigured();
+
+    using PayloadPtr = decltype(validatedPayloadPtr(handles.front()));
+    SmallVector<PayloadPtr, InlineCapacity> payload_ptrs{};
+    payload_ptrs.reserve(handles.size());
+    std::size_t needed = 0;
+    for (const PayloadHandle &handle : handles) {
+      payload_ptrs.pushBack(validatedPayloadPtr(handle));
+      if (!hasLiveBoundControlBlock(handle)) {
+        ++needed;
+      }
+    }
+
+    SmallVector<ControlBlockHandle, InlineCapacity> cb_handles(needed);
+    acquireControlBlocks(std::span<ControlBlockHandle>(cb_handles.data(),
+                                                       cb_handles.size()));
+
+    SmallVector<StrongLeaseType, InlineCapacity> leases{};
+    leases.reserve(handles.size());
+    std::size_t next_cb = 0;
+    for (std::size_t i = 0; i < handles.size(); ++i) {
+      const PayloadHandle handle = handles[i];
+      // 同じ handle が重複していれば、先に bind した CB を再利用する
+      if (hasLiveBoundControlBlock(handle)) {
+        if constexpr (pool::ControlBlockBindableConcept<PayloadPool>) {
+          auto cb_handle = payload_pool_.getBoundControlBlock(handle);
+          leases.emplaceBack(StrongLeaseType{control_block_pool_.get(cb_handle),
+                                             &control_block_pool_, cb_handle});
+        }
+        continue;
+      }
+      if constexpr (pool::ControlBlockBindableConcept<PayloadPool>) {
+        if (payload_pool_.hasBoundControlBlock(handle)) {
+          payload_pool_.unbindControlBlock(handle);
+        }
+      }
+      const ControlBlockHandle cb_handle = cb_handles[next_cb++];
+      auto *cb_ptr = getControlBlock(cb_handle);
+      if (!cb_ptr->tryBindPayload(handle, payload_ptrs[i], &payload_pool_)) {
+        control_block_pool_.release(std::span<const ControlBlockHandle>(
+            cb_handles.data() + next_cb - 1, cb_handles.size() - next_cb + 1));
+        ::orteaf::internal::diagnostics::error::throwError(
+            ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
+            std::string(managerName()) + " control block binding failed");
+      }
+      if constexpr (pool::ControlBlockBindableConcept<PayloadPool>) {
+        payload_pool_.bindControlBlock(handle, cb_handle);
+      }
+      leases.emplaceBack(
+          StrongLeaseType{cb_ptr, &control_block_pool_, cb_handle});
+    }
+    // 重複 handle の分だけ余った CB を返却
+    control_block_pool_.release(std::span<const ControlBlockHandle>(
+        cb_handles.data() + next_cb, cb_handles.size() - next_cb));
+    return leases;
+  }
+
+  /**
+   * @brief 複数の StrongLease をまとめて解放
+   *
+   * 各 Lease の strong count を減らし、返却対象になった ControlBlock を
+   * まとめて Pool に返す。解放後の Lease はすべて無効になる。
+   * 他の Manager の Lease が混ざっていても個別に release() される。
+   *
+   * @param leases 解放する Lease（無効な Lease は無視）
+   */
+  void releaseStrongLeases(std::span<StrongLeaseType> leases) noexcept
+    requires StrongControlBlockConcept<ControlBlock>
+  {
+    std::array<ControlBlockHandle, kLeaseBatchInlineCapacity> pending{};
+    std::size_t pending_count = 0;
+    for (StrongLeaseType &lease : leases) {
+      if (!lease) {
+        continue;
+      }
+      if (lease.pool_ != &control_block_pool_) {
+        lease.release();
+        continue;
+      }
+      const bool released = lease.control_block_->releaseStrong();
+      if (released && lease.control_block_->canShutdown()) {
+        pending[pending_count++] = lease.handle_;
+        if (pending_count == pending.size()) {
+          control_block_pool_.release(
+              std::span<const ControlBlockHandle>(pending.data(), pending_count));
+          pending_count = 0;
+        }
+      }
+      lease.invalidate();
+    }
+    control_block_pool_.release(
+        std::span<const ControlBlockHandle>(pending.data(), pending_count));
+  }
+
 #if ORTEAF_ENABLE_TEST
   // ===========================================================================
   // Test Support
@@ -638,6 +809,10 @@ private:
     if (grow_by == 0) {
       return payload_pool_.size();
     }
+    // 並行 Pool では他スレッドの拡張と競合しないよう相対的に拡張する
+    if constexpr (requires { payload_pool_.growBy(grow_by); }) {
+      return payload_pool_.growBy(grow_by) + grow_by;
+    }
     const std::size_t desired = payload_pool_.size() + grow_by;
     payload_pool_.resize(desired);
     return desired;
@@ -659,6 +834,13 @@ private:
       { pool.createRange(start, end, req, ctx) } -> std::convertible_to<bool>;
     }
   {
+    if constexpr (requires {
+                    {
+                      payload_pool_.growByAndCreate(grow_by, request, context)
+                    } -> std::convertible_to<bool>;
+                  }) {
+      return payload_pool_.growByAndCreate(grow_by, request, context);
+    }
     const std::size_t old_size = payload_pool_.size();
     const std::size_t new_size = growPayloadPoolBy(grow_by);
     if (new_size == old_size) {
@@ -669,18 +851,21 @@ private:
   }
 
   /**
-   * @brief ControlBlock Pool を control_block_growth_chunk_size_ 分拡張
+   * @brief ControlBlock Pool を grow_by 分拡張して作成
    */
-  void growControlBlockPool() {
+  void growControlBlockPool(std::size_t grow_by) {
     if (control_block_block_size_ == 0) {
       ::orteaf::internal::diagnostics::error::throwError(
           ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
           std::string(managerName()) + " control block size is not set");
     }
-    const std::size_t desired =
-        control_block_pool_.size() + control_block_growth_chunk_size_;
     typename ControlBlockPoolTraits::Request request{};
     typename ControlBlockPoolTraits::Context context{};
+    if constexpr (kConcurrentControlBlockPool) {
+      control_block_pool_.growByAndCreate(grow_by, request, context);
+      return;
+    }
+    const std::size_t desired = control_block_pool_.size() + grow_by;
     const std::size_t old_capacity = control_block_pool_.resize(desired);
     control_block_pool_.createRange(old_capacity, control_block_pool_.size(),
                                     request, context);
@@ -699,8 +884,11 @@ private:
   ControlBlockHandle acquireControlBlock() {
     auto handle = control_block_pool_.tryAcquireCreated();
     if (!handle.isValid()) {
-      growControlBlockPool();
-      handle = control_block_pool_.tryAcquireCreated();
+      // 並行 Pool では拡張分を他スレッドに先に取られうるので、取れるまで拡張する
+      do {
+        growControlBlockPool(control_block_growth_chunk_size_);
+        handle = control_block_pool_.tryAcquireCreated();
+      } while (kConcurrentControlBlockPool && !handle.isValid());
     }
     if (!handle.isValid()) {
       ::orteaf::internal::diagnostics::error::throwError(
@@ -710,6 +898,34 @@ private:
     return handle;
   }
 
+  /**
+   * @brief out.size() 個の ControlBlock をまとめて取得
+   *
+   * 不足分は growth chunk 単位に切り上げて一度に拡張する。
+   *
+   * @throws OutOfRange grow後も揃わない場合（取得済みの分は返却する）
+   */
+  void acquireControlBlocks(std::span<ControlBlockHandle> out) {
+    std::size_t acquired = control_block_pool_.tryAcquireCreated(out);
+    if (acquired < out.size()) {
+      const std::size_t chunk = control_block_growth_chunk_size_ == 0
+                                    ? 1
+                                    : control_block_growth_chunk_size_;
+      do {
+        const std::size_t missing = out.size() - acquired;
+        growControlBlockPool((missing + chunk - 1) / chunk * chunk);
+        acquired += control_block_pool_.tryAcquireCreated(out.subspan(acquired));
+      } while (kConcurrentControlBlockPool && acquired < out.size());
+    }
+    if (acquired < out.size()) {
+      control_block_pool_.release(
+          std::span<const ControlBlockHandle>(out.data(), acquired));
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+          std::string(managerName()) + " has no available control blocks");
+    }
+  }
+
   // ===========================================================================
   // ControlBlock Access
   // ===========================================================================
@@ -749,18 +965,13 @@ private:
   // ===========================================================================
 
   /**
-   * @brief Lease取得の共通実装
+   * @brief handle を検証して payload ポインタを返す
    *
-   * @tparam LeaseType WeakLeaseType または StrongLeaseType
-   * @param handle Payload handle
-   * @return LeaseType
    * @throws InvalidArgument handleが無効な場合
    * @throws InvalidState payloadが利用不可の場合
    */
-  template <typename LeaseType>
-  LeaseType acquireLeaseImpl(PayloadHandle handle) {
-    ensureConfigured();
-
+  auto validatedPayloadPtr(PayloadHandle handle)
+      -> decltype(std::declval<PayloadPool &>().get(handle)) {
     // Validate handle
     if (!payload_pool_.isValid(handle)) {
       ::orteaf::internal::diagnostics::error::throwError(
@@ -779,6 +990,34 @@ private:
           ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidState,
           std::string(managerName()) + " payload pointer is null");
     }
+    return payload_ptr;
+  }
+
+  /**
+   * @brief payload に有効な CB が bind 済みか（Binding非対応Poolでは常に false）
+   */
+  bool hasLiveBoundControlBlock(PayloadHandle handle) noexcept {
+    if constexpr (pool::ControlBlockBindableConcept<PayloadPool>) {
+      return payload_pool_.hasBoundControlBlock(handle) &&
+             control_block_pool_.get(
+                 payload_pool_.getBoundControlBlock(handle)) != nullptr;
+    }
+    return false;
+  }
+
+  /**
+   * @brief Lease取得の共通実装
+   *
+   * @tparam LeaseType WeakLeaseType または StrongLeaseType
+   * @param handle Payload handle
+   * @return LeaseType
+   * @throws InvalidArgument handleが無効な場合
+   * @throws InvalidState payloadが利用不可の場合
+   */
+  template <typename LeaseType>
+  LeaseType acquireLeaseImpl(PayloadHandle handle) {
+    ensureConfigured();
+    auto *payload_ptr = validatedPayloadPtr(handle);
 
     // Check for existing bound CB (if pool supports binding)
     if constexpr (pool::ControlBlockBindableConcept<PayloadPool>) {
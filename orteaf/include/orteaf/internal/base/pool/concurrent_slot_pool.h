@@ -0,0 +1,867 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include "orteaf/internal/diagnostics/error/error.h"
+
+namespace orteaf::internal::base::pool {
+
+/**
+ * @brief SlotPool variant whose acquire/release paths are lock-free.
+ *
+ * ConcurrentSlotPool exposes the same API as SlotPool so it can be used as a
+ * payload pool or, through PoolManager traits, as the control-block pool of a
+ * manager shared by many threads. Differences from SlotPool:
+ *
+ * - Free slots live on two Treiber stacks (created / uncreated). The stack
+ *   head packs a 32-bit modification tag next to the slot index, so a slot
+ *   popped and pushed back while another thread is mid-pop cannot be
+ *   mistaken for the old head (ABA), independent of the Handle generation.
+ * - Each slot keeps a 32-bit generation; handles carry its low bits. The
+ *   freelist never relies on the (possibly 8-bit) handle generation.
+ * - Storage grows in geometrically sized segments that never move, so get()
+ *   and the acquire paths can run while another thread grows the pool.
+ *   Growth itself (resize/reserve/growByAndCreate/createRange) is serialized
+ *   by an internal mutex.
+ * - Slots added by resize() are published to the freelists on first
+ *   acquisition, so the resize + createRange pattern used by managers files
+ *   them as created. growByAndCreate does both in one step for concurrent
+ *   growth.
+ *
+ * Thread safety: tryAcquireCreated, tryReserveUncreated, release, get,
+ * isValid, isCreated and growByAndCreate may be called concurrently.
+ * emplace/destroy must only target slots the caller has acquired. clear,
+ * setBlockSize, forEachCreated and moves require external serialization.
+ *
+ * @tparam Traits Same policy type as SlotPool (Payload/Handle/Request/Context
+ *         and create/destroy hooks).
+ */
+template <typename Traits> class ConcurrentSlotPool {
+public:
+  using Payload = typename Traits::Payload;
+  using Handle = typename Traits::Handle;
+  using Request = typename Traits::Request;
+  using Context = typename Traits::Context;
+
+  static_assert(sizeof(typename Handle::index_type) <= sizeof(std::uint32_t),
+                "ConcurrentSlotPool packs slot indices into 32 bits");
+
+  ConcurrentSlotPool() = default;
+  ConcurrentSlotPool(const ConcurrentSlotPool &) = delete;
+  ConcurrentSlotPool &operator=(const ConcurrentSlotPool &) = delete;
+
+  ConcurrentSlotPool(ConcurrentSlotPool &&other) noexcept {
+    moveFrom(other);
+  }
+
+  ConcurrentSlotPool &operator=(ConcurrentSlotPool &&other) noexcept {
+    if (this != &other) {
+      releaseStorage();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  ~ConcurrentSlotPool() { releaseStorage(); }
+
+  /**
+   * @brief Sets the size of the first storage segment.
+   *
+   * Later segments double in size. Once storage is allocated the segment
+   * layout is fixed; a new block size takes effect after clear().
+   *
+   * @return The previous block size.
+   * @throws OrteafErrc::InvalidArgument if block_size is 0.
+   */
+  std::size_t setBlockSize(std::size_t block_size) {
+    if (block_size == 0) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidArgument,
+          "ConcurrentSlotPool block size must be > 0");
+    }
+    const std::size_t old_block_size = block_size_;
+    block_size_ = block_size;
+    return old_block_size;
+  }
+
+  std::size_t size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+  /**
+   * @brief Returns the number of slots backed by allocated segments.
+   */
+  std::size_t capacity() const noexcept {
+    return segmentStart(segment_count_.load(std::memory_order_acquire));
+  }
+  std::size_t blockSize() const noexcept { return block_size_; }
+  /**
+   * @brief Returns the number of free slots (approximate under concurrency).
+   */
+  std::size_t available() const noexcept {
+    return created_free_.size() + uncreated_free_.size() +
+           pending_count_.load(std::memory_order_acquire);
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+  void reserve(std::size_t new_capacity) {
+    std::lock_guard<std::mutex> lock(growth_mutex_);
+    checkIndexRange(new_capacity, "ConcurrentSlotPool capacity exceeds "
+                                  "handle range");
+    ensureSegments(new_capacity);
+  }
+
+  /**
+   * @brief Grows the pool to new_size slots; new slots start uncreated.
+   *
+   * @return The previous size.
+   * @throws OrteafErrc::InvalidArgument if new_size is smaller than current.
+   */
+  std::size_t resize(std::size_t new_size) {
+    std::lock_guard<std::mutex> lock(growth_mutex_);
+    const std::size_t old_size = size();
+    if (new_size < old_size) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidArgument,
+          "ConcurrentSlotPool size cannot shrink without shutdown");
+    }
+    growLocked(new_size);
+    return old_size;
+  }
+
+  /**
+   * @brief Adds grow_by uncreated slots; unlike resize, safe to race with
+   *        other growth since each call extends whatever size it finds.
+   *
+   * @return The size before this call's slots were added.
+   */
+  std::size_t growBy(std::size_t grow_by) {
+    std::lock_guard<std::mutex> lock(growth_mutex_);
+    const std::size_t old_size = size();
+    growLocked(old_size + grow_by);
+    return old_size;
+  }
+
+  /**
+   * @brief Atomically adds grow_by slots, creates them and makes them
+   *        acquirable as created slots.
+   *
+   * Safe to call from several threads at once; each call gets its own range.
+   *
+   * @return True if every new payload was created.
+   */
+  bool growByAndCreate(std::size_t grow_by, const Request &request,
+                       const Context &context) {
+    std::lock_guard<std::mutex> lock(growth_mutex_);
+    publishPendingLocked();
+    const std::size_t old_size = size();
+    growLocked(old_size + grow_by);
+    const bool created = createRangeLocked(old_size, old_size + grow_by,
+                                           request, context);
+    publishPendingLocked();
+    return created;
+  }
+
+  /**
+   * @brief Destroys all created payloads and releases storage.
+   */
+  void clear(const Request &request = {},
+             const Context &context = {}) noexcept {
+    const std::size_t count = size();
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      Slot &slot = slotAt(idx);
+      if (slot.created.load(std::memory_order_relaxed) != 0) {
+        Traits::destroy(slot.payload, request, context);
+        slot.created.store(0, std::memory_order_relaxed);
+      }
+    }
+    releaseStorage();
+  }
+
+  bool createAll(const Request &request, const Context &context) {
+    return createRange(0, size(), request, context);
+  }
+
+  /**
+   * @brief Creates payloads for a slot range [start, end).
+   *
+   * @throws OrteafErrc::InvalidArgument if range is invalid.
+   */
+  bool createRange(std::size_t start, std::size_t end, const Request &request,
+                   const Context &context) {
+    std::lock_guard<std::mutex> lock(growth_mutex_);
+    return createRangeLocked(start, end, request, context);
+  }
+
+  Handle acquireCreated() {
+    Handle handle = tryAcquireCreated();
+    if (!handle.isValid()) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+          "ConcurrentSlotPool is empty");
+    }
+    return handle;
+  }
+
+  /**
+   * @brief Pops a created free slot (lock-free once pending slots are
+   *        published).
+   */
+  Handle tryAcquireCreated() noexcept {
+    publishPending();
+    for (;;) {
+      const std::uint32_t idx = created_free_.pop(*this);
+      if (idx == kNil) {
+        return takeMisfiledCreated();
+      }
+      Slot &slot = slotAt(idx);
+      if (slot.created.load(std::memory_order_acquire) != 0) {
+        return makeHandle(idx);
+      }
+      // Destroyed while free; refile and keep looking.
+      uncreated_free_.push(*this, idx);
+    }
+  }
+
+  /**
+   * @brief Acquires up to out.size() created slots.
+   *
+   * @return Number of handles written to the front of out.
+   */
+  std::size_t tryAcquireCreated(std::span<Handle> out) noexcept {
+    std::size_t count = 0;
+    while (count < out.size()) {
+      const Handle handle = tryAcquireCreated();
+      if (!handle.isValid()) {
+        break;
+      }
+      out[count++] = handle;
+    }
+    return count;
+  }
+
+  Handle reserveUncreated() {
+    Handle handle = tryReserveUncreated();
+    if (!handle.isValid()) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+          "ConcurrentSlotPool is empty");
+    }
+    return handle;
+  }
+
+  /**
+   * @brief Pops an uncreated free slot (lock-free once pending slots are
+   *        published).
+   */
+  Handle tryReserveUncreated() noexcept {
+    publishPending();
+    for (;;) {
+      const std::uint32_t idx = uncreated_free_.pop(*this);
+      if (idx == kNil) {
+        return Handle::invalid();
+      }
+      Slot &slot = slotAt(idx);
+      if (slot.created.load(std::memory_order_acquire) == 0) {
+        return makeHandle(idx);
+      }
+      // Created in place while free; refile and keep looking.
+      misfiled_created_.fetch_sub(1, std::memory_order_relaxed);
+      created_free_.push(*this, idx);
+    }
+  }
+
+  bool release(Handle handle) noexcept {
+    if constexpr (destroy_on_release_) {
+      static_assert(std::is_default_constructible_v<Request>,
+                    "ConcurrentSlotPool::release(handle) requires "
+                    "default-constructible Request when destroy_on_release "
+                    "is enabled");
+      static_assert(std::is_default_constructible_v<Context>,
+                    "ConcurrentSlotPool::release(handle) requires "
+                    "default-constructible Context when destroy_on_release "
+                    "is enabled");
+      return release(handle, Request{}, Context{});
+    }
+    return releaseImpl(handle);
+  }
+
+  bool release(Handle handle, const Request &request,
+               const Context &context) noexcept {
+    if (!isValid(handle)) {
+      return false;
+    }
+    if constexpr (destroy_on_release_) {
+      if (!isCreated(handle)) {
+        return false;
+      }
+      if (!destroy(handle, request, context)) {
+        return false;
+      }
+    }
+    return releaseImpl(handle);
+  }
+
+  /**
+   * @brief Releases a batch of slots.
+   *
+   * Each handle is claimed individually, then the released slots are linked
+   * locally and spliced onto each freelist with a single CAS.
+   *
+   * @return Number of handles actually released.
+   */
+  std::size_t release(std::span<const Handle> handles) noexcept {
+    std::size_t released = 0;
+    if constexpr (destroy_on_release_) {
+      for (const Handle &handle : handles) {
+        if (release(handle)) {
+          ++released;
+        }
+      }
+      return released;
+    }
+    Chain created{};
+    Chain uncreated{};
+    for (const Handle &handle : handles) {
+      if (!claimRelease(handle)) {
+        continue;
+      }
+      const auto idx = static_cast<std::uint32_t>(handle.index);
+      if (slotAt(idx).created.load(std::memory_order_acquire) != 0) {
+        created.link(*this, idx);
+      } else {
+        uncreated.link(*this, idx);
+      }
+      ++released;
+    }
+    created_free_.pushChain(*this, created);
+    uncreated_free_.pushChain(*this, uncreated);
+    return released;
+  }
+
+  Payload *get(Handle handle) noexcept {
+    if (!isValid(handle)) {
+      return nullptr;
+    }
+    return &slotAt(static_cast<std::size_t>(handle.index)).payload;
+  }
+
+  const Payload *get(Handle handle) const noexcept {
+    if (!isValid(handle)) {
+      return nullptr;
+    }
+    return &slotAt(static_cast<std::size_t>(handle.index)).payload;
+  }
+
+  template <typename Func>
+    requires std::invocable<Func, std::size_t, const Payload &>
+  void forEachCreated(Func &&func) const {
+    const std::size_t count = size();
+    for (std::size_t idx = 0; idx < count; ++idx) {
+      const Slot &slot = slotAt(idx);
+      if (slot.created.load(std::memory_order_acquire) != 0) {
+        std::forward<Func>(func)(idx, slot.payload);
+      }
+    }
+  }
+
+  bool isValid(Handle handle) const noexcept {
+    const auto idx = static_cast<std::size_t>(handle.index);
+    if (idx >= size()) {
+      return false;
+    }
+    if constexpr (Handle::has_generation) {
+      return handle.generation ==
+             static_cast<typename Handle::generation_type>(
+                 slotAt(idx).generation.load(std::memory_order_acquire));
+    }
+    return true;
+  }
+
+  bool isCreated(Handle handle) const noexcept {
+    if (!isValid(handle)) {
+      return false;
+    }
+    return slotAt(static_cast<std::size_t>(handle.index))
+               .created.load(std::memory_order_acquire) != 0;
+  }
+
+  bool emplace(Handle handle, const Request &request, const Context &context) {
+    if (!isValid(handle) || isCreated(handle)) {
+      return false;
+    }
+    Slot &slot = slotAt(static_cast<std::size_t>(handle.index));
+    const bool created = Traits::create(slot.payload, request, context);
+    if (created) {
+      setCreated(static_cast<std::size_t>(handle.index), true);
+    }
+    return created;
+  }
+
+  template <typename CreateFn>
+    requires std::invocable<CreateFn, Payload &, const Request &,
+                            const Context &> &&
+             std::convertible_to<
+                 std::invoke_result_t<CreateFn, Payload &, const Request &,
+                                      const Context &>,
+                 bool>
+  bool emplace(Handle handle, const Request &request, const Context &context,
+               CreateFn &&createFn) {
+    if (!isValid(handle) || isCreated(handle)) {
+      return false;
+    }
+    Slot &slot = slotAt(static_cast<std::size_t>(handle.index));
+    const bool created =
+        std::forward<CreateFn>(createFn)(slot.payload, request, context);
+    if (created) {
+      setCreated(static_cast<std::size_t>(handle.index), true);
+    }
+    return created;
+  }
+
+  bool destroy(Handle handle, const Request &request, const Context &context) {
+    if (!isValid(handle) || !isCreated(handle)) {
+      return false;
+    }
+    Slot &slot = slotAt(static_cast<std::size_t>(handle.index));
+    Traits::destroy(slot.payload, request, context);
+    setCreated(static_cast<std::size_t>(handle.index), false);
+    return true;
+  }
+
+  template <typename DestroyFn>
+    requires std::invocable<DestroyFn, Payload &, const Request &,
+                            const Context &>
+  bool destroy(Handle handle, const Request &request, const Context &context,
+               DestroyFn &&destroyFn) {
+    if (!isValid(handle) || !isCreated(handle)) {
+      return false;
+    }
+    Slot &slot = slotAt(static_cast<std::size_t>(handle.index));
+    if constexpr (std::convertible_to<
+                      std::invoke_result_t<DestroyFn, Payload &,
+                                           const Request &, const Context &>,
+                      bool>) {
+      if (!std::forward<DestroyFn>(destroyFn)(slot.payload, request,
+                                              context)) {
+        return false;
+      }
+    } else {
+      std::forward<DestroyFn>(destroyFn)(slot.payload, request, context);
+    }
+    setCreated(static_cast<std::size_t>(handle.index), false);
+    return true;
+  }
+
+private:
+  using index_type = typename Handle::index_type;
+
+  static constexpr std::uint32_t kNil = 0xFFFFFFFFu;
+  // 32 doubling segments cover the whole 32-bit index space for any block size.
+  static constexpr std::size_t kMaxSegments = 32;
+
+  static constexpr bool destroy_on_release_ = [] {
+    if constexpr (requires { Traits::destroy_on_release; }) {
+      return static_cast<bool>(Traits::destroy_on_release);
+    }
+    return false;
+  }();
+
+  struct Slot {
+    Payload payload{};
+    std::atomic<std::uint32_t> generation{0};
+    std::atomic<std::uint32_t> next{kNil};
+    std::atomic<std::uint8_t> created{0};
+    // Set while the slot sits on a freelist (or is pending publication).
+    std::atomic<std::uint8_t> free{0};
+  };
+
+  // Slots linked through Slot::next before being spliced onto a FreeStack.
+  struct Chain {
+    std::uint32_t head{kNil};
+    std::uint32_t tail{kNil};
+    std::size_t count{0};
+
+    void link(ConcurrentSlotPool &pool, std::uint32_t idx) noexcept {
+      Slot &slot = pool.slotAt(idx);
+      slot.free.store(1, std::memory_order_relaxed);
+      slot.next.store(head, std::memory_order_relaxed);
+      if (tail == kNil) {
+        tail = idx;
+      }
+      head = idx;
+      ++count;
+    }
+  };
+
+  /**
+   * @brief Treiber stack of slot indices with a tagged head.
+   */
+  class FreeStack {
+  public:
+    void push(ConcurrentSlotPool &pool, std::uint32_t idx) noexcept {
+      Slot &slot = pool.slotAt(idx);
+      slot.free.store(1, std::memory_order_relaxed);
+      std::uint64_t head = head_.load(std::memory_order_relaxed);
+      for (;;) {
+        slot.next.store(indexOf(head), std::memory_order_relaxed);
+        if (head_.compare_exchange_weak(head, pack(tagOf(head) + 1, idx),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void pushChain(ConcurrentSlotPool &pool, const Chain &chain) noexcept {
+      if (chain.count == 0) {
+        return;
+      }
+      Slot &tail = pool.slotAt(chain.tail);
+      std::uint64_t head = head_.load(std::memory_order_relaxed);
+      for (;;) {
+        tail.next.store(indexOf(head), std::memory_order_relaxed);
+        if (head_.compare_exchange_weak(head,
+                                        pack(tagOf(head) + 1, chain.head),
+                                        std::memory_order_release,
+                                        std::memory_order_relaxed)) {
+          break;
+        }
+      }
+      size_.fetch_add(chain.count, std::memory_order_relaxed);
+    }
+
+    std::uint32_t pop(ConcurrentSlotPool &pool) noexcept {
+      std::uint64_t head = head_.load(std::memory_order_acquire);
+      for (;;) {
+        const std::uint32_t idx = indexOf(head);
+        if (idx == kNil) {
+          return kNil;
+        }
+        // next may be stale if idx was popped and re-pushed meanwhile; the
+        // tag then differs and the CAS fails.
+        const std::uint32_t next =
+            pool.slotAt(idx).next.load(std::memory_order_relaxed);
+        if (head_.compare_exchange_weak(head, pack(tagOf(head) + 1, next),
+                                        std::memory_order_acquire,
+                                        std::memory_order_acquire)) {
+          pool.slotAt(idx).free.store(0, std::memory_order_relaxed);
+          size_.fetch_sub(1, std::memory_order_relaxed);
+          return idx;
+        }
+      }
+    }
+
+    std::size_t size() const noexcept {
+      const auto count = static_cast<std::ptrdiff_t>(
+          size_.load(std::memory_order_relaxed));
+      return count < 0 ? 0 : static_cast<std::size_t>(count);
+    }
+
+    void reset() noexcept {
+      head_.store(pack(0, kNil), std::memory_order_relaxed);
+      size_.store(0, std::memory_order_relaxed);
+    }
+
+    void moveFrom(FreeStack &other) noexcept {
+      head_.store(other.head_.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+      size_.store(other.size_.load(std::memory_order_relaxed),
+                  std::memory_order_relaxed);
+      other.reset();
+    }
+
+  private:
+    static constexpr std::uint64_t pack(std::uint32_t tag,
+                                        std::uint32_t idx) noexcept {
+      return (static_cast<std::uint64_t>(tag) << 32) | idx;
+    }
+    static constexpr std::uint32_t indexOf(std::uint64_t head) noexcept {
+      return static_cast<std::uint32_t>(head);
+    }
+    static constexpr std::uint32_t tagOf(std::uint64_t head) noexcept {
+      return static_cast<std::uint32_t>(head >> 32);
+    }
+
+    std::atomic<std::uint64_t> head_{pack(0, kNil)};
+    // Popped before the matching push is counted, so it may dip below zero.
+    std::atomic<std::size_t> size_{0};
+  };
+
+  // Segment k holds base << k slots and starts at base * (2^k - 1).
+  std::size_t segmentStart(std::size_t segment) const noexcept {
+    return segment_base_.load(std::memory_order_relaxed) *
+           ((std::size_t{1} << segment) - 1);
+  }
+
+  Slot &slotAt(std::size_t idx) const noexcept {
+    const std::size_t base = segment_base_.load(std::memory_order_relaxed);
+    const std::size_t segment =
+        static_cast<std::size_t>(std::bit_width(idx / base + 1)) - 1;
+    Slot *slots = segments_[segment].load(std::memory_order_acquire);
+    return slots[idx - base * ((std::size_t{1} << segment) - 1)];
+  }
+
+  static void checkIndexRange(std::size_t count, const char *message) {
+    if (count > static_cast<std::size_t>(Handle::invalid_index()) ||
+        count >= static_cast<std::size_t>(kNil)) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidArgument,
+          message);
+    }
+  }
+
+  // Allocates segments until at least required slots are backed.
+  void ensureSegments(std::size_t required) {
+    if (required == 0) {
+      return;
+    }
+    std::size_t count = segment_count_.load(std::memory_order_relaxed);
+    if (count == 0) {
+      segment_base_.store(block_size_, std::memory_order_relaxed);
+    }
+    while (segmentStart(count) < required) {
+      const std::size_t slots =
+          segment_base_.load(std::memory_order_relaxed) << count;
+      segments_[count].store(new Slot[slots], std::memory_order_release);
+      ++count;
+      segment_count_.store(count, std::memory_order_release);
+    }
+  }
+
+  void growLocked(std::size_t new_size) {
+    const std::size_t old_size = size();
+    if (new_size == old_size) {
+      return;
+    }
+    checkIndexRange(new_size, "ConcurrentSlotPool size exceeds handle range");
+    ensureSegments(new_size);
+    for (std::size_t idx = old_size; idx < new_size; ++idx) {
+      slotAt(idx).free.store(1, std::memory_order_relaxed);
+    }
+    // Pending slots are contiguous: pending_end_ always equals the old size.
+    if (pending_count_.load(std::memory_order_relaxed) == 0) {
+      pending_begin_ = old_size;
+    }
+    pending_count_.store(new_size - pending_begin_, std::memory_order_release);
+    size_.store(new_size, std::memory_order_release);
+  }
+
+  bool createRangeLocked(std::size_t start, std::size_t end,
+                         const Request &request, const Context &context) {
+    if (start > end || end > size()) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidArgument,
+          "ConcurrentSlotPool create range is out of bounds");
+    }
+    bool all_created = true;
+    for (std::size_t idx = start; idx < end; ++idx) {
+      const Handle handle = makeHandle(static_cast<std::uint32_t>(idx));
+      Request slot_request = request;
+      if constexpr (requires { slot_request.handle = handle; }) {
+        slot_request.handle = handle;
+      }
+      if (!emplace(handle, slot_request, context)) {
+        all_created = false;
+      }
+    }
+    return all_created;
+  }
+
+  void publishPending() noexcept {
+    if (pending_count_.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(growth_mutex_);
+    publishPendingLocked();
+  }
+
+  // Pushes pending slots highest index first so the lowest pops first, as
+  // with SlotPool.
+  void publishPendingLocked() noexcept {
+    const std::size_t count = pending_count_.load(std::memory_order_relaxed);
+    if (count == 0) {
+      return;
+    }
+    for (std::size_t i = pending_begin_ + count; i > pending_begin_; --i) {
+      const auto idx = static_cast<std::uint32_t>(i - 1);
+      if (slotAt(idx).created.load(std::memory_order_relaxed) != 0) {
+        created_free_.push(*this, idx);
+      } else {
+        uncreated_free_.push(*this, idx);
+      }
+    }
+    pending_count_.store(0, std::memory_order_release);
+  }
+
+  // Slow path for created slots filed on the uncreated stack (created in
+  // place while free). Pops uncreated slots onto a private chain until one
+  // is created, then pushes the rest back.
+  Handle takeMisfiledCreated() noexcept {
+    if (misfiled_created_.load(std::memory_order_relaxed) <= 0) {
+      return Handle::invalid();
+    }
+    std::uint32_t chain = kNil;
+    std::uint32_t found = kNil;
+    for (;;) {
+      const std::uint32_t idx = uncreated_free_.pop(*this);
+      if (idx == kNil) {
+        break;
+      }
+      if (slotAt(idx).created.load(std::memory_order_acquire) != 0) {
+        misfiled_created_.fetch_sub(1, std::memory_order_relaxed);
+        found = idx;
+        break;
+      }
+      slotAt(idx).next.store(chain, std::memory_order_relaxed);
+      chain = idx;
+    }
+    while (chain != kNil) {
+      const std::uint32_t next = slotAt(chain).next.load(
+          std::memory_order_relaxed);
+      uncreated_free_.push(*this, chain);
+      chain = next;
+    }
+    if (found == kNil) {
+      // The count is a hint; a racing reserve may already have taken the slot.
+      misfiled_created_.store(0, std::memory_order_relaxed);
+      return Handle::invalid();
+    }
+    return makeHandle(found);
+  }
+
+  void setCreated(std::size_t idx, bool created) noexcept {
+    Slot &slot = slotAt(idx);
+    const std::uint8_t flag = created ? 1 : 0;
+    if (slot.created.exchange(flag, std::memory_order_acq_rel) == flag) {
+      return;
+    }
+    if (!created || slot.free.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    // A published free slot created in place stays on the uncreated stack
+    // until a pop refiles it; count it so tryAcquireCreated knows to look
+    // there. Free slots are only created by createRangeLocked, which holds
+    // growth_mutex_, so pending_begin_ is safe to read here.
+    const std::size_t pending = pending_count_.load(std::memory_order_relaxed);
+    const bool is_pending =
+        idx >= pending_begin_ && idx < pending_begin_ + pending;
+    if (!is_pending) {
+      misfiled_created_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Claims the release by bumping the generation; a concurrent second
+  // release of the same handle then fails validation.
+  bool claimRelease(Handle handle) noexcept {
+    const auto idx = static_cast<std::size_t>(handle.index);
+    if (idx >= size()) {
+      return false;
+    }
+    if constexpr (Handle::has_generation) {
+      Slot &slot = slotAt(idx);
+      std::uint32_t generation =
+          slot.generation.load(std::memory_order_acquire);
+      do {
+        if (static_cast<typename Handle::generation_type>(generation) !=
+            handle.generation) {
+          return false;
+        }
+      } while (!slot.generation.compare_exchange_weak(
+          generation, generation + 1, std::memory_order_acq_rel,
+          std::memory_order_acquire));
+    }
+    return true;
+  }
+
+  bool releaseImpl(Handle handle) noexcept {
+    if (!claimRelease(handle)) {
+      return false;
+    }
+    const auto index = static_cast<std::uint32_t>(handle.index);
+    if (slotAt(index).created.load(std::memory_order_acquire) != 0) {
+      created_free_.push(*this, index);
+    } else {
+      uncreated_free_.push(*this, index);
+    }
+    return true;
+  }
+
+  Handle makeHandle(std::uint32_t idx) const noexcept {
+    if constexpr (Handle::has_generation) {
+      return Handle{static_cast<index_type>(idx),
+                    static_cast<typename Handle::generation_type>(
+                        slotAt(idx).generation.load(
+                            std::memory_order_acquire))};
+    }
+    return Handle{static_cast<index_type>(idx)};
+  }
+
+  void releaseStorage() noexcept {
+    const std::size_t count = segment_count_.load(std::memory_order_relaxed);
+    for (std::size_t segment = 0; segment < count; ++segment) {
+      delete[] segments_[segment].load(std::memory_order_relaxed);
+      segments_[segment].store(nullptr, std::memory_order_relaxed);
+    }
+    segment_count_.store(0, std::memory_order_relaxed);
+    segment_base_.store(block_size_, std::memory_order_relaxed);
+    size_.store(0, std::memory_order_relaxed);
+    pending_begin_ = 0;
+    pending_count_.store(0, std::memory_order_relaxed);
+    misfiled_created_.store(0, std::memory_order_relaxed);
+    created_free_.reset();
+    uncreated_free_.reset();
+  }
+
+  // Not thread-safe. Slot indices are unchanged, so the stacks move as is.
+  void moveFrom(ConcurrentSlotPool &other) noexcept {
+    block_size_ = other.block_size_;
+    const std::size_t count =
+        other.segment_count_.load(std::memory_order_relaxed);
+    for (std::size_t segment = 0; segment < count; ++segment) {
+      segments_[segment].store(
+          other.segments_[segment].load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+    segment_count_.store(count, std::memory_order_relaxed);
+    segment_base_.store(other.segment_base_.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+    size_.store(other.size(), std::memory_order_relaxed);
+    pending_begin_ = other.pending_begin_;
+    pending_count_.store(other.pending_count_.load(std::memory_order_relaxed),
+                         std::memory_order_relaxed);
+    misfiled_created_.store(
+        other.misfiled_created_.load(std::memory_order_relaxed),
+        std::memory_order_relaxed);
+    created_free_.moveFrom(other.created_free_);
+    uncreated_free_.moveFrom(other.uncreated_free_);
+    // Storage now belongs to this pool; reset other without freeing it.
+    other.segment_count_.store(0, std::memory_order_relaxed);
+    other.releaseStorage();
+  }
+
+  std::size_t block_size_{64};
+  std::array<std::atomic<Slot *>, kMaxSegments> segments_{};
+  std::atomic<std::size_t> segment_count_{0};
+  std::atomic<std::size_t> segment_base_{64};
+  std::atomic<std::size_t> size_{0};
+  // Slots [pending_begin_, pending_begin_ + pending_count_) were added by
+  // growth and are not on a freelist yet (pending_begin_ is guarded by
+  // growth_mutex_).
+  std::size_t pending_begin_{0};
+  std::atomic<std::size_t> pending_count_{0};
+  std::atomic<std::ptrdiff_t> misfiled_created_{0};
+  FreeStack created_free_{};
+  FreeStack uncreated_free_{};
+  std::mutex growth_mutex_{};
+};
+
+} // namespace orteaf::internal::base::pool
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -16,7 +17,9 @@ namespace orteaf::internal::base::pool {
  *
  * SlotPool stores a contiguous array of Payload objects. Acquisition returns a
  * SlotRef containing a handle and a pointer to the payload storage. Released
- * slots are pushed back to a freelist and can be reacquired later. If the
+ * slots are pushed back to a freelist and can be reacquired later. Free slots
+ * are kept on two freelists split by created state, so acquiring a created
+ * slot or reserving an uncreated one is O(1) however the two are mixed. If the
  * handle type supports generation tracking (Handle::has_generation), releases
  * bump the generation to invalidate stale handles.
  *
@@ -73,7 +76,9 @@ public:
   /**
    * @brief Returns the number of slots currently available in the freelist.
    */
-  std::size_t available() const noexcept { return freelist_.size(); }
+  std::size_t available() const noexcept {
+    return created_free_.size() + uncreated_free_.size();
+  }
   /**
    * @brief Returns true if the pool has no slots.
    */
@@ -114,7 +119,9 @@ public:
     payloads_.clear();
     generations_.clear();
     created_.clear();
-    freelist_.clear();
+    free_pos_.clear();
+    created_free_.clear();
+    uncreated_free_.clear();
   }
 
   /**
@@ -182,20 +189,26 @@ public:
    *
    * @return Valid Handle if successful, invalid Handle otherwise.
    */
-  Handle tryAcquireCreated() noexcept {
-    if (freelist_.empty()) {
-      return Handle::invalid();
-    }
-    const std::size_t scan_count = freelist_.size();
-    for (std::size_t i = 0; i < scan_count; ++i) {
-      const index_type idx = freelist_.back();
-      freelist_.resize(freelist_.size() - 1);
-      if (created_[static_cast<std::size_t>(idx)] != 0) {
-        return makeHandle(idx);
-      }
-      freelist_.pushBack(idx);
-    }
-    return Handle::invalid();
+  Handle tryAcquireCreated() noexcept { return popFree(created_free_); }
+
+  /**
+   * @brief Acquires up to out.size() created slots in a single freelist pass.
+   *
+   * @param out Destination for the acquired handles.
+   * @return Number of handles written to the front of out.
+   */
+  std::size_t tryAcquireCreated(std::span<Handle> out) noexcept {
+    const std::size_t count = out.size() < created_free_.size()
+                                  ? out.size()
+                                  : created_free_.size();
+    const std::size_t top = created_free_.size();
+    for (std::size_t i = 0; i < count; ++i) {
+      const index_type idx = created_free_[top - 1 - i];
+      free_pos_[static_cast<std::size_t>(idx)] = kNotFree;
+      out[i] = makeHandle(idx);
+    }
+    created_free_.resize(top - count);
+    return count;
   }
 
   /**
@@ -222,21 +235,7 @@ public:
    *
    * @return Valid Handle if successful, invalid Handle otherwise.
    */
-  Handle tryReserveUncreated() noexcept {
-    if (freelist_.empty()) {
-      return Handle::invalid();
-    }
-    const std::size_t scan_count = freelist_.size();
-    for (std::size_t i = 0; i < scan_count; ++i) {
-      const index_type idx = freelist_.back();
-      freelist_.resize(freelist_.size() - 1);
-      if (created_[static_cast<std::size_t>(idx)] == 0) {
-        return makeHandle(idx);
-      }
-      freelist_.pushBack(idx);
-    }
-    return Handle::invalid();
-  }
+  Handle tryReserveUncreated() noexcept { return popFree(uncreated_free_); }
 
   /**
    * @brief Releases a slot back to the freelist.
@@ -288,6 +287,24 @@ public:
     return releaseImpl(handle);
   }
 
+  /**
+   * @brief Releases a batch of slots.
+   *
+   * Equivalent to calling release(handle) for each element; invalid or stale
+   * handles are skipped.
+   *
+   * @return Number of handles actually released.
+   */
+  std::size_t release(std::span<const Handle> handles) noexcept {
+    std::size_t released = 0;
+    for (const Handle &handle : handles) {
+      if (release(handle)) {
+        ++released;
+      }
+    }
+    return released;
+  }
+
   /**
    * @brief Returns a pointer to the payload storage if the handle is valid.
    *
@@ -461,6 +478,9 @@ private:
   using generation_storage_t =
       std::conditional_t<Handle::has_generation,
                          typename Handle::generation_type, std::uint8_t>;
+  // free_pos_ value of a slot that is not on a freelist. The slot count is
+  // capped below Handle::invalid_index, so it is never a real position.
+  static constexpr index_type kNotFree = Handle::invalid_index();
   static constexpr bool destroy_on_release_ = [] {
     if constexpr (requires { Traits::destroy_on_release; }) {
       return static_cast<bool>(Traits::destroy_on_release);
@@ -496,7 +516,9 @@ private:
     payloads_.reserve(new_capacity);
     generations_.reserve(new_capacity);
     created_.reserve(new_capacity);
-    freelist_.reserve(new_capacity);
+    free_pos_.reserve(new_capacity);
+    created_free_.reserve(new_capacity);
+    uncreated_free_.reserve(new_capacity);
   }
 
   std::size_t resizeStorage(std::size_t new_size) {
@@ -517,9 +539,11 @@ private:
     payloads_.resize(new_size);
     generations_.resize(new_size, 0);
     created_.resize(new_size, 0);
-    freelist_.reserve(new_size);
+    free_pos_.resize(new_size, kNotFree);
+    created_free_.reserve(new_size);
+    uncreated_free_.reserve(new_size);
     for (std::size_t i = new_size; i > old_size; --i) {
-      freelist_.pushBack(static_cast<index_type>(i - 1));
+      pushFree(uncreated_free_, static_cast<index_type>(i - 1));
     }
     return old_size;
   }
@@ -532,7 +556,8 @@ private:
     if constexpr (Handle::has_generation) {
       ++generations_[idx];
     }
-    freelist_.pushBack(static_cast<index_type>(idx));
+    pushFree(created_[idx] != 0 ? created_free_ : uncreated_free_,
+             static_cast<index_type>(idx));
     return true;
   }
 
@@ -540,7 +565,48 @@ private:
     if (!isValid(handle)) {
       return;
     }
-    created_[static_cast<std::size_t>(handle.index)] = created ? 1 : 0;
+    const std::size_t idx = static_cast<std::size_t>(handle.index);
+    const std::uint8_t flag = created ? 1 : 0;
+    if (created_[idx] == flag) {
+      return;
+    }
+    created_[idx] = flag;
+    // A free slot created or destroyed in place (e.g. createRange after
+    // resize) moves to the freelist matching its new state.
+    if (free_pos_[idx] != kNotFree) {
+      removeFree(created ? uncreated_free_ : created_free_, idx);
+      pushFree(created ? created_free_ : uncreated_free_,
+               static_cast<index_type>(idx));
+    }
+  }
+
+  using FreeList = ::orteaf::internal::base::HeapVector<index_type>;
+
+  // Freelists are reserved to the slot count, so pushes never reallocate.
+  void pushFree(FreeList &list, index_type idx) noexcept {
+    free_pos_[static_cast<std::size_t>(idx)] =
+        static_cast<index_type>(list.size());
+    list.pushBack(idx);
+  }
+
+  Handle popFree(FreeList &list) noexcept {
+    if (list.empty()) {
+      return Handle::invalid();
+    }
+    const index_type idx = list.back();
+    list.resize(list.size() - 1);
+    free_pos_[static_cast<std::size_t>(idx)] = kNotFree;
+    return makeHandle(idx);
+  }
+
+  // Swap-removes idx from list; the last entry takes over its position.
+  void removeFree(FreeList &list, std::size_t idx) noexcept {
+    const std::size_t pos = static_cast<std::size_t>(free_pos_[idx]);
+    const index_type last = list.back();
+    list[pos] = last;
+    free_pos_[static_cast<std::size_t>(last)] = static_cast<index_type>(pos);
+    list.resize(list.size() - 1);
+    free_pos_[idx] = kNotFree;
   }
 
   Handle makeHandle(index_type idx) const noexcept {
@@ -553,7 +619,10 @@ private:
   ::orteaf::internal::base::RuntimeBlockVector<Payload> payloads_{};
   ::orteaf::internal::base::HeapVector<generation_storage_t> generations_{};
   ::orteaf::internal::base::HeapVector<std::uint8_t> created_{};
-  ::orteaf::internal::base::HeapVector<index_type> freelist_{};
+  // Position of each free slot within its freelist (kNotFree when acquired).
+  ::orteaf::internal::base::HeapVector<index_type> free_pos_{};
+  FreeList created_free_{};
+  FreeList uncreated_free_{};
 };
 
 } // namespace orteaf::internal::base::pool
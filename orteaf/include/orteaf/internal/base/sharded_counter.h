@@ -0,0 +1,244 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "orteaf/internal/base/math_utils.h"
+
+namespace orteaf::internal::base {
+
+/**
+ * @brief Upper bound for the number of shards picked by defaultShardCount().
+ */
+inline constexpr std::size_t kMaxCounterShards = 64;
+
+/**
+ * @brief Per-thread seed used to pick a shard; assigned round-robin on first use.
+ *
+ * Consecutive threads land on different shards, so up to shard-count threads
+ * never share a cache line when updating a sharded counter.
+ */
+inline std::size_t threadShardSeed() noexcept {
+    static std::atomic<std::size_t> next_seed{0};
+    thread_local const std::size_t seed = next_seed.fetch_add(1, std::memory_order_relaxed);
+    return seed;
+}
+
+/**
+ * @brief Hardware concurrency rounded up to a power of two, capped at kMaxCounterShards.
+ */
+inline std::size_t defaultShardCount() noexcept {
+    const unsigned hardware = std::thread::hardware_concurrency();
+    const std::size_t shards = nextPowerOfTwo(hardware == 0 ? 1 : hardware);
+    return shards > kMaxCounterShards ? kMaxCounterShards : shards;
+}
+
+/**
+ * @brief A fixed number of uint64 counters split into cache-line sized shards.
+ *
+ * Writers only touch the shard of the calling thread, so concurrent updates
+ * do not bounce a shared cache line; reads sum every shard. Arithmetic is
+ * modular, so a shard may go "negative" when another thread undoes its update
+ * and the sum is still exact once writers are quiescent (while writers are
+ * running a read is a consistent-enough snapshot for statistics).
+ *
+ * A moved-from instance has no shards: updates are ignored and reads return 0.
+ *
+ * @tparam Slots Number of independent counters kept in each shard.
+ */
+template <std::size_t Slots>
+class ShardedCounters {
+    static_assert(Slots > 0, "ShardedCounters needs at least one slot");
+
+public:
+    explicit ShardedCounters(std::size_t shard_count = defaultShardCount())
+        : shard_count_(nextPowerOfTwo(shard_count)),
+          shards_(std::make_unique<Shard[]>(shard_count_)) {}
+
+    ShardedCounters(const ShardedCounters&) = delete;
+    ShardedCounters& operator=(const ShardedCounters&) = delete;
+
+    ShardedCounters(ShardedCounters&& other) noexcept
+        : shard_count_(other.shard_count_), shards_(std::move(other.shards_)) {
+        other.shard_count_ = 0;
+    }
+
+    ShardedCounters& operator=(ShardedCounters&& other) noexcept {
+        if (this != &other) {
+            shard_count_ = other.shard_count_;
+            shards_ = std::move(other.shards_);
+            other.shard_count_ = 0;
+        }
+        return *this;
+    }
+
+    ~ShardedCounters() = default;
+
+    std::size_t shardCount() const noexcept { return shard_count_; }
+
+    /**
+     * @brief Adds @p value to @p slot; returns the new value of the caller's shard.
+     */
+    uint64_t add(std::size_t slot, uint64_t value) noexcept {
+        if (shards_ == nullptr) {
+            return 0;
+        }
+        return localShard().values[slot].fetch_add(value, std::memory_order_relaxed) + value;
+    }
+
+    /**
+     * @brief Subtracts @p value from @p slot; returns the new value of the caller's shard.
+     */
+    uint64_t sub(std::size_t slot, uint64_t value) noexcept {
+        if (shards_ == nullptr) {
+            return 0;
+        }
+        return localShard().values[slot].fetch_sub(value, std::memory_order_relaxed) - value;
+    }
+
+    /**
+     * @brief Sum of @p slot over all shards.
+     */
+    uint64_t load(std::size_t slot) const noexcept {
+        uint64_t total = 0;
+        for (std::size_t i = 0; i < shard_count_; ++i) {
+            total += shards_[i].values[slot].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset() noexcept {
+        for (std::size_t i = 0; i < shard_count_; ++i) {
+            for (auto& value : shards_[i].values) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> values[Slots]{};
+    };
+
+    Shard& localShard() noexcept { return shards_[threadShardSeed() & (shard_count_ - 1)]; }
+
+    std::size_t shard_count_{0};
+    std::unique_ptr<Shard[]> shards_{};
+};
+
+/**
+ * @brief Sharded gauge (e.g. bytes in use) with an approximate high-water mark.
+ *
+ * Like a kernel percpu_counter, each shard accumulates a local delta and
+ * folds it into a central value once it reaches +/- batch. Every add()
+ * compares central plus its own shard's delta against the peak (one relaxed
+ * load, an RMW only for a new peak), and reads raise it to the exact value,
+ * so it never decreases and stays within shardCount() * batch() of the true
+ * peak (other shards' unfolded deltas are invisible to a writer). value() is
+ * exact when writers are quiescent.
+ */
+class ShardedGauge {
+public:
+    static constexpr uint64_t kDefaultBatch = uint64_t{256} << 10;
+
+    explicit ShardedGauge(uint64_t batch = kDefaultBatch,
+                          std::size_t shard_count = defaultShardCount())
+        : locals_(shard_count), batch_(batch == 0 ? 1 : batch) {}
+
+    ShardedGauge(const ShardedGauge&) = delete;
+    ShardedGauge& operator=(const ShardedGauge&) = delete;
+
+    ShardedGauge(ShardedGauge&& other) noexcept
+        : locals_(std::move(other.locals_)),
+          central_(other.central_.load(std::memory_order_relaxed)),
+          peak_(other.peak_.load(std::memory_order_relaxed)),
+          batch_(other.batch_) {}
+
+    ShardedGauge& operator=(ShardedGauge&& other) noexcept {
+        if (this != &other) {
+            locals_ = std::move(other.locals_);
+            central_.store(other.central_.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+            peak_.store(other.peak_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            batch_ = other.batch_;
+        }
+        return *this;
+    }
+
+    ~ShardedGauge() = default;
+
+    uint64_t batch() const noexcept { return batch_; }
+    std::size_t shardCount() const noexcept { return locals_.shardCount(); }
+
+    void add(uint64_t value) noexcept {
+        const auto local = static_cast<int64_t>(locals_.add(0, value));
+        if (local >= static_cast<int64_t>(batch_)) {
+            fold(static_cast<uint64_t>(local));
+            return;
+        }
+        const uint64_t candidate =
+            central_.load(std::memory_order_relaxed) + static_cast<uint64_t>(local);
+        if (candidate > peak_.load(std::memory_order_relaxed)) {
+            raisePeak(candidate);
+        }
+    }
+
+    void sub(uint64_t value) noexcept {
+        const auto local = static_cast<int64_t>(locals_.sub(0, value));
+        if (local <= -static_cast<int64_t>(batch_)) {
+            fold(static_cast<uint64_t>(local));
+        }
+    }
+
+    /**
+     * @brief Exact current value (central plus every shard's unfolded delta).
+     */
+    uint64_t value() const noexcept {
+        return central_.load(std::memory_order_relaxed) + locals_.load(0);
+    }
+
+    /**
+     * @brief Approximate peak; also raises it to the current exact value.
+     */
+    uint64_t peak() const noexcept {
+        raisePeak(value());
+        return peak_.load(std::memory_order_relaxed);
+    }
+
+    void reset() noexcept {
+        locals_.reset();
+        central_.store(0, std::memory_order_relaxed);
+        peak_.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    // Moves the caller's shard delta into the central value. Other threads
+    // sharing the shard may have updated it meanwhile; subtracting exactly the
+    // folded amount keeps the total unchanged.
+    void fold(uint64_t local) noexcept {
+        locals_.sub(0, local);
+        const uint64_t central = central_.fetch_add(local, std::memory_order_relaxed) + local;
+        raisePeak(central);
+    }
+
+    void raisePeak(uint64_t candidate) const noexcept {
+        // A transiently "negative" total wraps around; never record it.
+        if (static_cast<int64_t>(candidate) < 0) {
+            return;
+        }
+        uint64_t peak = peak_.load(std::memory_order_relaxed);
+        while (candidate > peak &&
+               !peak_.compare_exchange_weak(peak, candidate, std::memory_order_relaxed)) {
+        }
+    }
+
+    ShardedCounters<1> locals_;
+    std::atomic<uint64_t> central_{0};
+    mutable std::atomic<uint64_t> peak_{0};
+    uint64_t batch_{kDefaultBatch};
+};
+
+}  // namespace orteaf::internal::base
@@ -3,6 +3,8 @@
 #include "orteaf/internal/execution/allocator/lowlevel/hierarchical_slot_single_ops.h"
 
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace orteaf::internal::execution::allocator::policies {
 
@@ -40,20 +42,32 @@ public:
 
         std::vector<uint32_t> rs = storage_.computeRequestSlots(size);
 
-        // 高速パス：末尾から連続確保
-        AllocationPlan plan = tryFindTrailPlan(rs);
+        // 探索はレイヤ横断で状態を読むため全レイヤをロックする。
+        // 単一操作の fast path はレイヤロックだけで free スロットを取るので、
+        // 計画したスロットを取られないよう実行まで同じロックを保持し続ける。
+        {
+            auto layer_locks = storage_.lockAllLayers();
 
-        if (!plan.found) {
-            // 中間探索
-            plan = tryFindMiddlePlan(rs);
-        }
+            // 高速パス：末尾から連続確保
+            AllocationPlan plan = tryFindTrailPlan(rs);
+
+            if (!plan.found) {
+                // 中間探索
+                plan = tryFindMiddlePlan(rs);
+            }
 
-        if (!plan.found) {
-            // expand して再試行
-            expandForRequest(rs);
-            plan = tryFindTrailPlan(rs);
+            if (plan.found) {
+                return executeAllocationPlan(plan, rs, size);
+            }
         }
 
+        // expand して再試行。addRegion は root のレイヤロックを自分で取るため、
+        // レイヤロックを手放してから呼ぶ（構造ロックは保持したまま）。
+        expandForRequest(rs);
+
+        auto layer_locks = storage_.lockAllLayers();
+        AllocationPlan plan = tryFindTrailPlan(rs);
+
         ORTEAF_THROW_IF(!plan.found, OutOfMemory, "Cannot allocate dense region");
 
         return executeAllocationPlan(plan, rs, size);
@@ -72,35 +86,33 @@ public:
 
     void deallocateDense(BufferView view, std::size_t size) {
         if (!view) return;
-        std::lock_guard<std::mutex> lock(storage_.mutex());
-
-        std::vector<uint32_t> rs = storage_.computeRequestSlots(size);
-        auto& layers = storage_.layers();
-
-        // viewのアドレスから開始位置を特定
-        void* base_addr = view.data();
-        std::size_t offset = 0;
-
-        for (uint32_t layer_idx = 0; layer_idx < rs.size(); ++layer_idx) {
-            Layer& layer = layers[layer_idx];
 
-            for (uint32_t i = 0; i < rs[layer_idx]; ++i) {
-                void* expected_addr = static_cast<char*>(base_addr) + offset;
+        std::vector<std::pair<uint32_t, uint32_t>> targets;
+        std::vector<HeapRegion> runs;
+        {
+            std::lock_guard<std::mutex> lock(storage_.mutex());
+            auto layer_locks = storage_.lockAllLayers();
+            collectDenseSlots(view, size, targets, runs);
+        }
 
-                // 該当スロットを探す
-                for (uint32_t slot_idx = 0; slot_idx < layer.slots.size(); ++slot_idx) {
-                    Slot& slot = layer.slots[slot_idx];
-                    if (slot.state == State::InUse && slot.region.data() == expected_addr) {
-                        single_ops_.unmapSlot(layer_idx, slot_idx);
-                        single_ops_.releaseSlot(layer_idx, slot_idx);
-                        single_ops_.tryMergeUpward(layer_idx, slot_idx);
-                        break;
-                    }
-                }
+        // 対象スロットは InUse のままなので、unmap はロック外で行える。
+        // 連続して見つかったスロットは 1 回の unmap にまとめてある。
+        for (const HeapRegion& run : runs) {
+            single_ops_.unmapRange(run);
+        }
 
-                offset += layer.slot_size;
+        std::vector<std::pair<uint32_t, uint32_t>> merge_candidates;
+        for (const auto& [layer_idx, slot_idx] : targets) {
+            if (single_ops_.releaseSlot(layer_idx, slot_idx)) {
+                merge_candidates.emplace_back(layer_idx, slot_idx);
             }
         }
+        if (merge_candidates.empty()) return;
+
+        std::lock_guard<std::mutex> lock(storage_.mutex());
+        for (const auto& [layer_idx, slot_idx] : merge_candidates) {
+            single_ops_.tryMergeUpward(layer_idx, slot_idx);
+        }
     }
 
 private:
@@ -323,6 +335,59 @@ private:
     // Execution
     // ========================================================================
 
+    // viewのアドレスから開始位置を特定し、対象スロットとアドレス連続な区間を集める。
+    // 構造ロックと全レイヤロックを保持して呼ぶこと。
+    void collectDenseSlots(BufferView view, std::size_t size,
+                           std::vector<std::pair<uint32_t, uint32_t>>& targets,
+                           std::vector<HeapRegion>& runs) {
+        std::vector<uint32_t> rs = storage_.computeRequestSlots(size);
+        auto& layers = storage_.layers();
+
+        char* base_addr = static_cast<char*>(view.data());
+        std::size_t offset = 0;
+
+        char* run_begin = nullptr;
+        std::size_t run_bytes = 0;
+        auto flush_run = [&]() {
+            if (run_bytes != 0) {
+                runs.emplace_back(HeapRegion{run_begin, run_bytes});
+            }
+            run_begin = nullptr;
+            run_bytes = 0;
+        };
+
+        for (uint32_t layer_idx = 0; layer_idx < rs.size(); ++layer_idx) {
+            Layer& layer = layers[layer_idx];
+
+            for (uint32_t i = 0; i < rs[layer_idx]; ++i) {
+                char* expected_addr = base_addr + offset;
+
+                // 該当スロットを探す
+                bool found = false;
+                for (uint32_t slot_idx = 0; slot_idx < layer.slots.size(); ++slot_idx) {
+                    Slot& slot = layer.slots[slot_idx];
+                    if (slot.state == State::InUse && slot.region.data() == expected_addr) {
+                        targets.emplace_back(layer_idx, slot_idx);
+                        found = true;
+                        break;
+                    }
+                }
+
+                if (found) {
+                    if (run_bytes == 0) {
+                        run_begin = expected_addr;
+                    }
+                    run_bytes += layer.slot_size;
+                } else {
+                    flush_run();
+                }
+
+                offset += layer.slot_size;
+            }
+        }
+        flush_run();
+    }
+
     void expandForRequest(const std::vector<uint32_t>& rs) {
         const auto& levels = storage_.config().levels;
         std::size_t total_needed = 0;
@@ -335,6 +400,7 @@ private:
         storage_.addRegion(expand);
     }
 
+    // 計画時と同じ構造ロックと全レイヤロックを保持して呼ぶこと。
     BufferView executeAllocationPlan(const AllocationPlan& plan, const std::vector<uint32_t>& rs, std::size_t size) {
     }
 
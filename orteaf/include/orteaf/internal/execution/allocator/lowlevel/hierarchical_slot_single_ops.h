@@ -2,6 +2,10 @@
 
 #include "orteaf/internal/execution/allocator/lowlevel/hierarchical_slot_storage.h"
 
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
 namespace orteaf::internal::execution::allocator::policies {
 
 /**
@@ -23,68 +27,110 @@ public:
     // Single slot allocation
     // ========================================================================
 
+    /**
+     * @brief 1 スロットを確保して map する。
+     *
+     * 対象レイヤに空きがあればそのレイヤのロックだけで pop する。
+     * 空きがない場合のみ構造ロックを取り、親スロットの split / VA 拡張を行う。
+     * map はいずれのロックも持たずに呼ぶ。
+     */
     BufferView allocate(std::size_t size) {
-        std::lock_guard<std::mutex> lock(storage_.mutex());
-
         uint32_t target = Storage::pickLayer(storage_.config().levels, size);
         ORTEAF_THROW_IF(target == Storage::kInvalidLayer, OutOfMemory, "No suitable layer");
 
-        ensureSlotAvailable(target);
-        uint32_t slot_idx = acquireSlot(target);
-        return mapSlot(target, slot_idx);
+        HeapRegion region{};
+        if (!tryAcquireFree(target, region)) {
+            std::lock_guard<std::mutex> lock(storage_.mutex());
+            region = acquireSlotSlow(target);
+        }
+        return storage_.heapOps()->map(region);
     }
 
+    /**
+     * @brief スロットを unmap して解放する。
+     *
+     * unmap はスロットを InUse のまま（他スレッドに渡らない状態で）ロック外で行う。
+     * 兄弟がすべて Free になった可能性がある場合のみ構造ロックを取り merge する。
+     */
     void deallocate(BufferView view) {
         if (!view) return;
-        std::lock_guard<std::mutex> lock(storage_.mutex());
 
-        auto [layer_idx, slot_idx] = findSlot(view);
-        if (layer_idx == Storage::kInvalidLayer) return;
+        uint32_t layer_idx = Storage::kInvalidLayer;
+        uint32_t slot_idx = 0;
+        HeapRegion region{};
+        if (!findInUseSlot(view, layer_idx, slot_idx, region)) return;
 
-        Slot& slot = storage_.layers()[layer_idx].slots[slot_idx];
-        if (slot.state != State::InUse) return;
+        storage_.heapOps()->unmap(region, storage_.layers()[layer_idx].slot_size);
 
-        unmapSlot(layer_idx, slot_idx);
-        releaseSlot(layer_idx, slot_idx);
-        tryMergeUpward(layer_idx, slot_idx);
+        if (releaseSlot(layer_idx, slot_idx)) {
+            std::lock_guard<std::mutex> lock(storage_.mutex());
+            tryMergeUpward(layer_idx, slot_idx);
+        }
     }
 
     // ========================================================================
     // Internal operations (exposed for DenseOps)
     // ========================================================================
 
-    void ensureSlotAvailable(uint32_t target_layer) {
-        auto& layers = storage_.layers();
-        if (Storage::hasFreeSlot(layers[target_layer])) {
-            return;
-        }
-
-        int parent_layer = findParentWithFreeSlot(target_layer);
+    /**
+     * @brief 対象レイヤの free_list から 1 スロットを取り出して InUse にする。
+     * @return 空きがなければ false
+     */
+    bool tryAcquireFree(uint32_t layer_index, HeapRegion& region) {
+        std::lock_guard<std::mutex> lock(storage_.layerMutex(layer_index));
+        Layer& layer = storage_.layers()[layer_index];
+        if (!Storage::hasFreeSlot(layer)) return false;
+        uint32_t slot_idx = Storage::popFreeSlot(layer);
+        Storage::markSlotInUse(layer.slots[slot_idx]);
+        region = layer.slots[slot_idx].region;
+        return true;
+    }
 
-        if (parent_layer < 0) {
-            std::size_t expand = storage_.config().expand_bytes;
-            if (expand == 0) {
-                expand = layers[0].slot_size;
+    /**
+     * @brief 親スロットを split（必要なら VA 拡張）して 1 スロットを確保する。
+     *
+     * 呼び出し側は構造ロックを保持していること。
+     * split で生まれた兄弟は他スレッドからも pop できるため、
+     * 自分の分は子レイヤのロックを持ったまま取り出す。
+     */
+    HeapRegion acquireSlotSlow(uint32_t target_layer) {
+        HeapRegion region{};
+        for (;;) {
+            // 構造ロック待ちの間に他スレッドが補充している場合がある
+            if (tryAcquireFree(target_layer, region)) return region;
+
+            uint32_t parent_slot = 0;
+            int parent_layer = popFreeParent(target_layer, parent_slot);
+            if (parent_layer < 0) {
+                std::size_t expand = storage_.config().expand_bytes;
+                if (expand == 0) {
+                    expand = storage_.layers()[0].slot_size;
+                }
+                storage_.addRegion(expand);
+                if (target_layer == 0) continue;
+                parent_layer = popFreeParent(target_layer, parent_slot);
+                // root を fast path に取られた場合はもう一度拡張する
+                if (parent_layer < 0) continue;
             }
-            storage_.addRegion(expand);
-            parent_layer = 0;
-        }
 
-        for (int i = parent_layer; i < static_cast<int>(target_layer); ++i) {
-            uint32_t slot_idx = Storage::popFreeSlot(layers[i]);
-            Storage::splitSlot(layers[i], layers[i + 1], slot_idx);
+            auto& layers = storage_.layers();
+            for (uint32_t i = static_cast<uint32_t>(parent_layer); i < target_layer; ++i) {
+                std::scoped_lock lock(storage_.layerMutex(i), storage_.layerMutex(i + 1));
+                Storage::splitSlot(layers[i], layers[i + 1], parent_slot);
+                parent_slot = Storage::popFreeSlot(layers[i + 1]);
+                if (i + 1 == target_layer) {
+                    Slot& slot = layers[i + 1].slots[parent_slot];
+                    Storage::markSlotInUse(slot);
+                    region = slot.region;
+                }
+            }
+            return region;
         }
     }
 
-    uint32_t acquireSlot(uint32_t layer_index) {
-        Layer& layer = storage_.layers()[layer_index];
-        uint32_t slot_idx = Storage::popFreeSlot(layer);
-        Storage::markSlotInUse(layer.slots[slot_idx]);
-        return slot_idx;
-    }
-
     // Dense用: 既知のインデックスをそのまま確保する
     void acquireSpecificSlot(uint32_t layer_index, uint32_t slot_index) {
+        std::lock_guard<std::mutex> lock(storage_.layerMutex(layer_index));
         Layer& layer = storage_.layers()[layer_index];
         ORTEAF_THROW_IF(slot_index >= layer.slots.size(), OutOfMemory, "Slot index out of range");
         Slot& slot = layer.slots[slot_index];
@@ -93,87 +139,136 @@ public:
         // free_list からは呼び出し元で調整済み（or 未登録）想定
     }
 
-    BufferView mapSlot(uint32_t layer_index, uint32_t slot_index) {
-        Slot& slot = storage_.layers()[layer_index].slots[slot_index];
-        return storage_.heapOps()->map(slot.region);
+    // Dense用: アドレス連続なスロット範囲を 1 回の HeapOps 呼び出しで map/unmap する
+    BufferView mapRange(HeapRegion range) {
+        return storage_.heapOps()->map(range);
     }
 
-    void unmapSlot(uint32_t layer_index, uint32_t slot_index) {
-        Layer& layer = storage_.layers()[layer_index];
-        Slot& slot = layer.slots[slot_index];
-        storage_.heapOps()->unmap(slot.region, layer.slot_size);
+    void unmapRange(HeapRegion range) {
+        storage_.heapOps()->unmap(range, range.size());
     }
 
-    void releaseSlot(uint32_t layer_index, uint32_t slot_index) {
+    /**
+     * @brief スロットを Free に戻して free_list に積む。
+     * @return 兄弟がすべて Free になった可能性があり、merge を試す価値がある場合 true
+     */
+    bool releaseSlot(uint32_t layer_index, uint32_t slot_index) {
+        std::lock_guard<std::mutex> lock(storage_.layerMutex(layer_index));
         Layer& layer = storage_.layers()[layer_index];
         Storage::markSlotFree(layer.slots[slot_index]);
         layer.free_list.pushBack(slot_index);
+        return mayMerge(layer_index, slot_index);
     }
 
-    std::pair<uint32_t, uint32_t> findSlot(BufferView view) const {
-        const auto& layers = storage_.layers();
-        for (uint32_t layer_idx = 0; layer_idx < layers.size(); ++layer_idx) {
-            const auto& layer = layers[layer_idx];
-            for (uint32_t slot_idx = 0; slot_idx < layer.slots.size(); ++slot_idx) {
-                const Slot& slot = layer.slots[slot_idx];
-                if (slot.state == State::InUse && slot.region.data() == view.data()) {
-                    return {layer_idx, slot_idx};
-                }
-            }
+    std::pair<uint32_t, uint32_t> findSlot(BufferView view) {
+        uint32_t layer_idx = Storage::kInvalidLayer;
+        uint32_t slot_idx = 0;
+        HeapRegion region{};
+        if (!findInUseSlot(view, layer_idx, slot_idx, region)) {
+            return {Storage::kInvalidLayer, 0};
         }
-        return {Storage::kInvalidLayer, 0};
+        return {layer_idx, slot_idx};
     }
 
+    // 呼び出し側は構造ロックを保持していること
     void tryMergeUpward(uint32_t layer_idx, uint32_t slot_idx) {
-        auto& layers = storage_.layers();
-        Slot& slot = layers[layer_idx].slots[slot_idx];
-        if (slot.parent_slot == Storage::kNoParent || layer_idx == 0) return;
+        if (layer_idx == 0) return;
 
+        auto& layers = storage_.layers();
         uint32_t parent_layer_idx = layer_idx - 1;
-        uint32_t parent_slot_idx = slot.parent_slot;
+        uint32_t parent_slot_idx = 0;
+        {
+            std::scoped_lock lock(storage_.layerMutex(parent_layer_idx), storage_.layerMutex(layer_idx));
+            Slot& slot = layers[layer_idx].slots[slot_idx];
+            if (slot.parent_slot == Storage::kNoParent) return;
+            parent_slot_idx = slot.parent_slot;
+
+            Layer& parent_layer = layers[parent_layer_idx];
+            Layer& child_layer = layers[layer_idx];
+            Slot& parent = parent_layer.slots[parent_slot_idx];
+
+            if (parent.state != State::Split) return;
+
+            const std::size_t count = parent_layer.slot_size / child_layer.slot_size;
+            if (!Storage::allSiblingsFree(child_layer, parent.child_begin, count)) return;
+
+            // 子をfree_listから除去
+            ::orteaf::internal::base::HeapVector<uint32_t> new_free_list;
+            for (std::size_t i = 0; i < child_layer.free_list.size(); ++i) {
+                const auto idx = child_layer.free_list[i];
+                if (idx < parent.child_begin || idx >= parent.child_begin + count) {
+                    new_free_list.pushBack(idx);
+                }
+            }
+            child_layer.free_list = std::move(new_free_list);
 
-        Layer& parent_layer = layers[parent_layer_idx];
-        Layer& child_layer = layers[layer_idx];
-        Slot& parent = parent_layer.slots[parent_slot_idx];
+            // span_free_listにchild_beginを追加（再利用用）
+            child_layer.span_free_list.pushBack(parent.child_begin);
 
-        if (parent.state != State::Split) return;
+            // 親をFreeに戻す
+            Storage::markSlotFree(parent);
+            parent.child_begin = 0;
+            parent_layer.free_list.pushBack(parent_slot_idx);
+        }
 
-        const std::size_t count = parent_layer.slot_size / child_layer.slot_size;
-        if (!Storage::allSiblingsFree(child_layer, parent.child_begin, count)) return;
+        // 再帰的に上へ（レイヤロックは昇順でしか取れないため一度手放す）
+        tryMergeUpward(parent_layer_idx, parent_slot_idx);
+    }
 
-        // 子をfree_listから除去
-        ::orteaf::internal::base::HeapVector<uint32_t> new_free_list;
-        for (std::size_t i = 0; i < child_layer.free_list.size(); ++i) {
-            const auto idx = child_layer.free_list[i];
-            if (idx < parent.child_begin || idx >= parent.child_begin + count) {
-                new_free_list.pushBack(idx);
+private:
+    bool findInUseSlot(BufferView view, uint32_t& layer_idx, uint32_t& slot_idx, HeapRegion& region) {
+        auto& layers = storage_.layers();
+        for (uint32_t l = 0; l < layers.size(); ++l) {
+            std::lock_guard<std::mutex> lock(storage_.layerMutex(l));
+            const Layer& layer = layers[l];
+            for (uint32_t i = 0; i < layer.slots.size(); ++i) {
+                const Slot& slot = layer.slots[i];
+                if (slot.state == State::InUse && slot.region.data() == view.data()) {
+                    layer_idx = l;
+                    slot_idx = i;
+                    region = slot.region;
+                    return true;
+                }
             }
         }
-        child_layer.free_list = std::move(new_free_list);
-
-        // span_free_listにchild_beginを追加（再利用用）
-        child_layer.span_free_list.pushBack(parent.child_begin);
-
-        // 親をFreeに戻す
-        Storage::markSlotFree(parent);
-        parent.child_begin = 0;
-        parent_layer.free_list.pushBack(parent_slot_idx);
-
-        // 再帰的に上へ
-        tryMergeUpward(parent_layer_idx, parent_slot_idx);
+        return false;
     }
 
-    int findParentWithFreeSlot(uint32_t target_layer) const noexcept {
-        const auto& layers = storage_.layers();
+    // target より上位のレイヤから空きスロットを 1 つ取り出す（近い順）
+    int popFreeParent(uint32_t target_layer, uint32_t& slot_idx) {
+        auto& layers = storage_.layers();
         for (int i = static_cast<int>(target_layer) - 1; i >= 0; --i) {
+            std::lock_guard<std::mutex> lock(storage_.layerMutex(static_cast<uint32_t>(i)));
             if (Storage::hasFreeSlot(layers[i])) {
+                slot_idx = Storage::popFreeSlot(layers[i]);
                 return i;
             }
         }
         return -1;
     }
 
-private:
+    // レイヤロック保持中に呼ぶ。親のスロットは参照できないため、
+    // 近傍で同じ親を持つ Free スロットを数えて merge の候補かを判定する（偽陽性は可）。
+    bool mayMerge(uint32_t layer_idx, uint32_t slot_idx) const {
+        if (layer_idx == 0) return false;
+        const auto& layers = storage_.layers();
+        const Layer& layer = layers[layer_idx];
+        const uint32_t parent = layer.slots[slot_idx].parent_slot;
+        if (parent == Storage::kNoParent) return false;
+
+        const std::size_t count = layers[layer_idx - 1].slot_size / layer.slot_size;
+        const std::size_t begin = slot_idx + 1 >= count ? slot_idx + 1 - count : 0;
+        const std::size_t end = std::min<std::size_t>(layer.slots.size(), slot_idx + count);
+        std::size_t free_siblings = 0;
+        for (std::size_t i = begin; i < end; ++i) {
+            const Slot& slot = layer.slots[i];
+            if (slot.state == State::Free && slot.parent_slot == parent) {
+                ++free_siblings;
+            }
+        }
+        return free_siblings >= count;
+    }
+
     Storage& storage_;
 };
 
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <vector>
 
@@ -16,6 +17,14 @@ namespace orteaf::internal::execution::allocator::policies {
 
 /**
  * @brief 階層的スロットの状態管理用ストレージ
+ *
+ * ロックは 2 段構成。
+ * - layerMutex(i): レイヤ i の slots / free_list / span_free_list を保護する。
+ *   単一レイヤの pop/push はこのロックだけで行える。
+ *   複数レイヤを同時にロックする場合は必ずインデックスの昇順で取得する。
+ * - mutex(): 構造変更（split / merge / addRegion）を直列化する。
+ *   構造ロックを持ったままレイヤロックを取るのは可、その逆は不可。
+ * HeapOps の map/unmap はどちらのロックも持たずに呼ぶ。
  */
 template <class HeapOps, ::orteaf::internal::execution::Execution B>
 class HierarchicalSlotStorage {
@@ -76,6 +85,7 @@ public:
     for (auto size : config.levels) {
       layers_.emplace_back(size);
     }
+    layer_mutexes_ = std::make_unique<std::mutex[]>(layers_.size());
 
     std::size_t initial = config.initial_bytes;
     if (initial == 0) {
@@ -95,6 +105,19 @@ public:
     return layers_;
   }
   [[nodiscard]] std::mutex &mutex() noexcept { return mutex_; }
+  [[nodiscard]] std::mutex &layerMutex(uint32_t layer_idx) noexcept {
+    return layer_mutexes_[layer_idx];
+  }
+
+  // 全レイヤのロックを昇順に取得する（レイヤ横断の探索用）
+  [[nodiscard]] std::vector<std::unique_lock<std::mutex>> lockAllLayers() {
+    std::vector<std::unique_lock<std::mutex>> locks;
+    locks.reserve(layers_.size());
+    for (uint32_t i = 0; i < layers_.size(); ++i) {
+      locks.emplace_back(layer_mutexes_[i]);
+    }
+    return locks;
+  }
 
 #if ORTEAF_ENABLE_TEST
   struct DebugSlot {
@@ -289,14 +312,19 @@ public:
   // Region management
   // ========================================================================
 
+  // 呼び出し側は mutex()（構造ロック）を保持し、レイヤロックは持たないこと
+  // （initialize 中を除く）。root のレイヤロックは addRegion 内で取る。
+
   void addRegion(std::size_t bytes) {
     ORTEAF_THROW_IF(layers_.empty(), InvalidState, "No layers configured");
 
     auto &root = layers_[0];
     std::size_t remaining = (bytes == 0) ? root.slot_size : bytes;
 
+    // reserve はレイヤロックの外で行い、スロット登録時だけ root をロックする
     HeapRegion base_region = heap_ops_->reserve(remaining);
     std::size_t offset = 0;
+    std::lock_guard<std::mutex> lock(layer_mutexes_[0]);
 
     while (remaining > 0) {
       const std::size_t step =
@@ -321,6 +349,7 @@ private:
   Config config_{};
   HeapOps *heap_ops_{nullptr};
   std::vector<Layer> layers_;
+  std::unique_ptr<std::mutex[]> layer_mutexes_;
   mutable std::mutex mutex_;
 };
 
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <bit>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <utility>
 
 #include "orteaf/internal/execution/execution.h"
 #include "orteaf/internal/base/handle.h"
@@ -20,6 +24,19 @@ namespace orteaf::internal::execution::allocator::policies {
  * を判別し、下位ビットをチャンクのスロットに割り当てる。 device/context
  * ごとに分けず、配列ひとつで O(1) アクセスにする。
  *
+ * used/pending が 0 のチャンクはビットマップで追跡し、解放候補の検索を
+ * 全チャンク走査ではなく 64 チャンク単位のワード走査で行う。
+ * ビットの更新は std::atomic_ref で行うため、異なるチャンクのカウンタを
+ * 別スレッドが（サイズクラス単位ロックの下で）同時に更新してもよい。
+ * チャンク情報はセグメント単位で確保して既存要素を移動しないので、
+ * addChunk も他チャンクのカウンタ更新と並行してよい（addChunk 同士は排他）。
+ * releaseChunk と全チャンクを走査する API は排他的に呼ぶこと。
+ *
+ * アイドル時間は時計ではなく「アイドルエポック」で測る。チャンクが
+ * used/pending 0 になった時点のエポックを記録し、トリマーが
+ * advanceIdleEpoch() でエポックを進める。ホットパスで追加されるのは
+ * 状態が変化したときのエポック読み出し 1 回だけになる。
+ *
  * @tparam Resource リソース管理クラス
  */
 template <typename Resource>
@@ -36,8 +53,15 @@ public:
   DirectChunkLocatorPolicy(const DirectChunkLocatorPolicy &) = delete;
   DirectChunkLocatorPolicy &
   operator=(const DirectChunkLocatorPolicy &) = delete;
-  DirectChunkLocatorPolicy(DirectChunkLocatorPolicy &&) = default;
-  DirectChunkLocatorPolicy &operator=(DirectChunkLocatorPolicy &&) = default;
+  DirectChunkLocatorPolicy(DirectChunkLocatorPolicy &&other) noexcept {
+    moveFrom(other);
+  }
+  DirectChunkLocatorPolicy &operator=(DirectChunkLocatorPolicy &&other) noexcept {
+    if (this != &other) {
+      moveFrom(other);
+    }
+    return *this;
+  }
   ~DirectChunkLocatorPolicy() = default;
 
   /**
@@ -79,7 +103,9 @@ public:
     }
 
     const std::size_t slot = reserveSlot();
-    chunks_[slot] = ChunkInfo{base, size, alignment, 0u, 0u, true};
+    chunkAt(slot) = ChunkInfo{base, size, alignment, 0u, 0u, true};
+    updateReleasable(slot);
+    chunk_bytes_ += size;
     return BufferBlock{encodeId(slot), base};
   }
 
@@ -91,17 +117,19 @@ public:
   bool releaseChunk(BufferViewHandle handle) {
 
     const std::size_t slot = indexFromId(handle);
-    if (slot >= chunks_.size() || resource_ == nullptr) {
+    if (slot >= slotCount() || resource_ == nullptr) {
       return false;
     }
 
-    ChunkInfo &chunk = chunks_[slot];
+    ChunkInfo &chunk = chunkAt(slot);
     if (!chunk.alive || chunk.used != 0 || chunk.pending != 0) {
       return false;
     }
 
     resource_->deallocate(chunk.base, chunk.size, chunk.alignment);
+    chunk_bytes_ -= chunk.size;
     chunk = ChunkInfo{};
+    updateReleasable(slot);
     free_list_.pushBack(slot);
     return true;
   }
@@ -119,19 +147,126 @@ public:
 
   BufferViewHandle findReleasable() const {
 
-    for (std::size_t i = 0; i < chunks_.size(); ++i) {
-      const ChunkInfo &chunk = chunks_[i];
-      if (chunk.alive && chunk.used == 0 && chunk.pending == 0) {
-        return encodeId(i);
+    for (std::size_t word = 0; word < wordCount(); ++word) {
+      const std::uint64_t bits = loadBits(word);
+      if (bits != 0) {
+        return encodeId(word * kBitsPerWord +
+                        static_cast<std::size_t>(std::countr_zero(bits)));
       }
     }
     return BufferViewHandle::invalid();
   }
 
+  /**
+   * @brief 解放可能なチャンクをすべて out に追加する（スロット昇順）。
+   * @param out 追加先
+   * @return 追加したチャンク数
+   */
+  std::size_t collectReleasable(
+      ::orteaf::internal::base::HeapVector<BufferViewHandle> &out) const {
+    std::size_t count = 0;
+    for (std::size_t word = 0; word < wordCount(); ++word) {
+      std::uint64_t bits = loadBits(word);
+      while (bits != 0) {
+        const std::size_t bit =
+            static_cast<std::size_t>(std::countr_zero(bits));
+        out.pushBack(encodeId(word * kBitsPerWord + bit));
+        bits &= bits - 1;
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  /**
+   * @brief 解放可能なチャンク数を返す。
+   */
+  std::size_t releasableCount() const {
+    std::size_t count = 0;
+    for (std::size_t word = 0; word < wordCount(); ++word) {
+      count += static_cast<std::size_t>(std::popcount(loadBits(word)));
+    }
+    return count;
+  }
+
+  /**
+   * @brief 生存チャンクの数と合計サイズ。
+   */
+  struct ChunkUsage {
+    std::size_t chunk_count{0};
+    std::size_t chunk_bytes{0};
+  };
+
+  /**
+   * @brief 生存チャンクの数と合計サイズを返す（統計用、O(チャンク数)）。
+   */
+  ChunkUsage usage() const {
+    ChunkUsage out{};
+    const std::size_t count = slotCount();
+    for (std::size_t i = 0; i < count; ++i) {
+      const ChunkInfo &chunk = chunkAt(i);
+      if (chunk.alive) {
+        ++out.chunk_count;
+        out.chunk_bytes += chunk.size;
+      }
+    }
+    return out;
+  }
+
+  /**
+   * @brief 生存チャンクの合計サイズ（O(1)、チャンクの追加・解放と同じ排他下で読む）。
+   */
+  std::size_t chunkBytes() const { return chunk_bytes_; }
+
+  /**
+   * @brief アイドルエポックを 1 つ進める（任意のスレッドから呼んでよい）。
+   * @return 進めた後のエポック
+   */
+  std::uint64_t advanceIdleEpoch() {
+    return std::atomic_ref<std::uint64_t>(idle_epoch_).fetch_add(
+               1, std::memory_order_relaxed) +
+           1;
+  }
+
+  std::uint64_t idleEpoch() const { return loadIdleEpoch(); }
+
+  /**
+   * @brief チャンクがアイドルになってから進んだエポック数。
+   * @return used/pending が 0 でない、または無効なチャンクは 0
+   */
+  std::uint64_t idleEpochsOf(BufferViewHandle handle) const {
+    const ChunkInfo *chunk = find(handle);
+    if (chunk == nullptr || chunk->used != 0 || chunk->pending != 0) {
+      return 0;
+    }
+    return loadIdleEpoch() - chunk->idle_since;
+  }
+
+  /**
+   * @brief ウォームアップで用意したチャンクとして記録し、アイドル開始を現在の
+   * エポックにする。最初に使われた時点で通常のチャンクに戻る。
+   */
+  void markWarm(BufferViewHandle handle) {
+    if (auto *chunk = find(handle)) {
+      chunk->warm = true;
+      chunk->idle_since = loadIdleEpoch();
+    }
+  }
+
+  /**
+   * @brief ウォームアップ後まだ一度も使われていないチャンクかどうか。
+   */
+  bool isWarm(BufferViewHandle handle) const {
+    const ChunkInfo *chunk = find(handle);
+    return chunk != nullptr && chunk->warm;
+  }
+
   void incrementUsed(BufferViewHandle handle) {
 
     if (auto *chunk = find(handle)) {
       ++chunk->used;
+      chunk->warm = false;
+      updateReleasable(indexFromId(handle));
     }
   }
 
@@ -141,6 +276,7 @@ public:
       if (chunk->used > 0) {
         --chunk->used;
       }
+      updateReleasable(indexFromId(handle));
     }
   }
 
@@ -148,6 +284,7 @@ public:
 
     if (auto *chunk = find(handle)) {
       ++chunk->pending;
+      updateReleasable(indexFromId(handle));
     }
   }
 
@@ -157,6 +294,7 @@ public:
       if (chunk->pending > 0) {
         --chunk->pending;
       }
+      updateReleasable(indexFromId(handle));
     }
   }
 
@@ -169,6 +307,7 @@ public:
       if (chunk->used > 0) {
         --chunk->used;
       }
+      updateReleasable(indexFromId(handle));
     }
   }
 
@@ -208,6 +347,10 @@ private:
     uint32_t used{};
     uint32_t pending{};
     bool alive{false};
+    // warmup で追加され、まだ一度も使われていない
+    bool warm{false};
+    // used/pending が 0 になった時点のアイドルエポック
+    std::uint64_t idle_since{};
   };
 
   // ========================================================================
@@ -216,25 +359,84 @@ private:
   static constexpr BufferViewHandle::underlying_type kLargeMask =
       BufferViewHandle::underlying_type{1u} << 31;
   static constexpr BufferViewHandle::underlying_type kChunkMask = ~kLargeMask;
+  static constexpr std::size_t kBitsPerWord = 64;
+  // セグメント k は kBitsPerWord << k スロットを持つ。26 個で kChunkMask まで届く。
+  static constexpr std::size_t kMaxSegments = 26;
+
+  struct SlotLocation {
+    std::size_t segment;
+    std::size_t offset;
+  };
 
   // ========================================================================
   // Internal methods
   // ========================================================================
+  void moveFrom(DirectChunkLocatorPolicy &other) noexcept {
+    config_ = other.config_;
+    resource_ = other.resource_;
+    for (std::size_t i = 0; i < kMaxSegments; ++i) {
+      chunk_segments_[i] = std::move(other.chunk_segments_[i]);
+      bit_segments_[i] = std::move(other.bit_segments_[i]);
+    }
+    slot_count_ = std::exchange(other.slot_count_, 0);
+    free_list_ = std::move(other.free_list_);
+    chunk_bytes_ = std::exchange(other.chunk_bytes_, 0);
+    idle_epoch_ = other.idle_epoch_;
+  }
+
+  // セグメントの先頭スロットは kBitsPerWord の倍数なので、ビット位置は
+  // slot % kBitsPerWord のまま使える。
+  static SlotLocation locate(std::size_t slot) {
+    const std::size_t group = slot / kBitsPerWord + 1;
+    const std::size_t segment = static_cast<std::size_t>(std::bit_width(group)) - 1;
+    return SlotLocation{
+        segment, slot - kBitsPerWord * ((std::size_t{1} << segment) - 1)};
+  }
+
+  static std::size_t segmentSlots(std::size_t segment) {
+    return kBitsPerWord << segment;
+  }
+
+  ChunkInfo &chunkAt(std::size_t slot) {
+    const SlotLocation loc = locate(slot);
+    return chunk_segments_[loc.segment][loc.offset];
+  }
+
+  const ChunkInfo &chunkAt(std::size_t slot) const {
+    const SlotLocation loc = locate(slot);
+    return chunk_segments_[loc.segment][loc.offset];
+  }
+
+  std::uint64_t &bitsWordOf(std::size_t slot) const {
+    const SlotLocation loc = locate(slot);
+    return bit_segments_[loc.segment][loc.offset / kBitsPerWord];
+  }
+
+  // addChunk は他スレッドの find と並行しうるため atomic_ref で読み書きする
+  std::size_t slotCount() const {
+    return std::atomic_ref<std::size_t>(const_cast<std::size_t &>(slot_count_))
+        .load(std::memory_order_acquire);
+  }
+
+  std::size_t wordCount() const {
+    return (slotCount() + kBitsPerWord - 1) / kBitsPerWord;
+  }
+
   ChunkInfo *find(BufferViewHandle handle) {
     const std::size_t slot = indexFromId(handle);
-    if (slot >= chunks_.size()) {
+    if (slot >= slotCount()) {
       return nullptr;
     }
-    ChunkInfo &chunk = chunks_[slot];
+    ChunkInfo &chunk = chunkAt(slot);
     return chunk.alive ? &chunk : nullptr;
   }
 
   const ChunkInfo *find(BufferViewHandle handle) const {
     const std::size_t slot = indexFromId(handle);
-    if (slot >= chunks_.size()) {
+    if (slot >= slotCount()) {
       return nullptr;
     }
-    const ChunkInfo &chunk = chunks_[slot];
+    const ChunkInfo &chunk = chunkAt(slot);
     return chunk.alive ? &chunk : nullptr;
   }
 
@@ -244,8 +446,52 @@ private:
       free_list_.resize(free_list_.size() - 1);
       return slot;
     }
-    chunks_.emplaceBack();
-    return chunks_.size() - 1;
+    const std::size_t slot = slot_count_;
+    const SlotLocation loc = locate(slot);
+    if (loc.offset == 0) {
+      ORTEAF_THROW_IF(loc.segment >= kMaxSegments, OutOfMemory,
+                      "DirectChunkLocatorPolicy ran out of chunk slots");
+      chunk_segments_[loc.segment] =
+          std::make_unique<ChunkInfo[]>(segmentSlots(loc.segment));
+      bit_segments_[loc.segment] = std::make_unique<std::uint64_t[]>(
+          segmentSlots(loc.segment) / kBitsPerWord);
+    }
+    std::atomic_ref<std::size_t>(slot_count_)
+        .store(slot + 1, std::memory_order_release);
+    return slot;
+  }
+
+  std::uint64_t loadIdleEpoch() const {
+    return std::atomic_ref<std::uint64_t>(const_cast<std::uint64_t &>(idle_epoch_))
+        .load(std::memory_order_relaxed);
+  }
+
+  std::uint64_t loadBits(std::size_t word) const {
+    return std::atomic_ref<std::uint64_t>(bitsWordOf(word * kBitsPerWord))
+        .load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief スロットの状態に合わせて解放候補ビットを更新する。
+   *
+   * 多くの呼び出しではビットが変化しないため、先に読み出して比較する。
+   */
+  void updateReleasable(std::size_t slot) {
+    ChunkInfo &chunk = chunkAt(slot);
+    const bool releasable =
+        chunk.alive && chunk.used == 0 && chunk.pending == 0;
+    const std::uint64_t mask = std::uint64_t{1} << (slot % kBitsPerWord);
+    std::atomic_ref<std::uint64_t> word(bitsWordOf(slot));
+    const bool current = (word.load(std::memory_order_relaxed) & mask) != 0;
+    if (releasable == current) {
+      return;
+    }
+    if (releasable) {
+      chunk.idle_since = loadIdleEpoch();
+      word.fetch_or(mask, std::memory_order_relaxed);
+    } else {
+      word.fetch_and(~mask, std::memory_order_relaxed);
+    }
   }
 
   // ========================================================================
@@ -254,8 +500,14 @@ private:
   Config config_{};
   Resource *resource_{nullptr};
 
-  ::orteaf::internal::base::HeapVector<ChunkInfo> chunks_;
+  std::unique_ptr<ChunkInfo[]> chunk_segments_[kMaxSegments]{};
+  // used/pending が 0 の生存チャンクを示すビットマップ（1 ワード 64 スロット）
+  std::unique_ptr<std::uint64_t[]> bit_segments_[kMaxSegments]{};
+  std::size_t slot_count_{0};
   ::orteaf::internal::base::HeapVector<std::size_t> free_list_;
+  std::size_t chunk_bytes_{0};
+  // advanceIdleEpoch() は他スレッドからも呼ばれるため atomic_ref で読み書きする
+  std::uint64_t idle_epoch_{0};
 };
 
 } // namespace orteaf::internal::execution::allocator::policies
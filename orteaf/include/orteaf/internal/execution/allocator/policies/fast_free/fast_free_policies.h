@@ -4,7 +4,9 @@
 #include <bit>
 #include <cstddef>
 
+#include "orteaf/internal/diagnostics/error/error_macros.h"
 #include "orteaf/internal/execution/allocator/policies/policy_config.h"
+#include "orteaf/internal/execution/allocator/size_class_utils.h"
 
 namespace orteaf::internal::execution::allocator::policies {
 
@@ -28,6 +30,83 @@ public:
                              std::size_t size_bytes) const {
     return std::bit_ceil(std::max(min_block_size, size_bytes));
   }
+
+  std::size_t size_class_index(std::size_t block_size,
+                               std::size_t min_block_size) const {
+    return sizeClassIndex(block_size, min_block_size);
+  }
+
+  std::size_t size_class_block_size(std::size_t index,
+                                    std::size_t min_block_size) const {
+    return sizeClassToBlockSize(index, min_block_size);
+  }
+
+  std::size_t size_class_count(std::size_t min_block_size,
+                               std::size_t max_block_size) const {
+    return sizeClassCount(min_block_size, max_block_size);
+  }
+};
+
+// Geometric size classes: each power-of-two octave is split into
+// sub_classes_per_octave evenly spaced classes (jemalloc style), which bounds
+// internal fragmentation to roughly 1 / sub_classes_per_octave.
+class GeometricFastFreePolicy {
+public:
+  template <typename Resource> struct Config : PolicyConfig<Resource> {
+    // Must be a power of two and no larger than min_block_size.
+    std::size_t sub_classes_per_octave{4};
+  };
+
+  GeometricFastFreePolicy() = default;
+  GeometricFastFreePolicy(const GeometricFastFreePolicy &) = delete;
+  GeometricFastFreePolicy &operator=(const GeometricFastFreePolicy &) = delete;
+  GeometricFastFreePolicy(GeometricFastFreePolicy &&) = default;
+  GeometricFastFreePolicy &operator=(GeometricFastFreePolicy &&) = default;
+  ~GeometricFastFreePolicy() = default;
+
+  template <typename Resource> void initialize(const Config<Resource> &config) {
+    ORTEAF_THROW_IF(config.sub_classes_per_octave == 0 ||
+                        !std::has_single_bit(config.sub_classes_per_octave),
+                    InvalidParameter,
+                    "sub_classes_per_octave must be a power of two");
+    sub_classes_ = config.sub_classes_per_octave;
+  }
+
+  void error() {}
+
+  std::size_t sub_classes_per_octave() const { return sub_classes_; }
+
+  std::size_t get_block_size(std::size_t min_block_size,
+                             std::size_t size_bytes) const {
+    return geometricBlockSize(std::max(min_block_size, size_bytes),
+                              min_block_size, subClassesFor(min_block_size));
+  }
+
+  std::size_t size_class_index(std::size_t block_size,
+                               std::size_t min_block_size) const {
+    return geometricSizeClassIndex(block_size, min_block_size,
+                                   subClassesFor(min_block_size));
+  }
+
+  std::size_t size_class_block_size(std::size_t index,
+                                    std::size_t min_block_size) const {
+    return geometricSizeClassToBlockSize(index, min_block_size,
+                                         subClassesFor(min_block_size));
+  }
+
+  std::size_t size_class_count(std::size_t min_block_size,
+                               std::size_t max_block_size) const {
+    return geometricSizeClassCount(min_block_size, max_block_size,
+                                   subClassesFor(min_block_size));
+  }
+
+private:
+  // Sub-classes finer than the smallest octave step would be zero-sized.
+  std::size_t subClassesFor(std::size_t min_block_size) const {
+    return std::min(sub_classes_, std::bit_ceil(min_block_size));
+  }
+
+  std::size_t sub_classes_{4};
 };
 
 // Placeholder for a safety-oriented strategy (to be defined per allocator
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+#include <orteaf/internal/base/heap_vector.h>
+#include <orteaf/internal/diagnostics/error/error_macros.h>
+#include <orteaf/internal/execution/allocator/buffer.h>
+#include <orteaf/internal/execution/allocator/policies/policy_config.h>
+
+namespace orteaf::internal::execution::allocator::policies {
+
+/**
+ * @brief Host 管理の bump-pointer 型フリーリストポリシー。
+ *
+ * HostStackFreelistPolicy と同じインターフェースを持つが、expand 時に
+ * チャンク内の全ブロックを積まず、サイズクラスごとの「フロンティア」
+ * チャンクとして保持する。pop は再利用ブロックのスタックを優先し、
+ * 空ならフロンティアのオフセットを進めて 1 ブロックを切り出す。
+ * expand は時間・メモリとも O(1) になる。
+ *
+ * サイズクラスの計算（min/max_block_size）は SegregatePool が担当し、
+ * 本ポリシーは list_index のみを扱う。
+ */
+template <typename Resource>
+class HostBumpFreelistPolicy {
+public:
+  using BufferBlock = Resource::BufferBlock;
+  using BufferView = BufferBlock::BufferView;
+  using BufferViewHandle = BufferBlock::BufferViewHandle;
+  using LaunchParams = Resource::LaunchParams;
+
+  HostBumpFreelistPolicy() = default;
+  HostBumpFreelistPolicy(const HostBumpFreelistPolicy &) = delete;
+  HostBumpFreelistPolicy &operator=(const HostBumpFreelistPolicy &) = delete;
+  HostBumpFreelistPolicy(HostBumpFreelistPolicy &&) = default;
+  HostBumpFreelistPolicy &operator=(HostBumpFreelistPolicy &&) = default;
+  ~HostBumpFreelistPolicy() = default;
+
+  struct Config : PolicyConfig<Resource> {
+    // サイズクラスの情報は SegregatePool が管理するため、
+    // ここには含めない
+  };
+
+  /**
+   * @brief ポリシーを初期化
+   * @param config リソースへのポインタを含む設定
+   * @param size_class_count サイズクラスの数（SegregatePool から渡される）
+   */
+  void initialize(const Config &config, std::size_t size_class_count = 0) {
+    ORTEAF_THROW_IF_NULL(config.resource,
+                         "HostBumpFreelistPolicy requires non-null Resource*");
+    resource_ = config.resource;
+    if (size_class_count > 0) {
+      lists_.resize(size_class_count);
+    }
+  }
+
+  /**
+   * @brief 再利用ブロックをスタックに積む。
+   */
+  void push(std::size_t list_index, const BufferBlock &block,
+            const LaunchParams & /*launch_params*/ = {}) {
+    ORTEAF_THROW_IF(resource_ == nullptr, InvalidState,
+                    "HostBumpFreelistPolicy is not initialized");
+    ensureCapacity(list_index);
+    lists_[list_index].recycled.pushBack(block);
+  }
+
+  /**
+   * @brief 再利用ブロックを優先して返し、なければフロンティアから切り出す。
+   */
+  BufferBlock pop(std::size_t list_index,
+                  const LaunchParams & /*launch_params*/ = {}) {
+    ORTEAF_THROW_IF(resource_ == nullptr, InvalidState,
+                    "HostBumpFreelistPolicy is not initialized");
+    if (list_index >= lists_.size()) {
+      return {};
+    }
+    SizeClassList &list = lists_[list_index];
+    if (!list.recycled.empty()) {
+      BufferBlock block = std::move(list.recycled.back());
+      list.recycled.resize(list.recycled.size() - 1);
+      return block;
+    }
+    while (!list.frontiers.empty()) {
+      Frontier &frontier = list.frontiers.back();
+      if (frontier.next_offset + frontier.block_size <= frontier.end_offset) {
+        const std::size_t offset = frontier.next_offset;
+        frontier.next_offset += frontier.block_size;
+        return BufferBlock{frontier.chunk.handle,
+                           Resource::makeView(frontier.chunk.view, offset,
+                                              frontier.block_size)};
+      }
+      list.frontiers.resize(list.frontiers.size() - 1);
+    }
+    return {};
+  }
+
+  bool empty(std::size_t list_index) const {
+    if (list_index >= lists_.size()) {
+      return true;
+    }
+    const SizeClassList &list = lists_[list_index];
+    if (!list.recycled.empty()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < list.frontiers.size(); ++i) {
+      if (list.frontiers[i].remaining() > 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  std::size_t get_active_freelist_count() const {
+    return lists_.empty() ? 0 : 1;
+  }
+
+  /**
+   * @brief 指定サイズクラスの再利用スタックとフロンティア残量の合計。
+   */
+  std::size_t get_free_blocks(std::size_t list_index) const {
+    if (list_index >= lists_.size()) {
+      return 0;
+    }
+    const SizeClassList &list = lists_[list_index];
+    std::size_t total = list.recycled.size();
+    for (std::size_t i = 0; i < list.frontiers.size(); ++i) {
+      total += list.frontiers[i].remaining();
+    }
+    return total;
+  }
+
+  /**
+   * @brief 再利用スタックとフロンティア残量を合わせた空きブロック数。
+   */
+  std::size_t get_total_free_blocks() const {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < lists_.size(); ++i) {
+      total += get_free_blocks(i);
+    }
+    return total;
+  }
+
+  /**
+   * @brief チャンクをフロンティアとして登録する（ブロックは積まない）。
+   */
+  void expand(std::size_t list_index, const BufferBlock &chunk,
+              std::size_t chunk_size, std::size_t block_size,
+              const LaunchParams & /*launch_params*/ = {}) {
+    ORTEAF_THROW_IF(resource_ == nullptr, InvalidState,
+                    "HostBumpFreelistPolicy is not initialized");
+    if (!chunk.valid() || block_size == 0 || chunk_size < block_size) {
+      return;
+    }
+
+    ensureCapacity(list_index);
+
+    const std::size_t base_offset = chunk.view.offset();
+    const std::size_t usable = (chunk_size / block_size) * block_size;
+    lists_[list_index].frontiers.pushBack(
+        Frontier{chunk, base_offset, base_offset + usable, block_size});
+  }
+
+  void removeBlocksInChunk(::orteaf::internal::base::BufferViewHandle handle) {
+    removeBlocksIf([&](const BufferViewHandle &block_handle) {
+      return block_handle == handle;
+    });
+  }
+
+  /**
+   * @brief 複数チャンクに属するブロックとフロンティアを 1 回の走査で取り除く。
+   * @param handles 昇順にソート済みのチャンクハンドル
+   */
+  void removeBlocksInChunks(
+      std::span<const ::orteaf::internal::base::BufferViewHandle> handles) {
+    if (handles.empty()) {
+      return;
+    }
+    removeBlocksIf([&](const BufferViewHandle &block_handle) {
+      return std::binary_search(handles.begin(), handles.end(), block_handle);
+    });
+  }
+
+private:
+  struct Frontier {
+    BufferBlock chunk{};
+    std::size_t next_offset{0};
+    std::size_t end_offset{0};
+    std::size_t block_size{0};
+
+    std::size_t remaining() const {
+      return (end_offset - next_offset) / block_size;
+    }
+  };
+
+  struct SizeClassList {
+    ::orteaf::internal::base::HeapVector<BufferBlock> recycled{};
+    ::orteaf::internal::base::HeapVector<Frontier> frontiers{};
+  };
+
+  template <typename Remove> void removeBlocksIf(Remove &&remove) {
+    for (auto &list : lists_) {
+      compact(list.recycled,
+              [&](const BufferBlock &block) { return remove(block.handle); });
+      compact(list.frontiers, [&](const Frontier &frontier) {
+        return remove(frontier.chunk.handle);
+      });
+    }
+  }
+
+  // remove(item) が true の要素を順序を保ったまま詰めて取り除く。
+  template <typename Vector, typename Remove>
+  static void compact(Vector &items, Remove &&remove) {
+    std::size_t write_idx = 0;
+    for (std::size_t i = 0; i < items.size(); ++i) {
+      if (remove(items[i])) {
+        continue;
+      }
+      if (write_idx != i) {
+        items[write_idx] = std::move(items[i]);
+      }
+      ++write_idx;
+    }
+    items.resize(write_idx);
+  }
+
+  void ensureCapacity(std::size_t list_index) {
+    if (list_index >= lists_.size()) {
+      lists_.resize(list_index + 1);
+    }
+  }
+
+  Resource *resource_{nullptr};
+  ::orteaf::internal::base::HeapVector<SizeClassList> lists_{};
+};
+
+} // namespace orteaf::internal::execution::allocator::policies
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <span>
 #include <utility>
 
 #include <orteaf/internal/execution/execution.h>
@@ -81,6 +83,13 @@ public:
     return stacks_.empty() ? 0 : 1;
   }
 
+  /**
+   * @brief 指定サイズクラスの空きブロック数。
+   */
+  std::size_t get_free_blocks(std::size_t list_index) const {
+    return list_index < stacks_.size() ? stacks_[list_index].size() : 0;
+  }
+
   std::size_t get_total_free_blocks() const {
     std::size_t total = 0;
     for (const auto &stack : stacks_) {
@@ -111,29 +120,42 @@ public:
   }
 
   void removeBlocksInChunk(::orteaf::internal::base::BufferViewHandle handle) {
-    for (auto &stack : stacks_) {
-      if (stack.empty()) {
-        continue;
-      }
+    removeBlocksIf([&](const BufferViewHandle &block_handle) {
+      return block_handle == handle;
+    });
+  }
 
-      ::orteaf::internal::base::HeapVector<BufferBlock> kept;
-      kept.reserve(stack.size());
+  /**
+   * @brief 複数チャンクに属するブロックを全スタック 1 回の走査で取り除く。
+   * @param handles 昇順にソート済みのチャンクハンドル
+   */
+  void removeBlocksInChunks(
+      std::span<const ::orteaf::internal::base::BufferViewHandle> handles) {
+    if (handles.empty()) {
+      return;
+    }
+    removeBlocksIf([&](const BufferViewHandle &block_handle) {
+      return std::binary_search(handles.begin(), handles.end(), block_handle);
+    });
+  }
 
-      while (!stack.empty()) {
-        BufferBlock top = std::move(stack.back());
-        stack.resize(stack.size() - 1);
-        if (top.handle != handle) {
-          kept.pushBack(std::move(top));
+private:
+  template <typename Remove> void removeBlocksIf(Remove &&remove) {
+    for (auto &stack : stacks_) {
+      std::size_t write_idx = 0;
+      for (std::size_t i = 0; i < stack.size(); ++i) {
+        if (remove(stack[i].handle)) {
+          continue;
         }
+        if (write_idx != i) {
+          stack[write_idx] = std::move(stack[i]);
+        }
+        ++write_idx;
       }
-
-      for (std::size_t i = 0; i < kept.size(); ++i) {
-        stack.pushBack(std::move(kept[i]));
-      }
+      stack.resize(write_idx);
     }
   }
 
-private:
   void ensureCapacity(std::size_t list_index) {
     if (list_index >= stacks_.size()) {
       stacks_.resize(list_index + 1);
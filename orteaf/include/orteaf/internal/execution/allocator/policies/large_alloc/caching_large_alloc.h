@@ -0,0 +1,463 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <set>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "orteaf/internal/base/handle.h"
+#include "orteaf/internal/base/heap_vector.h"
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/diagnostics/error/error_macros.h"
+#include "orteaf/internal/diagnostics/log/log.h"
+#include "orteaf/internal/execution/allocator/buffer.h"
+#include "orteaf/internal/execution/allocator/policies/policy_config.h"
+#include "orteaf/internal/execution/execution.h"
+
+namespace orteaf::internal::execution::allocator::policies {
+
+/**
+ * @brief 解放された large ブロックをキャッシュして再利用する LargeAlloc ポリシー。
+ *
+ * リソースから確保した領域（セグメント）を granularity 単位のブロックに分けて管理する。
+ *
+ * - allocate はサイズ順に並べた空きブロックから best-fit で選び、余りが
+ *   granularity 以上なら分割して空きに戻す。見つからなければ新しいセグメントを
+ *   確保する（確保に失敗した場合はキャッシュを全て返してから 1 回だけ再試行）。
+ *   失敗は空のビューと、リソースが投げる std::bad_alloc / OutOfMemory の
+ *   どちらでも検出する。
+ * - deallocate はリソースに返さず空きブロックに戻し、同じセグメント内で
+ *   隣接する空きブロックと結合する。
+ * - 空きブロックの合計が max_cached_bytes を超えたら、全体が空いている
+ *   セグメントを古い順にリソースへ返す。使用中ブロックを含むセグメントは
+ *   返せないため、その分は上限を超えて残りうる。全体が空いたセグメントは
+ *   解放順に別途追跡するので、上限超過中の deallocate も走査を伴わない。
+ *
+ * キャッシュはポリシーの破棄では返さない。releaseCached()
+ * （SegregatePool::releaseChunk から呼ばれる）で明示的に返すこと。
+ * スレッド安全性は呼び出し側（SegregatePool のロック）に委ねる。
+ */
+template <typename Resource> class CachingLargeAllocPolicy {
+public:
+  using BufferViewHandle = ::orteaf::internal::base::BufferViewHandle;
+  using BufferView = Resource::BufferView;
+  using BufferBlock = Resource::BufferBlock;
+
+  CachingLargeAllocPolicy() = default;
+  CachingLargeAllocPolicy(const CachingLargeAllocPolicy &) = delete;
+  CachingLargeAllocPolicy &operator=(const CachingLargeAllocPolicy &) = delete;
+  CachingLargeAllocPolicy(CachingLargeAllocPolicy &&other) noexcept
+      : resource_(std::exchange(other.resource_, nullptr)),
+        max_cached_bytes_(other.max_cached_bytes_),
+        granularity_(other.granularity_), blocks_(std::move(other.blocks_)),
+        free_block_slots_(std::move(other.free_block_slots_)),
+        segments_(std::move(other.segments_)),
+        free_segment_slots_(std::move(other.free_segment_slots_)),
+        free_by_size_(std::move(other.free_by_size_)),
+        idle_segments_(std::move(other.idle_segments_)),
+        cached_bytes_(std::exchange(other.cached_bytes_, 0)),
+        reserved_bytes_(std::exchange(other.reserved_bytes_, 0)),
+        live_blocks_(std::exchange(other.live_blocks_, 0)),
+        free_tick_(other.free_tick_), cache_hits_(other.cache_hits_),
+        cache_misses_(other.cache_misses_) {}
+  CachingLargeAllocPolicy &operator=(CachingLargeAllocPolicy &&other) noexcept {
+    if (this != &other) {
+      resource_ = std::exchange(other.resource_, nullptr);
+      max_cached_bytes_ = other.max_cached_bytes_;
+      granularity_ = other.granularity_;
+      blocks_ = std::move(other.blocks_);
+      free_block_slots_ = std::move(other.free_block_slots_);
+      segments_ = std::move(other.segments_);
+      free_segment_slots_ = std::move(other.free_segment_slots_);
+      free_by_size_ = std::move(other.free_by_size_);
+      idle_segments_ = std::move(other.idle_segments_);
+      cached_bytes_ = std::exchange(other.cached_bytes_, 0);
+      reserved_bytes_ = std::exchange(other.reserved_bytes_, 0);
+      live_blocks_ = std::exchange(other.live_blocks_, 0);
+      free_tick_ = other.free_tick_;
+      cache_hits_ = other.cache_hits_;
+      cache_misses_ = other.cache_misses_;
+    }
+    return *this;
+  }
+  ~CachingLargeAllocPolicy() = default;
+
+  struct Config : PolicyConfig<Resource> {
+    /// キャッシュに残す空きブロックの合計上限（0 ならキャッシュしない）
+    std::size_t max_cached_bytes{std::size_t{1} << 30};
+    /// ブロックサイズ・分割位置の単位（2 のべき乗）
+    std::size_t granularity{4096};
+  };
+
+  void initialize(const Config &config) {
+    ORTEAF_THROW_IF_NULL(
+        config.resource,
+        "CachingLargeAllocPolicy requires non-null Resource*");
+    ORTEAF_THROW_IF(config.granularity == 0 ||
+                        (config.granularity & (config.granularity - 1)) != 0,
+                    InvalidParameter,
+                    "CachingLargeAllocPolicy granularity must be a power of two");
+    resource_ = config.resource;
+    max_cached_bytes_ = config.max_cached_bytes;
+    granularity_ = config.granularity;
+  }
+
+  BufferBlock allocate(std::size_t size, std::size_t alignment) {
+    ORTEAF_THROW_IF(resource_ == nullptr, InvalidState,
+                    "CachingLargeAllocPolicy is not initialized");
+
+    if (size == 0) {
+      return {};
+    }
+
+    const std::size_t rounded = roundUp(size);
+    std::size_t index = takeCachedBlock(rounded, alignment);
+    if (index != kNone) {
+      ++cache_hits_;
+    } else {
+      index = addSegment(rounded, alignment);
+      if (index == kNone) {
+        return {};
+      }
+      ++cache_misses_;
+    }
+
+    Block &block = blocks_[index];
+    block.state = BlockState::InUse;
+#if ORTEAF_CORE_DEBUG_ENABLED
+    block.requested_size = size;
+    block.requested_alignment = alignment;
+#endif
+    ++live_blocks_;
+    const Segment &segment = segments_[block.segment];
+    return BufferBlock(encodeId(index),
+                       Resource::makeView(segment.view,
+                                          segment.view.offset() + block.offset,
+                                          size));
+  }
+
+  void deallocate(BufferViewHandle handle, std::size_t size,
+                  std::size_t alignment) {
+    if (!isLargeAlloc(handle)) {
+      return;
+    }
+
+    const std::size_t index = indexFromId(handle);
+    if (index >= blocks_.size() || blocks_[index].state != BlockState::InUse) {
+      return;
+    }
+
+#if ORTEAF_CORE_DEBUG_ENABLED
+    const Block &recorded = blocks_[index];
+    ORTEAF_LOG_DEBUG_IF(Core,
+                        recorded.requested_size != size ||
+                            recorded.requested_alignment != alignment,
+                        "LargeAlloc deallocate mismatch: recorded size=" +
+                            std::to_string(recorded.requested_size) +
+                            " align=" +
+                            std::to_string(recorded.requested_alignment) +
+                            " called size=" + std::to_string(size) +
+                            " align=" + std::to_string(alignment));
+#else
+    (void)size;
+    (void)alignment;
+#endif
+    --live_blocks_;
+    blocks_[index].state = BlockState::Free;
+
+    std::size_t merged = index;
+    const std::size_t prev = blocks_[merged].prev;
+    if (prev != kNone && blocks_[prev].state == BlockState::Free) {
+      eraseFree(prev);
+      absorbNext(prev);
+      merged = prev;
+    }
+    const std::size_t next = blocks_[merged].next;
+    if (next != kNone && blocks_[next].state == BlockState::Free) {
+      eraseFree(next);
+      absorbNext(merged);
+    }
+
+    blocks_[merged].freed_at = ++free_tick_;
+    insertFree(merged);
+    enforceCacheLimit();
+  }
+
+  /**
+   * @brief 全体が空いているセグメントを全てリソースへ返す。
+   * @return 返したバイト数
+   */
+  std::size_t releaseCached() {
+    std::size_t released = 0;
+    while (!idle_segments_.empty()) {
+      released += releaseSegment(idle_segments_.begin()->second);
+    }
+    return released;
+  }
+
+  bool isLargeAlloc(BufferViewHandle handle) const {
+    return (static_cast<BufferViewHandle::underlying_type>(handle) &
+            kLargeMask) != 0;
+  }
+
+  bool isAlive(BufferViewHandle handle) const {
+    if (!isLargeAlloc(handle)) {
+      return false;
+    }
+    const std::size_t index = indexFromId(handle);
+    return index < blocks_.size() && blocks_[index].state == BlockState::InUse;
+  }
+
+  /// 使用中の large ブロック数
+  std::size_t size() const { return live_blocks_; }
+  /// キャッシュされている空きブロックの合計バイト数
+  std::size_t cachedBytes() const { return cached_bytes_; }
+  /// リソースから確保しているセグメントの合計バイト数
+  std::size_t reservedBytes() const { return reserved_bytes_; }
+  std::uint64_t cacheHits() const { return cache_hits_; }
+  std::uint64_t cacheMisses() const { return cache_misses_; }
+
+private:
+  static constexpr BufferViewHandle::underlying_type kLargeMask =
+      BufferViewHandle::underlying_type{1u} << 31;
+  static constexpr BufferViewHandle::underlying_type kIndexMask = ~kLargeMask;
+  static constexpr std::size_t kNone = std::numeric_limits<std::size_t>::max();
+
+  enum class BlockState : std::uint8_t { Unused, Free, InUse };
+
+  struct Block {
+    std::size_t segment{kNone};
+    // セグメント先頭からのオフセット
+    std::size_t offset{0};
+    std::size_t size{0};
+    // 同じセグメント内でアドレス順に隣接するブロック
+    std::size_t prev{kNone};
+    std::size_t next{kNone};
+    std::uint64_t freed_at{0};
+    BlockState state{BlockState::Unused};
+#if ORTEAF_CORE_DEBUG_ENABLED
+    std::size_t requested_size{};
+    std::size_t requested_alignment{};
+#endif
+  };
+
+  struct Segment {
+    BufferView view{};
+    std::size_t size{0};
+    std::size_t alignment{0};
+  };
+
+  std::size_t roundUp(std::size_t size) const {
+    return (size + granularity_ - 1) & ~(granularity_ - 1);
+  }
+
+  bool satisfiesAlignment(const Block &block, std::size_t alignment) const {
+    if (alignment <= granularity_) {
+      return true;
+    }
+    return alignment <= segments_[block.segment].alignment &&
+           block.offset % alignment == 0;
+  }
+
+  /**
+   * @brief best-fit で空きブロックを取り出し、余りを分割して空きに戻す。
+   */
+  std::size_t takeCachedBlock(std::size_t rounded, std::size_t alignment) {
+    auto it = free_by_size_.lower_bound({rounded, 0});
+    while (it != free_by_size_.end() &&
+           !satisfiesAlignment(blocks_[it->second], alignment)) {
+      ++it;
+    }
+    if (it == free_by_size_.end()) {
+      return kNone;
+    }
+
+    const std::size_t index = it->second;
+    eraseFree(index);
+
+    const std::size_t remainder = blocks_[index].size - rounded;
+    if (remainder >= granularity_) {
+      const std::size_t rest = reserveBlockSlot();
+      Block &block = blocks_[index];
+      Block &tail = blocks_[rest];
+      tail.segment = block.segment;
+      tail.offset = block.offset + rounded;
+      tail.size = remainder;
+      tail.prev = index;
+      tail.next = block.next;
+      tail.state = BlockState::Free;
+      tail.freed_at = block.freed_at;
+      if (block.next != kNone) {
+        blocks_[block.next].prev = rest;
+      }
+      block.next = rest;
+      block.size = rounded;
+      insertFree(rest);
+    }
+    return index;
+  }
+
+  std::size_t addSegment(std::size_t rounded, std::size_t alignment) {
+    const std::size_t segment_alignment = std::max(alignment, granularity_);
+    BufferView view = tryAllocate(rounded, segment_alignment);
+    if (view.empty() && cached_bytes_ != 0) {
+      releaseCached();
+      view = resource_->allocate(rounded, segment_alignment);
+    }
+    if (view.empty()) {
+      return kNone;
+    }
+
+    std::size_t segment_index;
+    if (!free_segment_slots_.empty()) {
+      segment_index = free_segment_slots_.back();
+      free_segment_slots_.resize(free_segment_slots_.size() - 1);
+    } else {
+      segments_.emplaceBack();
+      segment_index = segments_.size() - 1;
+    }
+    segments_[segment_index] = Segment{view, rounded, segment_alignment};
+    reserved_bytes_ += rounded;
+
+    const std::size_t index = reserveBlockSlot();
+    Block &block = blocks_[index];
+    block.segment = segment_index;
+    block.offset = 0;
+    block.size = rounded;
+    block.prev = kNone;
+    block.next = kNone;
+    return index;
+  }
+
+  /**
+   * @brief 確保を試み、メモリ不足は空のビューとして返す（再試行の判定用）。
+   *
+   * CpuResource などは失敗時に空のビューではなく例外を投げる。
+   * メモリ不足以外の例外はそのまま伝播させる。
+   */
+  BufferView tryAllocate(std::size_t size, std::size_t alignment) {
+    if (cached_bytes_ == 0) {
+      return resource_->allocate(size, alignment);
+    }
+    try {
+      return resource_->allocate(size, alignment);
+    } catch (const std::bad_alloc &) {
+      return {};
+    } catch (const std::system_error &error) {
+      if (error.code() !=
+          ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfMemory) {
+        throw;
+      }
+      return {};
+    }
+  }
+
+  /**
+   * @brief 直後のブロックを index に結合する（どちらも空き集合から外してあること）。
+   */
+  void absorbNext(std::size_t index) {
+    Block &block = blocks_[index];
+    const std::size_t next = block.next;
+    block.size += blocks_[next].size;
+    block.next = blocks_[next].next;
+    if (block.next != kNone) {
+      blocks_[block.next].prev = index;
+    }
+    releaseBlockSlot(next);
+  }
+
+  static bool coversSegment(const Block &block) {
+    return block.prev == kNone && block.next == kNone;
+  }
+
+  // 空きブロックの隣接関係は空き集合に入っている間は変わらないため、
+  // セグメント全体が空いているかは登録時と除去時で一致する。
+  void insertFree(std::size_t index) {
+    const Block &block = blocks_[index];
+    free_by_size_.emplace(block.size, index);
+    if (coversSegment(block)) {
+      idle_segments_.emplace(block.freed_at, index);
+    }
+    cached_bytes_ += block.size;
+  }
+
+  void eraseFree(std::size_t index) {
+    const Block &block = blocks_[index];
+    free_by_size_.erase({block.size, index});
+    if (coversSegment(block)) {
+      idle_segments_.erase({block.freed_at, index});
+    }
+    cached_bytes_ -= block.size;
+  }
+
+  void enforceCacheLimit() {
+    while (cached_bytes_ > max_cached_bytes_ && !idle_segments_.empty()) {
+      releaseSegment(idle_segments_.begin()->second);
+    }
+  }
+
+  std::size_t releaseSegment(std::size_t index) {
+    eraseFree(index);
+    const std::size_t segment_index = blocks_[index].segment;
+    Segment &segment = segments_[segment_index];
+    const std::size_t bytes = segment.size;
+    resource_->deallocate(segment.view, segment.size, segment.alignment);
+    reserved_bytes_ -= bytes;
+    segment = Segment{};
+    free_segment_slots_.pushBack(segment_index);
+    releaseBlockSlot(index);
+    return bytes;
+  }
+
+  std::size_t reserveBlockSlot() {
+    if (!free_block_slots_.empty()) {
+      const auto index = free_block_slots_.back();
+      free_block_slots_.resize(free_block_slots_.size() - 1);
+      return index;
+    }
+    blocks_.emplaceBack();
+    return blocks_.size() - 1;
+  }
+
+  void releaseBlockSlot(std::size_t index) {
+    blocks_[index] = Block{};
+    free_block_slots_.pushBack(index);
+  }
+
+  BufferViewHandle encodeId(std::size_t index) const {
+    return BufferViewHandle{
+        static_cast<BufferViewHandle::underlying_type>(index) | kLargeMask};
+  }
+
+  std::size_t indexFromId(BufferViewHandle handle) const {
+    return static_cast<std::size_t>(
+        static_cast<BufferViewHandle::underlying_type>(handle) & kIndexMask);
+  }
+
+  Resource *resource_{nullptr};
+  std::size_t max_cached_bytes_{0};
+  std::size_t granularity_{4096};
+
+  ::orteaf::internal::base::HeapVector<Block> blocks_;
+  ::orteaf::internal::base::HeapVector<std::size_t> free_block_slots_;
+  ::orteaf::internal::base::HeapVector<Segment> segments_;
+  ::orteaf::internal::base::HeapVector<std::size_t> free_segment_slots_;
+  // (サイズ, ブロック番号) 順の空きブロック。best-fit の探索に使う
+  std::set<std::pair<std::size_t, std::size_t>> free_by_size_;
+  // (解放順, ブロック番号) 順の、セグメント全体を占める空きブロック
+  std::set<std::pair<std::uint64_t, std::size_t>> idle_segments_;
+
+  std::size_t cached_bytes_{0};
+  std::size_t reserved_bytes_{0};
+  std::size_t live_blocks_{0};
+  std::uint64_t free_tick_{0};
+  std::uint64_t cache_hits_{0};
+  std::uint64_t cache_misses_{0};
+};
+
+} // namespace orteaf::internal::execution::allocator::policies
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
+#include <span>
 #include <thread>
 #include <utility>
 
@@ -115,8 +117,27 @@ public:
   }
 
   void removeBlocksInChunk(const BufferViewHandle &chunk_handle) {
-    filterPending(chunk_handle);
-    filterReady(chunk_handle);
+    auto in_chunk = [&](const BufferViewHandle &handle) {
+      return handle == chunk_handle;
+    };
+    filterPending(in_chunk);
+    filterReady(in_chunk);
+  }
+
+  /**
+   * @brief 複数チャンクに属するブロックを 1 回の走査でまとめて取り除く。
+   * @param chunk_handles 昇順にソート済みのチャンクハンドル
+   */
+  void removeBlocksInChunks(std::span<const BufferViewHandle> chunk_handles) {
+    if (chunk_handles.empty()) {
+      return;
+    }
+    auto in_chunks = [&](const BufferViewHandle &handle) {
+      return std::binary_search(chunk_handles.begin(), chunk_handles.end(),
+                                handle);
+    };
+    filterPending(in_chunks);
+    filterReady(in_chunks);
   }
 
   void setTimeout(std::chrono::milliseconds timeout_ms) {
@@ -136,24 +157,28 @@ private:
     std::size_t freelist_index;
   };
 
-  void filterPending(const BufferViewHandle &chunk_handle) {
-    ::orteaf::internal::base::HeapVector<PendingReuse> filtered;
-    for (std::size_t i = 0; i < pending_queue_.size(); ++i) {
-      if (pending_queue_[i].block.handle != chunk_handle) {
-        filtered.pushBack(std::move(pending_queue_[i]));
+  // remove(handle) が true の要素を順序を保ったまま詰めて取り除く。
+  template <typename Queue, typename Remove>
+  static void filterQueue(Queue &queue, Remove &&remove) {
+    std::size_t write_idx = 0;
+    for (std::size_t i = 0; i < queue.size(); ++i) {
+      if (remove(queue[i].block.handle)) {
+        continue;
       }
+      if (write_idx != i) {
+        queue[write_idx] = std::move(queue[i]);
+      }
+      ++write_idx;
     }
-    pending_queue_ = std::move(filtered);
+    queue.resize(write_idx);
   }
 
-  void filterReady(const BufferViewHandle &chunk_handle) {
-    ::orteaf::internal::base::HeapVector<ReadyReuse> filtered;
-    for (std::size_t i = 0; i < ready_queue_.size(); ++i) {
-      if (ready_queue_[i].block.handle != chunk_handle) {
-        filtered.pushBack(std::move(ready_queue_[i]));
-      }
-    }
-    ready_queue_ = std::move(filtered);
+  template <typename Remove> void filterPending(Remove &&remove) {
+    filterQueue(pending_queue_, remove);
+  }
+
+  template <typename Remove> void filterReady(Remove &&remove) {
+    filterQueue(ready_queue_, remove);
   }
 
   ::orteaf::internal::base::HeapVector<PendingReuse> pending_queue_{};
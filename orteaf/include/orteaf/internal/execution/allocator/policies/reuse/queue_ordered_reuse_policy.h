@@ -0,0 +1,322 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <thread>
+#include <utility>
+
+#include <orteaf/internal/base/handle.h>
+#include <orteaf/internal/base/heap_vector.h>
+#include <orteaf/internal/diagnostics/error/error_macros.h>
+#include <orteaf/internal/execution/allocator/buffer.h>
+#include <orteaf/internal/execution/allocator/policies/policy_config.h>
+#include <orteaf/internal/execution/execution.h>
+
+namespace orteaf::internal::execution::allocator::policies {
+
+/**
+ * @brief ReuseToken を完了順序の保証されたキュー（stream / command queue）に
+ * 対応付けられる Resource。
+ *
+ * reuseQueueKey(token) は、同じキーを返すトークン同士が scheduleForReuse
+ * された順に完了することを保証できる場合にのみキーを返す。
+ * 保証できない（複数キューにまたがる等）場合は std::nullopt を返す。
+ * CpuResource は処理が同期的なため、全トークンを単一のキー 0 に対応付ける。
+ */
+template <typename Resource>
+concept OrderedReuseQueueResource =
+    requires(Resource &resource, const typename Resource::ReuseToken &token) {
+      {
+        resource.reuseQueueKey(token)
+      } -> std::convertible_to<std::optional<std::uint64_t>>;
+    };
+
+/**
+ * @brief キュー単位の FIFO で完了待ちブロックを管理する再利用ポリシー。
+ *
+ * DeferredReusePolicy と同じインターフェースを持つ。
+ * mps_fence_hazard_manager.md の FIFO 解放アルゴリズムと同様に、
+ * 同一キュー上では完了順序が保持されることを利用し、
+ * 最新の要素が完了していれば FIFO 全体をまとめて ready にする。
+ * 最新が未完了の場合は先頭を確認し、先頭も未完了なら何もしない。
+ * それ以外は二分探索で完了済みの境界を求める。
+ * 1 キューあたりの isCompleted 呼び出しは O(log n) に収まり、
+ * 完了待ちブロックが数千件あっても processPending のコストが線形に伸びない。
+ *
+ * Resource が OrderedReuseQueueResource を満たさない場合、またはキーが
+ * std::nullopt の場合は順序なしリストに入り、DeferredReusePolicy と同様に
+ * 1 件ずつ確認する。
+ */
+template <typename Resource> class QueueOrderedReusePolicy {
+public:
+  static constexpr auto kExecution = Resource::execution_type_static();
+  using BufferResource = typename Resource::BufferResource;
+  using BufferBlock =
+      ::orteaf::internal::execution::allocator::ExecutionBufferBlock<
+          kExecution>;
+  using BufferView = typename BufferResource::BufferView;
+  using BufferViewHandle = typename BufferResource::BufferViewHandle;
+  using ReuseToken = typename Resource::ReuseToken;
+
+  QueueOrderedReusePolicy() = default;
+  QueueOrderedReusePolicy(const QueueOrderedReusePolicy &) = delete;
+  QueueOrderedReusePolicy &operator=(const QueueOrderedReusePolicy &) = delete;
+  QueueOrderedReusePolicy(QueueOrderedReusePolicy &&) = default;
+  QueueOrderedReusePolicy &operator=(QueueOrderedReusePolicy &&) = default;
+  ~QueueOrderedReusePolicy() = default;
+
+  struct Config : PolicyConfig<Resource> {};
+
+  void initialize(const Config &config = {}) {
+    ORTEAF_THROW_IF_NULL(config.resource,
+                         "QueueOrderedReusePolicy requires non-null Resource*");
+    resource_ = config.resource;
+  }
+
+  void scheduleForReuse(BufferResource block, std::size_t freelist_index) {
+    ORTEAF_THROW_IF(resource_ == nullptr, InvalidState,
+                    "QueueOrderedReusePolicy is not initialized");
+    PendingReuse pending{BufferBlock{block.handle, std::move(block.view)},
+                         std::move(block.reuse_token), freelist_index};
+    const std::optional<std::uint64_t> key = queueKeyOf(pending.reuse_token);
+    if (!key.has_value()) {
+      unordered_queue_.pushBack(std::move(pending));
+      return;
+    }
+    queueFor(*key).items.pushBack(std::move(pending));
+  }
+
+  /**
+   * @brief 完了済みのブロックを ready キューへ移す。
+   * @return 新たに ready になったブロック数
+   */
+  std::size_t processPending() {
+    ORTEAF_THROW_IF(resource_ == nullptr, InvalidState,
+                    "QueueOrderedReusePolicy is not initialized");
+    std::size_t ready_count = 0;
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      ready_count += processQueue(queues_[i]);
+    }
+    ready_count += processUnordered();
+    return ready_count;
+  }
+
+  bool hasPending() const { return pendingCount() > 0; }
+
+  std::size_t getPendingReuseCount() const {
+    return pendingCount() + ready_queue_.size();
+  }
+
+  /**
+   * @brief 順序付きキューの数（キーごとに 1 つ）。
+   */
+  std::size_t orderedQueueCount() const { return queues_.size(); }
+
+  void flushPending() {
+    while (hasPending()) {
+      const auto processed = processPending();
+      if (processed == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+  }
+
+  bool getReadyItem(std::size_t &freelist_index, BufferBlock &result) {
+    if (ready_queue_.empty())
+      return false;
+    ReadyReuse item = std::move(ready_queue_.back());
+    ready_queue_.resize(ready_queue_.size() - 1);
+
+    result = std::move(item.block);
+    freelist_index = item.freelist_index;
+    return true;
+  }
+
+  void removeBlocksInChunk(const BufferViewHandle &chunk_handle) {
+    removeBlocksIf([&](const BufferViewHandle &handle) {
+      return handle == chunk_handle;
+    });
+  }
+
+  /**
+   * @brief 複数チャンクに属するブロックを 1 回の走査でまとめて取り除く。
+   * @param chunk_handles 昇順にソート済みのチャンクハンドル
+   */
+  void removeBlocksInChunks(std::span<const BufferViewHandle> chunk_handles) {
+    if (chunk_handles.empty()) {
+      return;
+    }
+    removeBlocksIf([&](const BufferViewHandle &handle) {
+      return std::binary_search(chunk_handles.begin(), chunk_handles.end(),
+                                handle);
+    });
+  }
+
+private:
+  struct PendingReuse {
+    BufferBlock block;
+    ReuseToken reuse_token;
+    std::size_t freelist_index;
+  };
+
+  struct ReadyReuse {
+    BufferBlock block;
+    std::size_t freelist_index;
+  };
+
+  // items[head, size) が未処理。head が半分を超えたら前詰めする。
+  struct OrderedQueue {
+    std::uint64_t key{0};
+    ::orteaf::internal::base::HeapVector<PendingReuse> items{};
+    std::size_t head{0};
+
+    std::size_t pending() const { return items.size() - head; }
+  };
+
+  std::optional<std::uint64_t> queueKeyOf(const ReuseToken &token) {
+    if constexpr (OrderedReuseQueueResource<Resource>) {
+      return resource_->reuseQueueKey(token);
+    } else {
+      return std::nullopt;
+    }
+  }
+
+  // キュー数は stream / command queue の数程度なので線形探索で十分。
+  OrderedQueue &queueFor(std::uint64_t key) {
+    if (last_queue_ < queues_.size() && queues_[last_queue_].key == key) {
+      return queues_[last_queue_];
+    }
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      if (queues_[i].key == key) {
+        last_queue_ = i;
+        return queues_[i];
+      }
+    }
+    queues_.emplaceBack();
+    last_queue_ = queues_.size() - 1;
+    queues_.back().key = key;
+    return queues_.back();
+  }
+
+  bool isCompleted(PendingReuse &item) {
+    return resource_->isCompleted(item.reuse_token);
+  }
+
+  std::size_t processQueue(OrderedQueue &queue) {
+    if (queue.pending() == 0) {
+      return 0;
+    }
+    const std::size_t last = queue.items.size() - 1;
+    std::size_t boundary = queue.head;
+    if (isCompleted(queue.items[last])) {
+      boundary = queue.items.size();
+    } else if (queue.head < last && isCompleted(queue.items[queue.head])) {
+      // items[head] は完了、items[last] は未完了。最初の未完了要素を探す。
+      std::size_t lo = queue.head + 1;
+      std::size_t hi = last;
+      while (lo < hi) {
+        const std::size_t mid = lo + (hi - lo) / 2;
+        if (isCompleted(queue.items[mid])) {
+          lo = mid + 1;
+        } else {
+          hi = mid;
+        }
+      }
+      boundary = lo;
+    }
+
+    const std::size_t released = boundary - queue.head;
+    for (std::size_t i = queue.head; i < boundary; ++i) {
+      PendingReuse &item = queue.items[i];
+      ready_queue_.emplaceBack(
+          ReadyReuse{std::move(item.block), item.freelist_index});
+    }
+    queue.head = boundary;
+    compactQueue(queue);
+    return released;
+  }
+
+  std::size_t processUnordered() {
+    std::size_t ready_count = 0;
+    std::size_t write_idx = 0;
+    for (std::size_t i = 0; i < unordered_queue_.size(); ++i) {
+      PendingReuse &item = unordered_queue_[i];
+      if (isCompleted(item)) {
+        ready_queue_.emplaceBack(
+            ReadyReuse{std::move(item.block), item.freelist_index});
+        ++ready_count;
+        continue;
+      }
+      if (write_idx != i) {
+        unordered_queue_[write_idx] = std::move(item);
+      }
+      ++write_idx;
+    }
+    unordered_queue_.resize(write_idx);
+    return ready_count;
+  }
+
+  static void compactQueue(OrderedQueue &queue) {
+    if (queue.head == queue.items.size()) {
+      queue.items.clear();
+      queue.head = 0;
+      return;
+    }
+    if (queue.head * 2 < queue.items.size()) {
+      return;
+    }
+    const std::size_t remaining = queue.pending();
+    for (std::size_t i = 0; i < remaining; ++i) {
+      queue.items[i] = std::move(queue.items[queue.head + i]);
+    }
+    queue.items.resize(remaining);
+    queue.head = 0;
+  }
+
+  std::size_t pendingCount() const {
+    std::size_t total = unordered_queue_.size();
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      total += queues_[i].pending();
+    }
+    return total;
+  }
+
+  // remove(handle) が true の要素を順序を保ったまま詰めて取り除く。
+  template <typename Queue, typename Remove>
+  static void filterQueue(Queue &queue, std::size_t begin, Remove &&remove) {
+    std::size_t write_idx = 0;
+    for (std::size_t i = begin; i < queue.size(); ++i) {
+      if (remove(queue[i].block.handle)) {
+        continue;
+      }
+      if (write_idx != i) {
+        queue[write_idx] = std::move(queue[i]);
+      }
+      ++write_idx;
+    }
+    queue.resize(write_idx);
+  }
+
+  template <typename Remove> void removeBlocksIf(Remove &&remove) {
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      OrderedQueue &queue = queues_[i];
+      filterQueue(queue.items, queue.head, remove);
+      queue.head = 0;
+    }
+    filterQueue(unordered_queue_, 0, remove);
+    filterQueue(ready_queue_, 0, remove);
+  }
+
+  ::orteaf::internal::base::HeapVector<OrderedQueue> queues_{};
+  ::orteaf::internal::base::HeapVector<PendingReuse> unordered_queue_{};
+  ::orteaf::internal::base::HeapVector<ReadyReuse> ready_queue_{};
+  std::size_t last_queue_{0};
+  Resource *resource_{nullptr};
+};
+
+} // namespace orteaf::internal::execution::allocator::policies
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <concepts>
+#include <cstddef>
+#include <memory>
 #include <mutex>
 
 #include "orteaf/internal/execution/allocator/policies/policy_config.h"
@@ -22,13 +25,127 @@ public:
   template <typename Resource> void initialize(const Config<Resource> &) {}
 
   void lock() { mutex_.lock(); }
+  bool try_lock() { return mutex_.try_lock(); }
   void unlock() { mutex_.unlock(); }
 
 private:
   std::mutex mutex_;
 };
 
+// Per-size-class locking policy for multi-threaded contexts.
+//
+// Each size class gets its own mutex so that threads allocating different
+// sizes do not contend. Large allocations use a separate mutex. Chunk
+// expansion takes only the chunk mutex (lockChunks()) plus the expanding
+// class's mutex, so other classes keep allocating meanwhile; the resource
+// must therefore accept concurrent allocate calls from the chunk and large
+// paths. Chunk release and other whole-pool operations take the chunk mutex
+// followed by every shard mutex via lock(), so std::lock_guard<Policy> keeps
+// the exclusive semantics of LockingThreadingPolicy.
+//
+// Lock order: chunk -> size class 0..N-1 -> large. Callers holding a single
+// size-class or large lock must not acquire another one.
+class SizeClassShardedThreadingPolicy {
+public:
+  template <typename Resource> using Config = PolicyConfig<Resource>;
+
+  SizeClassShardedThreadingPolicy() = default;
+  SizeClassShardedThreadingPolicy(const SizeClassShardedThreadingPolicy &) =
+      delete;
+  SizeClassShardedThreadingPolicy &
+  operator=(const SizeClassShardedThreadingPolicy &) = delete;
+  // std::mutex is not movable, so we delete move operations
+  SizeClassShardedThreadingPolicy(SizeClassShardedThreadingPolicy &&) = delete;
+  SizeClassShardedThreadingPolicy &
+  operator=(SizeClassShardedThreadingPolicy &&) = delete;
+  ~SizeClassShardedThreadingPolicy() = default;
+
+  template <typename Resource> void initialize(const Config<Resource> &) {}
+
+  // Must be called before the policy is shared between threads.
+  void configureSizeClasses(std::size_t size_class_count) {
+    shards_ = std::make_unique<Shard[]>(size_class_count);
+    shard_count_ = size_class_count;
+  }
+
+  std::size_t size_class_count() const { return shard_count_; }
+
+  void lockSizeClass(std::size_t index) { shards_[index].mutex.lock(); }
+  void unlockSizeClass(std::size_t index) { shards_[index].mutex.unlock(); }
+
+  void lockLarge() { large_mutex_.lock(); }
+  void unlockLarge() { large_mutex_.unlock(); }
+
+  void lockChunks() { chunk_mutex_.lock(); }
+  void unlockChunks() { chunk_mutex_.unlock(); }
+
+  void lock() {
+    chunk_mutex_.lock();
+    for (std::size_t i = 0; i < shard_count_; ++i) {
+      shards_[i].mutex.lock();
+    }
+    large_mutex_.lock();
+  }
+
+  // Takes every lock in lock() order, backing out if any of them is held.
+  bool try_lock() {
+    if (!chunk_mutex_.try_lock()) {
+      return false;
+    }
+    std::size_t locked = 0;
+    while (locked < shard_count_ && shards_[locked].mutex.try_lock()) {
+      ++locked;
+    }
+    if (locked == shard_count_ && large_mutex_.try_lock()) {
+      return true;
+    }
+    for (std::size_t i = locked; i > 0; --i) {
+      shards_[i - 1].mutex.unlock();
+    }
+    chunk_mutex_.unlock();
+    return false;
+  }
+
+  void unlock() {
+    large_mutex_.unlock();
+    for (std::size_t i = shard_count_; i > 0; --i) {
+      shards_[i - 1].mutex.unlock();
+    }
+    chunk_mutex_.unlock();
+  }
+
+private:
+  // Keep each shard on its own cache line to avoid false sharing.
+  struct alignas(64) Shard {
+    std::mutex mutex;
+  };
+
+  std::unique_ptr<Shard[]> shards_{};
+  std::size_t shard_count_{0};
+  std::mutex chunk_mutex_;
+  alignas(64) std::mutex large_mutex_;
+};
+
+// Threading policies that expose per-size-class locks. SegregatePool uses the
+// fine-grained paths when this concept is satisfied.
+template <typename Policy>
+concept SizeClassShardedThreading =
+    requires(Policy policy, std::size_t index) {
+      policy.configureSizeClasses(index);
+      policy.lockSizeClass(index);
+      policy.unlockSizeClass(index);
+      policy.lockLarge();
+      policy.unlockLarge();
+      policy.lockChunks();
+      policy.unlockChunks();
+      policy.lock();
+      policy.unlock();
+    };
+
 // No-op threading policy for single-threaded contexts.
+//
+// Deliberately has no try_lock(): pools using it cannot be trimmed from a
+// background thread.
 class NoLockThreadingPolicy {
 public:
   template <typename Resource> using Config = PolicyConfig<Resource>;
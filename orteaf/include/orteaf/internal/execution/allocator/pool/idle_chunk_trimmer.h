@@ -0,0 +1,183 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include <orteaf/internal/diagnostics/error/error_macros.h>
+#include <orteaf/internal/execution/allocator/pool/segregate_pool.h>
+
+namespace orteaf::internal::execution::allocator::pool {
+
+/**
+ * @brief アイドルなチャンクをバックグラウンドで OS に返すトリマー（opt-in）。
+ *
+ * interval ごとにプールのアイドルエポックを進め、idle_threshold 以上
+ * アイドルなチャンクと、budget_bytes を超えている分のアイドルチャンクを
+ * SegregatePool::trimIdleChunks で解放する。
+ *
+ * - プールのロックは try_lock でのみ取る。競合していればその回は諦め、
+ *   次の interval で再試行するので、allocate/deallocate がトリマーを待つのは
+ *   トリマーがロックを保持している間（最大 max_chunks_per_pass 個の解放）だけ。
+ * - アイドル時間はエポック単位で測るため、実際に解放されるまでの時間は
+ *   idle_threshold 以上 idle_threshold + interval 未満になる。
+ * - start() には try_lock を持つ ThreadingPolicy（Locking / SizeClassSharded）が
+ *   必要。NoLock のプールでも runOnce() を所有スレッドから呼ぶことはできる。
+ *
+ * プール本体は所有しない。トリマーはプールより先に破棄（または stop）すること。
+ *
+ * @tparam Pool SegregatePool インスタンス型
+ */
+template <typename Pool> class IdleChunkTrimmer {
+public:
+  using LaunchParams = typename Pool::LaunchParams;
+
+  struct Config {
+    /// エポックを進めてトリムを試みる間隔
+    std::chrono::milliseconds interval{1000};
+    /// このアイドル時間を超えたチャンクを解放する
+    std::chrono::milliseconds idle_threshold{30000};
+    /// 0 以外ならチャンク総量がこれを超えている間、新しいアイドルチャンクも解放する
+    std::size_t budget_bytes{0};
+    /// 1 回のトリムで解放するチャンク数の上限（0 は無制限）
+    std::size_t max_chunks_per_pass{64};
+  };
+
+  explicit IdleChunkTrimmer(Pool &pool) : IdleChunkTrimmer(pool, Config{}) {}
+
+  IdleChunkTrimmer(Pool &pool, const Config &config)
+      : pool_(pool), config_(config) {
+    ORTEAF_THROW_IF(config_.interval.count() <= 0, InvalidParameter,
+                    "IdleChunkTrimmer interval must be positive");
+  }
+
+  IdleChunkTrimmer(const IdleChunkTrimmer &) = delete;
+  IdleChunkTrimmer &operator=(const IdleChunkTrimmer &) = delete;
+  IdleChunkTrimmer(IdleChunkTrimmer &&) = delete;
+  IdleChunkTrimmer &operator=(IdleChunkTrimmer &&) = delete;
+
+  ~IdleChunkTrimmer() { stop(); }
+
+  /**
+   * @brief バックグラウンドスレッドを起動する（起動済みなら何もしない）。
+   */
+  void start() {
+    static_assert(Pool::kSupportsBackgroundTrim,
+                  "IdleChunkTrimmer::start requires a ThreadingPolicy with "
+                  "try_lock()");
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (thread_.joinable()) {
+      return;
+    }
+    stop_requested_ = false;
+    thread_ = std::thread([this] { run(); });
+  }
+
+  /**
+   * @brief バックグラウンドスレッドを止めて join する。
+   */
+  void stop() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!thread_.joinable()) {
+        return;
+      }
+      stop_requested_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+  }
+
+  bool running() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return thread_.joinable();
+  }
+
+  /**
+   * @brief エポックを 1 つ進めて 1 回トリムする。
+   *
+   * バックグラウンドスレッドから interval ごとに呼ばれる。テストや
+   * 明示的なタイミングで回したい場合は直接呼んでもよい。
+   */
+  ChunkTrimResult runOnce() {
+    pool_.advanceIdleEpoch();
+
+    ChunkTrimOptions options{};
+    options.min_idle_epochs = minIdleEpochs();
+    options.budget_bytes = config_.budget_bytes;
+    options.max_chunks = config_.max_chunks_per_pass;
+    options.try_only = Pool::kSupportsBackgroundTrim;
+
+    const ChunkTrimResult result = pool_.trimIdleChunks(options, launch_params_);
+    passes_.fetch_add(1, std::memory_order_relaxed);
+    if (!result.acquired) {
+      contended_passes_.fetch_add(1, std::memory_order_relaxed);
+    }
+    released_chunks_.fetch_add(result.released_chunks,
+                               std::memory_order_relaxed);
+    released_bytes_.fetch_add(result.released_bytes, std::memory_order_relaxed);
+    return result;
+  }
+
+  /**
+   * @brief idle_threshold を満たすのに必要なエポック数。
+   *
+   * チャンクはエポックの途中でアイドルになりうるため 1 エポック分を上乗せする。
+   */
+  std::uint64_t minIdleEpochs() const {
+    if (config_.idle_threshold.count() <= 0) {
+      return 0;
+    }
+    const auto interval = config_.interval.count();
+    return static_cast<std::uint64_t>(
+               (config_.idle_threshold.count() + interval - 1) / interval) +
+           1;
+  }
+
+  const Config &config() const { return config_; }
+
+  std::uint64_t passes() const { return passes_.load(std::memory_order_relaxed); }
+  std::uint64_t contendedPasses() const {
+    return contended_passes_.load(std::memory_order_relaxed);
+  }
+  std::uint64_t releasedChunks() const {
+    return released_chunks_.load(std::memory_order_relaxed);
+  }
+  std::uint64_t releasedBytes() const {
+    return released_bytes_.load(std::memory_order_relaxed);
+  }
+
+private:
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_requested_) {
+      if (wake_.wait_for(lock, config_.interval,
+                         [this] { return stop_requested_; })) {
+        break;
+      }
+      lock.unlock();
+      runOnce();
+      lock.lock();
+    }
+  }
+
+  Pool &pool_;
+  Config config_;
+  LaunchParams launch_params_{};
+
+  mutable std::mutex mutex_;
+  std::condition_variable wake_;
+  std::thread thread_;
+  bool stop_requested_{false};
+
+  std::atomic<std::uint64_t> passes_{0};
+  std::atomic<std::uint64_t> contended_passes_{0};
+  std::atomic<std::uint64_t> released_chunks_{0};
+  std::atomic<std::uint64_t> released_bytes_{0};
+};
+
+} // namespace orteaf::internal::execution::allocator::pool
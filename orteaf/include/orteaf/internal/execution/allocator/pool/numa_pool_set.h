@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include <orteaf/internal/base/heap_vector.h>
+#include <orteaf/internal/diagnostics/error/error_macros.h>
+#include <orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h>
+
+namespace orteaf::internal::execution::allocator::pool {
+
+/**
+ * @brief NUMA ノードごとに SegregatePool を 1 つずつ持つプール集合。
+ *
+ * プール i は i 番目のオンラインノードに対応し、そのカーネルノード ID
+ * （nodeId(i)）を渡した Resource で構築される。ノード ID は疎でありうる
+ * （例: 0 と 2 のみ）ため、プールの添字とノード ID は一致するとは限らない。
+ * Resource が CpuNumaResource のようにノードを受け取る場合はチャンクがそのノードに
+ * 配置される。localPool() は呼び出しスレッドが現在動作しているノードの ID を
+ * 添字に変換し、そのプールを返す。
+ *
+ * ブロックは確保したプールへ返す必要がある（サイズと同様に呼び出し側が保持する）。
+ * スレッドがノード間を移動した後に localPool() で解放してはならない。
+ *
+ * シングルノード環境ではプールは 1 つだけになり、localPool() は常にそれを返す。
+ *
+ * @tparam Pool SegregatePool インスタンス型
+ */
+template <typename Pool> class NumaPoolSet {
+public:
+  using Resource =
+      std::remove_cvref_t<decltype(*std::declval<Pool &>().resource())>;
+  using Config = typename Pool::Config;
+
+  /**
+   * @param node_count プール数。0 の場合は検出した NUMA ノード数を使う。
+   */
+  explicit NumaPoolSet(std::size_t node_count = 0) {
+    if (node_count == 0) {
+      node_count = ::orteaf::internal::execution::cpu::platform::wrapper::
+          numaNodeCount();
+    }
+    pools_.reserve(node_count);
+    for (std::size_t index = 0; index < node_count; ++index) {
+      pools_.pushBack(std::make_unique<Pool>(Resource{nodeId(index)}));
+    }
+  }
+
+  NumaPoolSet(const NumaPoolSet &) = delete;
+  NumaPoolSet &operator=(const NumaPoolSet &) = delete;
+  NumaPoolSet(NumaPoolSet &&) = default;
+  NumaPoolSet &operator=(NumaPoolSet &&) = default;
+  ~NumaPoolSet() = default;
+
+  /**
+   * @brief 全ノードのプールを同じ設定で初期化する。
+   *
+   * 各ポリシー設定の resource は、そのノードのプール自身の Resource に
+   * 差し替えられる。
+   */
+  void initialize(const Config &config) {
+    for (std::size_t node = 0; node < pools_.size(); ++node) {
+      Pool &target = *pools_[node];
+      Config node_config = config;
+      node_config.fast_free.resource = target.resource();
+      node_config.threading.resource = target.resource();
+      node_config.large_alloc.resource = target.resource();
+      node_config.chunk_locator.resource = target.resource();
+      node_config.reuse.resource = target.resource();
+      node_config.freelist.resource = target.resource();
+      target.initialize(node_config);
+    }
+  }
+
+  std::size_t node_count() const { return pools_.size(); }
+
+  /**
+   * @brief プール index が担当するカーネルノード ID。
+   *
+   * 検出したノード数を超える添字は先頭のオンラインノードを担当する。
+   */
+  static std::size_t nodeId(std::size_t index) {
+    return ::orteaf::internal::execution::cpu::platform::wrapper::numaNodeId(
+        index);
+  }
+
+  Pool &pool(std::size_t node) {
+    ORTEAF_THROW_IF(node >= pools_.size(), OutOfRange,
+                    "NumaPoolSet node index out of range");
+    return *pools_[node];
+  }
+
+  /**
+   * @brief 呼び出しスレッドが動作しているノードのプール添字（範囲外なら 0）。
+   */
+  std::size_t currentNode() const {
+    namespace wrapper = ::orteaf::internal::execution::cpu::platform::wrapper;
+    const std::size_t index = wrapper::numaNodeIndex(wrapper::currentNumaNode());
+    return index < pools_.size() ? index : 0;
+  }
+
+  Pool &localPool() { return *pools_[currentNode()]; }
+
+private:
+  ::orteaf::internal::base::HeapVector<std::unique_ptr<Pool>> pools_{};
+};
+
+} // namespace orteaf::internal::execution::allocator::pool
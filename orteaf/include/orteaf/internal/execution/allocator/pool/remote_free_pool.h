@@ -0,0 +1,205 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+#include <orteaf/internal/base/bounded_mpsc_queue.h>
+#include <orteaf/internal/base/heap_vector.h>
+
+namespace orteaf::internal::execution::allocator::pool {
+
+/**
+ * @brief 所有スレッド以外からの解放を lock-free キューで受け取る SegregatePool の前段。
+ *
+ * あるスレッドが確保したブロックを別スレッドが解放するパイプライン
+ * （producer が確保し consumer が解放する）向け。mimalloc の thread-free リストと同様に、
+ *
+ * - 所有スレッド以外の deallocate は、サイズクラスごとの MPSC キューへ
+ *   push するだけでプールのロックを取らない。
+ * - 所有スレッドは次にそのサイズクラスを allocate するときにキューを回収し、
+ *   SegregatePool::deallocateBatch でまとめてプールへ返す。
+ *
+ * チャンクは 1 つのサイズクラス専用に切り出されるため、サイズクラスごとの
+ * キューはそのクラスのチャンク群に付いたキューと同じ役割を持つ。
+ * キューが満杯のとき、large サイズ、所有スレッド自身の解放は
+ * 通常どおりプールへ直接返す。
+ * キュー満杯時と large サイズでは所有スレッド以外からもプールを直接呼ぶため、
+ * Pool の ThreadingPolicy は排他するもの（NoLockThreadingPolicy 以外）に限る。
+ *
+ * キュー内のブロックは ChunkLocator 上 used として計上されたままなので、
+ * 回収されるまでチャンクは解放対象にならない。
+ * プール本体は所有しない（寿命は呼び出し側が管理する）。
+ *
+ * @tparam Pool SegregatePool インスタンス型
+ */
+template <typename Pool> class RemoteFreePool {
+  static_assert(Pool::kThreadSafe,
+                "RemoteFreePool requires a Pool whose ThreadingPolicy locks");
+
+public:
+  using BufferResource = typename Pool::BufferResource;
+  using LaunchParams = typename Pool::LaunchParams;
+
+  struct Config {
+    /// サイズクラスごとのキュー容量（2 のべき乗に切り上げる）
+    std::size_t queue_capacity{256};
+  };
+
+  explicit RemoteFreePool(Pool &pool) : RemoteFreePool(pool, Config{}) {}
+
+  RemoteFreePool(Pool &pool, const Config &config)
+      : pool_(&pool), owner_(std::this_thread::get_id()) {
+    const std::size_t class_count = pool_->size_class_count();
+    queues_.reserve(class_count);
+    for (std::size_t i = 0; i < class_count; ++i) {
+      queues_.pushBack(std::make_unique<Queue>(config.queue_capacity));
+    }
+  }
+
+  RemoteFreePool(const RemoteFreePool &) = delete;
+  RemoteFreePool &operator=(const RemoteFreePool &) = delete;
+  RemoteFreePool(RemoteFreePool &&) = delete;
+  RemoteFreePool &operator=(RemoteFreePool &&) = delete;
+
+  /// 他スレッドが本インスタンスで解放していないことが前提
+  ~RemoteFreePool() {
+    LaunchParams launch_params{};
+    drainRemoteFrees(launch_params);
+  }
+
+  Pool &pool() { return *pool_; }
+
+  /**
+   * @brief 呼び出しスレッドを所有スレッドにする（構築したスレッドが初期値）。
+   *
+   * 旧所有スレッドが allocate / drainRemoteFrees 中でないときに呼ぶこと。
+   */
+  void bindOwnerThread() {
+    owner_.store(std::this_thread::get_id(), std::memory_order_relaxed);
+  }
+
+  bool isOwnerThread() const {
+    return std::this_thread::get_id() == owner_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief 確保する。所有スレッドからの呼び出しでは先に同じサイズクラスの
+   *        リモート解放を回収する。
+   */
+  BufferResource allocate(std::size_t size, std::size_t alignment,
+                          LaunchParams &launch_params) {
+    if (size != 0 && isOwnerThread()) {
+      const std::size_t list_idx = pool_->sizeClassIndexFor(size, alignment);
+      if (list_idx < queues_.size()) {
+        drainSizeClass(list_idx, launch_params);
+      }
+    }
+    return pool_->allocate(size, alignment, launch_params);
+  }
+
+  void deallocate(BufferResource block, std::size_t size,
+                  std::size_t alignment, LaunchParams &launch_params) {
+    if (!block.valid() || size == 0) {
+      return;
+    }
+    const std::size_t list_idx = pool_->sizeClassIndexFor(size, alignment);
+    if (list_idx >= queues_.size() || isOwnerThread()) {
+      pool_->deallocate(std::move(block), size, alignment, launch_params);
+      return;
+    }
+
+    Entry entry{std::move(block), size, alignment};
+    if (queues_[list_idx]->tryPush(entry)) {
+      return;
+    }
+    fallback_frees_.fetch_add(1, std::memory_order_relaxed);
+    pool_->deallocate(std::move(entry.block), size, alignment, launch_params);
+  }
+
+  /**
+   * @brief 全サイズクラスのリモート解放を回収する（所有スレッドから呼ぶこと）。
+   * @return 回収したブロック数
+   */
+  std::size_t drainRemoteFrees(LaunchParams &launch_params) {
+    std::size_t drained = 0;
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      drained += drainSizeClass(i, launch_params);
+    }
+    return drained;
+  }
+
+  /**
+   * @brief 回収待ちのブロック数の概算（所有スレッドから呼ぶこと）。
+   */
+  std::size_t pendingRemoteFrees() const {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < queues_.size(); ++i) {
+      total += queues_[i]->sizeApprox();
+    }
+    return total;
+  }
+
+  /// キューが満杯でプールへ直接返した回数
+  std::uint64_t fallbackFrees() const {
+    return fallback_frees_.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct Entry {
+    BufferResource block{};
+    std::size_t size{0};
+    std::size_t alignment{0};
+  };
+
+  using Queue = ::orteaf::internal::base::BoundedMpscQueue<Entry>;
+
+  /**
+   * @brief 1 サイズクラスのキューを回収し、同じ (size, alignment) の並びごとに
+   *        deallocateBatch でプールへ返す。
+   *
+   * 回収中に push され続けても終わるよう、1 回に取り出すのは容量分までとする。
+   */
+  std::size_t drainSizeClass(std::size_t list_idx,
+                             LaunchParams &launch_params) {
+    Queue &queue = *queues_[list_idx];
+    if (queue.emptyApprox()) {
+      return 0;
+    }
+
+    std::size_t drained = 0;
+    std::size_t run_size = 0;
+    std::size_t run_alignment = 0;
+    Entry entry{};
+    auto flush = [&] {
+      if (!scratch_.empty()) {
+        pool_->deallocateBatch(scratch_.data(), scratch_.size(), run_size,
+                               run_alignment, launch_params);
+        scratch_.clear();
+      }
+    };
+    while (drained < queue.capacity() && queue.tryPop(entry)) {
+      if (entry.size != run_size || entry.alignment != run_alignment) {
+        flush();
+        run_size = entry.size;
+        run_alignment = entry.alignment;
+      }
+      scratch_.pushBack(std::move(entry.block));
+      ++drained;
+    }
+    flush();
+    return drained;
+  }
+
+  Pool *pool_{nullptr};
+  std::atomic<std::thread::id> owner_{};
+  ::orteaf::internal::base::HeapVector<std::unique_ptr<Queue>> queues_{};
+  // 回収時の deallocateBatch 用（所有スレッドのみが触る）
+  ::orteaf::internal::base::HeapVector<BufferResource> scratch_{};
+  std::atomic<std::uint64_t> fallback_frees_{0};
+};
+
+} // namespace orteaf::internal::execution::allocator::pool
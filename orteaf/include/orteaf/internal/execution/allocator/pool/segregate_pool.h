@@ -1,13 +1,45 @@
 #pragma once
 
 #include <algorithm>
+#include <concepts>
+#include <cstdint>
 #include <limits>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <orteaf/internal/base/handle.h>
+#include <orteaf/internal/base/heap_vector.h>
 #include <orteaf/internal/execution/allocator/buffer.h>
+#include <orteaf/internal/execution/allocator/policies/threading/threading_policies.h>
 #include <orteaf/internal/execution/allocator/pool/segregate_pool_stats.h>
+#include <orteaf/internal/execution/allocator/pool/segregate_pool_warmup.h>
 #include <orteaf/internal/execution/allocator/size_class_utils.h>
+#include <orteaf/internal/execution/allocator/trace/allocation_trace.h>
 #include <orteaf/internal/execution/execution.h>
 
 namespace orteaf::internal::execution::allocator::pool {
+
+/**
+ * @brief SegregatePool::trimIdleChunks の条件。
+ */
+struct ChunkTrimOptions {
+  /// このエポック数以上アイドルなチャンクを解放する
+  std::uint64_t min_idle_epochs{1};
+  /// 0 以外なら、チャンク総量がこれを下回るまでアイドル時間に関係なく解放する
+  std::size_t budget_bytes{0};
+  /// 1 回で解放するチャンク数の上限（0 は無制限）。ロック保持時間を抑える
+  std::size_t max_chunks{0};
+  /// true ならロックが取れないときは何もせず戻る
+  bool try_only{false};
+};
+
+struct ChunkTrimResult {
+  /// try_only でロックが取れなかった場合 false
+  bool acquired{false};
+  std::size_t released_chunks{0};
+  std::size_t released_bytes{0};
+};
+
 template <typename ExecutionResource, typename FastFreePolicy,
           typename ThreadingPolicy, typename LargeAllocPolicy,
           typename ChunkLocatorPolicy, typename ReuseLocatorPolicy,
@@ -20,6 +52,22 @@ public:
   using LaunchParams = typename ExecutionResource::LaunchParams;
   using Stats = SegregatePoolStats<ExecutionType>;
 
+  /// ThreadingPolicy が try_lock を提供し、別スレッドからの trim に対応するかどうか
+  static constexpr bool kSupportsBackgroundTrim =
+      requires(ThreadingPolicy &policy) {
+        { policy.try_lock() } -> std::convertible_to<bool>;
+      };
+
+  /// ThreadingPolicy が実際に排他し、複数スレッドから呼び出せるかどうか
+  static constexpr bool kThreadSafe = !std::is_same_v<
+      ThreadingPolicy,
+      ::orteaf::internal::execution::allocator::policies::NoLockThreadingPolicy>;
+
+  /// ThreadingPolicy がサイズクラス単位のロックを提供するかどうか
+  static constexpr bool kShardedLocking =
+      ::orteaf::internal::execution::allocator::policies::
+          SizeClassShardedThreading<ThreadingPolicy>;
+
   SegregatePool() = default;
   explicit SegregatePool(ExecutionResource resource)
       : resource_(std::move(resource)) {}
@@ -35,8 +83,10 @@ public:
         large_alloc_policy_(std::move(other.large_alloc_policy_)),
         chunk_locator_policy_(std::move(other.chunk_locator_policy_)),
         reuse_policy_(std::move(other.reuse_policy_)),
+        reuse_shards_(std::move(other.reuse_shards_)),
         free_list_policy_(std::move(other.free_list_policy_)),
-        stats_(std::move(other.stats_)) {}
+        stats_(std::move(other.stats_)),
+        trace_recorder_(other.trace_recorder_) {}
 
   SegregatePool &operator=(SegregatePool &&other) noexcept {
     if (this != &other) {
@@ -49,8 +99,10 @@ public:
       large_alloc_policy_ = std::move(other.large_alloc_policy_);
       chunk_locator_policy_ = std::move(other.chunk_locator_policy_);
       reuse_policy_ = std::move(other.reuse_policy_);
+      reuse_shards_ = std::move(other.reuse_shards_);
       free_list_policy_ = std::move(other.free_list_policy_);
       stats_ = std::move(other.stats_);
+      trace_recorder_ = other.trace_recorder_;
     }
     return *this;
   }
@@ -68,6 +120,13 @@ public:
     std::size_t chunk_size{16 * 1024 * 1024};
     std::size_t min_block_size{64};
     std::size_t max_block_size{16 * 1024 * 1024}; // デフォルトを適切な値に
+
+    /// initialize 時に事前に切り出しておくサイズクラスごとのブロック数。
+    /// LaunchParams を既定構築できない場合は設定できない（warmup() を直接呼ぶ）
+    std::conditional_t<std::is_default_constructible_v<LaunchParams>,
+                       SegregatePoolWarmupProfile,
+                       SegregatePoolWarmupUnavailable>
+        warmup{};
   };
 
   void initialize(const Config &config) {
@@ -75,17 +134,86 @@ public:
     min_block_size_ = config.min_block_size;
     max_block_size_ = config.max_block_size;
 
+    // サイズクラスの定義は FastFreePolicy の設定に依存するため先に初期化する
+    fast_free_policy_.initialize(config.fast_free);
+
     // サイズクラス数を計算（SegregatePool が一元管理）
     const std::size_t size_class_count =
-        sizeClassCount(min_block_size_, max_block_size_);
+        classCount(min_block_size_, max_block_size_);
 
-    fast_free_policy_.initialize(config.fast_free);
     threading_policy_.initialize(config.threading);
     large_alloc_policy_.initialize(config.large_alloc);
     chunk_locator_policy_.initialize(config.chunk_locator);
     reuse_policy_.initialize(config.reuse);
+    if constexpr (kShardedLocking) {
+      // サイズクラスごとにロックと reuse キューを分割する
+      threading_policy_.configureSizeClasses(size_class_count);
+      reuse_shards_.clear();
+      reuse_shards_.resize(size_class_count);
+      for (std::size_t i = 0; i < size_class_count; ++i) {
+        reuse_shards_[i].initialize(config.reuse);
+      }
+    }
     // freelist にサイズクラス数を渡す
     free_list_policy_.initialize(config.freelist, size_class_count);
+    stats_.configureSizeClasses(size_class_count);
+
+    if constexpr (std::is_default_constructible_v<LaunchParams>) {
+      if (!config.warmup.empty()) {
+        LaunchParams launch_params{};
+        warmup(config.warmup, launch_params);
+      }
+    }
+  }
+
+  /**
+   * @brief プロファイルに従ってチャンクを事前に切り出す。
+   *
+   * 各サイズクラスの freelist に entry.blocks 個以上のブロックが並ぶまで
+   * expandPool を繰り返すので、以降の allocate は最初のリクエストから
+   * チャンク確保を伴わない。すでに十分な空きがあるサイズクラスには何もしない。
+   * max_block_size を超えるエントリは large 確保でプールを経由しないため無視する。
+   *
+   * 切り出したチャンクは現在のアイドルエポックで記録され、一度使われるまでは
+   * trimIdleChunks の予算超過による解放から外れる（min_idle_epochs を経過すれば
+   * 通常どおり解放される）。明示的な releaseChunk では解放される。
+   *
+   * @param profile サイズクラスごとのブロック数
+   * @param launch_params 起動パラメータ
+   * @return 追加したチャンク数
+   */
+  std::size_t warmup(const SegregatePoolWarmupProfile &profile,
+                     LaunchParams &launch_params) {
+    std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+
+    std::size_t added = 0;
+    for (const auto &entry : profile) {
+      if (entry.block_size == 0 || entry.blocks == 0 ||
+          entry.block_size > max_block_size_) {
+        continue;
+      }
+      const std::size_t block_size = blockSizeFor(entry.block_size);
+      const std::size_t list_idx = classIndexOf(block_size);
+      const std::size_t blocks_per_chunk =
+          (chunk_size_ + block_size - 1) / block_size;
+
+      std::size_t available = 0;
+      if constexpr (requires(const FreeListPolicy &policy, std::size_t i) {
+                      {
+                        policy.get_free_blocks(i)
+                      } -> std::convertible_to<std::size_t>;
+                    }) {
+        available = free_list_policy_.get_free_blocks(list_idx);
+      }
+      while (available < entry.blocks) {
+        if (!expandPool(list_idx, block_size, launch_params, true)) {
+          break;
+        }
+        available += blocks_per_chunk;
+        ++added;
+      }
+    }
+    return added;
   }
 
   FastFreePolicy &fast_free_policy() { return fast_free_policy_; }
@@ -103,38 +231,139 @@ public:
 
   const Stats &stats() const { return stats_; }
 
-  BufferResource allocate(std::size_t size, std::size_t alignment,
-                          LaunchParams &launch_params) {
-    if (size == 0)
-      return BufferResource{};
-
+  /**
+   * @brief 統計のスナップショットを作る。
+   *
+   * カウンタに加え、サイズクラスごとのブロックサイズと freelist の空き数、
+   * チャンク数・占有率、再利用待ちブロック数をプールのロック下で集計する。
+   * freelist / ChunkLocator が集計 API を持たない場合、その項目は 0 になる。
+   */
+  SegregatePoolStatsSnapshot statsSnapshot() {
     std::lock_guard<ThreadingPolicy> lock(threading_policy_);
 
-    if (size > max_block_size_) {
-      stats_.updateAlloc(size, true);
-      BufferBlock block = large_alloc_policy_.allocate(size, alignment);
-      return BufferResource::fromBlock(block);
+    SegregatePoolStatsSnapshot out = stats_.snapshot();
+    for (auto &size_class : out.size_classes) {
+      size_class.block_size = classBlockSize(size_class.index);
+      if constexpr (requires(const FreeListPolicy &policy, std::size_t i) {
+                      {
+                        policy.get_free_blocks(i)
+                      } -> std::convertible_to<std::size_t>;
+                    }) {
+        size_class.free_blocks =
+            free_list_policy_.get_free_blocks(size_class.index);
+      }
+      out.chunk_used_bytes += size_class.live_blocks * size_class.block_size;
     }
 
-    processPendingReuses(launch_params);
+    if constexpr (requires(const ChunkLocatorPolicy &locator) {
+                    locator.usage();
+                    locator.releasableCount();
+                  }) {
+      const auto usage = chunk_locator_policy_.usage();
+      out.chunk_count = usage.chunk_count;
+      out.chunk_bytes = usage.chunk_bytes;
+      out.idle_chunks = chunk_locator_policy_.releasableCount();
+    }
 
-    const std::size_t block_size = blockSizeFor(size);
-    const std::size_t list_idx = sizeClassIndex(block_size, min_block_size_);
+    out.pending_reuse_blocks = reuse_policy_.getPendingReuseCount();
+    for (std::size_t i = 0; i < reuse_shards_.size(); ++i) {
+      out.pending_reuse_blocks += reuse_shards_[i].getPendingReuseCount();
+    }
+    return out;
+  }
 
-    BufferBlock block = free_list_policy_.pop(list_idx, launch_params);
+  /**
+   * @brief allocate / deallocate を記録するレコーダを設定する。
+   *
+   * nullptr で記録を止める。レコーダはプールより長く生存させること。
+   * 記録中でない場合のコストは分岐 1 つだけになる。
+   */
+  void setTraceRecorder(trace::AllocationTraceRecorder *recorder) {
+    trace_recorder_ = recorder;
+  }
+  trace::AllocationTraceRecorder *traceRecorder() const {
+    return trace_recorder_;
+  }
 
-    if (!block.valid()) {
-      expandPool(list_idx, block_size, launch_params);
-      block = free_list_policy_.pop(list_idx, launch_params);
-      if (!block.valid()) {
-        return {};
-      }
+  /**
+   * @brief ブロックを確保する。
+   *
+   * small ブロックは min(block_size, alignment) の境界に乗ることを保証する。
+   * チャンクはサイズクラスのブロックサイズ境界で確保されるため、2 の冪乗の
+   * サイズクラスでは余分なパディングなしに満たされる。幾何級数の中間クラスは
+   * 条件を満たすサイズクラスまで繰り上げ、どのクラスでも満たせなければ
+   * large として確保する。deallocate には同じ size / alignment を渡すこと。
+   */
+  BufferResource allocate(std::size_t size, std::size_t alignment,
+                          LaunchParams &launch_params) {
+    BufferResource block = allocateBlock(size, alignment, launch_params);
+    if (trace_recorder_ != nullptr && block.valid()) {
+      trace_recorder_->recordAllocate(traceKeyOf(block), size, alignment);
     }
+    return block;
+  }
 
-    chunk_locator_policy_.incrementUsed(block.handle);
+  /**
+   * @brief 同一サイズクラスのブロックを 1 回のロックでまとめて確保する。
+   *
+   * スレッドローカルキャッシュなどのフロントエンドが refill に使う。
+   * large サイズ（max_block_size 超）は対象外で 0 を返す。
+   *
+   * @param size 要求サイズ（サイズクラスの決定に使用）
+   * @param alignment アラインメント
+   * @param out 確保したブロックの書き込み先（count 要素以上）
+   * @param count 確保したいブロック数
+   * @param launch_params 起動パラメータ
+   * @return 実際に確保できたブロック数
+   */
+  std::size_t allocateBatch(std::size_t size, std::size_t alignment,
+                            BufferResource *out, std::size_t count,
+                            LaunchParams &launch_params) {
+    if (size == 0 || out == nullptr || count == 0)
+      return 0;
+    const std::size_t list_idx = smallClassForAlloc(size, alignment);
+    if (list_idx == kLargeClass)
+      return 0;
 
-    stats_.updateAlloc(size, false);
-    return BufferResource::fromBlock(block);
+    const std::size_t block_size = classBlockSize(list_idx);
+    std::size_t allocated = 0;
+
+    auto fill_with_expansion = [&] {
+      while (allocated < count) {
+        BufferBlock block = popSmallBlock(block_size, launch_params);
+        if (!block.valid()) {
+          break;
+        }
+        recordSmallAlloc(list_idx, size);
+        out[allocated++] = BufferResource::fromBlock(block);
+      }
+    };
+
+    if constexpr (kShardedLocking) {
+      {
+        SizeClassLock lock(threading_policy_, list_idx);
+        processShardPendingReuses(list_idx, launch_params);
+        while (allocated < count) {
+          BufferBlock block = tryPopSmallBlock(list_idx, launch_params);
+          if (!block.valid()) {
+            break;
+          }
+          recordSmallAlloc(list_idx, size);
+          out[allocated++] = BufferResource::fromBlock(block);
+        }
+      }
+      if (allocated < count) {
+        ChunkLock chunk_lock(threading_policy_);
+        SizeClassLock lock(threading_policy_, list_idx);
+        fill_with_expansion();
+      }
+    } else {
+      std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+      processPendingReuses(launch_params);
+      fill_with_expansion();
+    }
+    traceBatchAllocate(out, allocated, size, alignment);
+    return allocated;
   }
 
   void deallocate(BufferResource block, std::size_t size, std::size_t alignment,
@@ -142,24 +371,143 @@ public:
     if (!block.valid() || size == 0)
       return;
 
+    if (trace_recorder_ != nullptr) {
+      trace_recorder_->recordDeallocate(traceKeyOf(block), size, alignment);
+    }
+
+    if constexpr (kShardedLocking) {
+      (void)launch_params;
+      deallocateSharded(std::move(block), size, alignment);
+      return;
+    }
+
+    const std::size_t list_idx = smallClassForFree(size, alignment);
     std::lock_guard<ThreadingPolicy> lock(threading_policy_);
 
-    if (size > max_block_size_) {
+    if (list_idx == kLargeClass) {
       large_alloc_policy_.deallocate(block.handle, size, alignment);
       stats_.updateDealloc(size);
       return;
     }
 
-    const std::size_t block_size =
-        fast_free_policy_.get_block_size(min_block_size_, size);
-    const std::size_t list_idx = sizeClassIndex(block_size, min_block_size_);
+    scheduleSmallBlock(std::move(block), list_idx);
+    recordSmallDealloc(list_idx, size);
+  }
 
-    chunk_locator_policy_.incrementPending(block.handle);
-    reuse_policy_.scheduleForReuse(std::move(block), list_idx);
-    stats_.updateDealloc(size);
+  /**
+   * @brief 同一サイズクラスのブロックを 1 回のロックでまとめて返却する。
+   *
+   * 各ブロックは deallocate と同様に reuse ポリシーへ登録されるため、
+   * DeferredReusePolicy の完了待ちと ChunkLocator の pending 計上は維持される。
+   * large サイズが渡された場合は各ブロックを LargeAllocPolicy へ返す。
+   *
+   * @param blocks 返却するブロック列（呼び出し後は無効化される）
+   * @param count ブロック数
+   * @param size 確保時に指定したサイズ（同一サイズクラスであること）
+   * @param alignment アラインメント
+   * @param launch_params 起動パラメータ
+   */
+  void deallocateBatch(BufferResource *blocks, std::size_t count,
+                       std::size_t size, std::size_t alignment,
+                       LaunchParams &launch_params) {
+    (void)launch_params;
+    if (blocks == nullptr || count == 0 || size == 0)
+      return;
+
+    if (trace_recorder_ != nullptr) {
+      for (std::size_t i = 0; i < count; ++i) {
+        if (blocks[i].valid()) {
+          trace_recorder_->recordDeallocate(traceKeyOf(blocks[i]), size,
+                                            alignment);
+        }
+      }
+    }
+
+    const std::size_t list_idx = smallClassForFree(size, alignment);
+    if (list_idx == kLargeClass) {
+      auto release_all = [&] {
+        for (std::size_t i = 0; i < count; ++i) {
+          if (!blocks[i].valid())
+            continue;
+          large_alloc_policy_.deallocate(blocks[i].handle, size, alignment);
+          blocks[i] = BufferResource{};
+          stats_.updateDealloc(size);
+        }
+      };
+      if constexpr (kShardedLocking) {
+        LargeLock lock(threading_policy_);
+        release_all();
+      } else {
+        std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+        release_all();
+      }
+      return;
+    }
+
+    auto schedule_all = [&] {
+      for (std::size_t i = 0; i < count; ++i) {
+        if (!blocks[i].valid())
+          continue;
+        scheduleSmallBlock(std::move(blocks[i]), list_idx);
+        blocks[i] = BufferResource{};
+        recordSmallDealloc(list_idx, size);
+      }
+    };
+
+    if constexpr (kShardedLocking) {
+      SizeClassLock lock(threading_policy_, list_idx);
+      schedule_all();
+    } else {
+      std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+      schedule_all();
+    }
+  }
+
+  /**
+   * @brief 要求サイズに対応するサイズクラスインデックスを返す。
+   */
+  std::size_t sizeClassIndexFor(std::size_t size) const {
+    return classIndexOf(blockSizeFor(size));
+  }
+
+  /**
+   * @brief アラインメント込みで要求に対応するサイズクラスインデックスを返す。
+   *
+   * large 扱いになる要求（max_block_size 超、またはアラインメントを満たす
+   * サイズクラスがない）では size_class_count() を返す。
+   */
+  std::size_t sizeClassIndexFor(std::size_t size, std::size_t alignment) const {
+    const std::size_t list_idx = smallClassForAlloc(size, alignment);
+    return list_idx == kLargeClass ? size_class_count() : list_idx;
+  }
+
+  /**
+   * @brief サイズクラスインデックスに対応するブロックサイズを返す。
+   */
+  std::size_t sizeClassBlockSize(std::size_t index) const {
+    return classBlockSize(index);
+  }
+
+  /**
+   * @brief 管理しているサイズクラスの総数を返す。
+   */
+  std::size_t size_class_count() const {
+    return classCount(min_block_size_, max_block_size_);
   }
 
+  /**
+   * @brief 完了済みの再利用待ちブロックを freelist に戻す。
+   *
+   * 呼び出し側がプール全体のロックを保持していること。
+   */
   void processPendingReuses(LaunchParams &launch_params) {
+    if constexpr (kShardedLocking) {
+      for (std::size_t i = 0; i < reuse_shards_.size(); ++i) {
+        processShardPendingReuses(i, launch_params);
+      }
+      return;
+    }
+
     reuse_policy_.processPending();
 
     std::size_t freelist_index = 0;
@@ -171,47 +519,564 @@ public:
     }
   }
 
+  /**
+   * @brief アイドルなチャンクと、LargeAllocPolicy がキャッシュしている
+   *        large ブロック（releaseCached を持つ場合）をリソースへ返す。
+   */
   void releaseChunk(LaunchParams &launch_params) {
+    releaseIdleChunks(launch_params);
+    if constexpr (requires(LargeAllocPolicy &policy) {
+                    policy.releaseCached();
+                  }) {
+      std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+      large_alloc_policy_.releaseCached();
+    }
+  }
+
+  /**
+   * @brief used/pending が 0 のチャンクをまとめて解放する。
+   *
+   * ChunkLocator が collectReleasable を提供する場合、解放候補を一括で集め、
+   * freelist と reuse キューの走査を解放チャンク数によらず 1 回で済ませる。
+   *
+   * @param launch_params 起動パラメータ
+   * @return 解放したチャンク数
+   */
+  std::size_t releaseIdleChunks(LaunchParams &launch_params) {
     std::lock_guard<ThreadingPolicy> lock(threading_policy_);
 
     processPendingReuses(launch_params);
 
-    while (true) {
-      const auto handle = chunk_locator_policy_.findReleasable();
-      if (!handle.isValid())
-        break;
+    if constexpr (requires(ChunkLocatorPolicy &locator,
+                           ::orteaf::internal::base::HeapVector<
+                               ::orteaf::internal::base::BufferViewHandle> &out) {
+                    locator.collectReleasable(out);
+                  }) {
+      ::orteaf::internal::base::HeapVector<
+          ::orteaf::internal::base::BufferViewHandle>
+          handles;
+      chunk_locator_policy_.collectReleasable(handles);
+      if (handles.empty()) {
+        return 0;
+      }
+      std::sort(handles.begin(), handles.end());
+      const std::span<const ::orteaf::internal::base::BufferViewHandle>
+          sorted(handles.data(), handles.size());
+
+      removeBlocksInChunks(reuse_policy_, sorted);
+      for (std::size_t i = 0; i < reuse_shards_.size(); ++i) {
+        removeBlocksInChunks(reuse_shards_[i], sorted);
+      }
+      removeBlocksInChunks(free_list_policy_, sorted);
+
+      std::size_t released = 0;
+      for (std::size_t i = 0; i < handles.size(); ++i) {
+        if (chunk_locator_policy_.releaseChunk(handles[i])) {
+          ++released;
+        }
+      }
+      return released;
+    } else {
+      std::size_t released = 0;
+      while (true) {
+        const auto handle = chunk_locator_policy_.findReleasable();
+        if (!handle.isValid())
+          break;
 
-      reuse_policy_.removeBlocksInChunk(handle);
-      free_list_policy_.removeBlocksInChunk(handle);
+        reuse_policy_.removeBlocksInChunk(handle);
+        for (std::size_t i = 0; i < reuse_shards_.size(); ++i) {
+          reuse_shards_[i].removeBlocksInChunk(handle);
+        }
+        free_list_policy_.removeBlocksInChunk(handle);
+
+        if (!chunk_locator_policy_.releaseChunk(handle)) {
+          break;
+        }
+        ++released;
+      }
+      return released;
+    }
+  }
+
+  /**
+   * @brief アイドルエポックを 1 つ進める。プールのロックは取らない。
+   */
+  void advanceIdleEpoch() { chunk_locator_policy_.advanceIdleEpoch(); }
+
+  /**
+   * @brief 一定時間アイドルなチャンク、またはメモリ予算を超えた分のチャンクを解放する。
+   *
+   * アイドル時間の長いチャンクから順に、min_idle_epochs 以上アイドルなものと、
+   * budget_bytes を超えている間はそれ以外のアイドルチャンクも解放する。
+   * warmup() で用意してまだ使われていないチャンクは予算超過では解放せず、
+   * min_idle_epochs を経過するまで残す。
+   * try_only のときは try_lock でロックを試み、取れなければ何もしないので
+   * allocate/deallocate 側がトリマーを待つのはトリマーがロックを保持している
+   * 短い間だけになる。ChunkLocatorPolicy はアイドルエポックを追跡すること。
+   *
+   * @param options 解放条件
+   * @param launch_params 起動パラメータ
+   * @return ロック取得の成否と解放量
+   */
+  ChunkTrimResult trimIdleChunks(const ChunkTrimOptions &options,
+                                 LaunchParams &launch_params) {
+    static_assert(
+        requires(ChunkLocatorPolicy &locator,
+                 ::orteaf::internal::base::BufferViewHandle handle,
+                 ::orteaf::internal::base::HeapVector<
+                     ::orteaf::internal::base::BufferViewHandle> &out) {
+          locator.idleEpochsOf(handle);
+          locator.chunkBytes();
+          locator.collectReleasable(out);
+        },
+        "trimIdleChunks requires a ChunkLocatorPolicy that tracks idle epochs");
 
-      if (!chunk_locator_policy_.releaseChunk(handle)) {
+    ChunkTrimResult result{};
+    std::unique_lock<ThreadingPolicy> lock(threading_policy_, std::defer_lock);
+    if constexpr (kSupportsBackgroundTrim) {
+      if (options.try_only) {
+        if (!lock.try_lock()) {
+          return result;
+        }
+      } else {
+        lock.lock();
+      }
+    } else {
+      lock.lock();
+    }
+    result.acquired = true;
+
+    processPendingReuses(launch_params);
+
+    ::orteaf::internal::base::HeapVector<
+        ::orteaf::internal::base::BufferViewHandle>
+        idle;
+    chunk_locator_policy_.collectReleasable(idle);
+    if (idle.empty()) {
+      return result;
+    }
+
+    // アイドル時間の長い順に並べ、条件を満たす間だけ取る
+    std::sort(idle.begin(), idle.end(), [&](const auto &a, const auto &b) {
+      return chunk_locator_policy_.idleEpochsOf(a) >
+             chunk_locator_policy_.idleEpochsOf(b);
+    });
+    std::size_t resident = chunk_locator_policy_.chunkBytes();
+    std::size_t selected = 0;
+    for (std::size_t i = 0; i < idle.size(); ++i) {
+      if (options.max_chunks != 0 && selected == options.max_chunks) {
         break;
       }
+      const bool old_enough = chunk_locator_policy_.idleEpochsOf(idle[i]) >=
+                              options.min_idle_epochs;
+      const bool over_budget =
+          options.budget_bytes != 0 && resident > options.budget_bytes;
+      if (!old_enough && !over_budget) {
+        break;
+      }
+      if (!old_enough && isWarmChunk(idle[i])) {
+        // ウォームアップ分は予算超過だけでは解放しない
+        continue;
+      }
+      resident -= chunk_locator_policy_.findChunkSize(idle[i]);
+      idle[selected++] = idle[i];
     }
+    if (selected == 0) {
+      return result;
+    }
+
+    idle.resize(selected);
+    std::sort(idle.begin(), idle.end());
+    const std::span<const ::orteaf::internal::base::BufferViewHandle> sorted(
+        idle.data(), idle.size());
+    removeBlocksInChunks(reuse_policy_, sorted);
+    for (std::size_t i = 0; i < reuse_shards_.size(); ++i) {
+      removeBlocksInChunks(reuse_shards_[i], sorted);
+    }
+    removeBlocksInChunks(free_list_policy_, sorted);
+
+    for (std::size_t i = 0; i < idle.size(); ++i) {
+      const std::size_t bytes = chunk_locator_policy_.findChunkSize(idle[i]);
+      if (chunk_locator_policy_.releaseChunk(idle[i])) {
+        ++result.released_chunks;
+        result.released_bytes += bytes;
+      }
+    }
+    return result;
   }
 
 private:
+  BufferResource allocateBlock(std::size_t size, std::size_t alignment,
+                               LaunchParams &launch_params) {
+    if (size == 0)
+      return BufferResource{};
+
+    if constexpr (kShardedLocking) {
+      return allocateSharded(size, alignment, launch_params);
+    }
+
+    const std::size_t list_idx = smallClassForAlloc(size, alignment);
+    std::lock_guard<ThreadingPolicy> lock(threading_policy_);
+
+    if (list_idx == kLargeClass) {
+      stats_.updateAlloc(size, true);
+      BufferBlock block = large_alloc_policy_.allocate(size, alignment);
+      return BufferResource::fromBlock(block);
+    }
+
+    processPendingReuses(launch_params);
+
+    BufferBlock block = popSmallBlock(classBlockSize(list_idx), launch_params);
+    if (!block.valid()) {
+      return {};
+    }
+
+    recordSmallAlloc(list_idx, size);
+    return BufferResource::fromBlock(block);
+  }
+
+  /**
+   * @brief トレース用にブロックを識別するキー（ハンドルとオフセット）。
+   */
+  static trace::AllocationTraceKey traceKeyOf(const BufferResource &block) {
+    return trace::AllocationTraceKey{
+        static_cast<std::uint64_t>(block.handle.index),
+        static_cast<std::uint64_t>(block.view.offset())};
+  }
+
+  void traceBatchAllocate(const BufferResource *blocks, std::size_t count,
+                          std::size_t size, std::size_t alignment) {
+    if (trace_recorder_ == nullptr) {
+      return;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+      trace_recorder_->recordAllocate(traceKeyOf(blocks[i]), size, alignment);
+    }
+  }
+
+  /**
+   * @brief サイズクラス 1 つ分のロックを保持する RAII ガード。
+   */
+  class SizeClassLock {
+  public:
+    SizeClassLock(ThreadingPolicy &policy, std::size_t index)
+        : policy_(policy), index_(index) {
+      policy_.lockSizeClass(index_);
+    }
+    SizeClassLock(const SizeClassLock &) = delete;
+    SizeClassLock &operator=(const SizeClassLock &) = delete;
+    ~SizeClassLock() { policy_.unlockSizeClass(index_); }
+
+  private:
+    ThreadingPolicy &policy_;
+    std::size_t index_;
+  };
+
+  /**
+   * @brief large 確保用ロックを保持する RAII ガード。
+   */
+  class LargeLock {
+  public:
+    explicit LargeLock(ThreadingPolicy &policy) : policy_(policy) {
+      policy_.lockLarge();
+    }
+    LargeLock(const LargeLock &) = delete;
+    LargeLock &operator=(const LargeLock &) = delete;
+    ~LargeLock() { policy_.unlockLarge(); }
+
+  private:
+    ThreadingPolicy &policy_;
+  };
+
+  /**
+   * @brief チャンク追加用ロックを保持する RAII ガード。
+   */
+  class ChunkLock {
+  public:
+    explicit ChunkLock(ThreadingPolicy &policy) : policy_(policy) {
+      policy_.lockChunks();
+    }
+    ChunkLock(const ChunkLock &) = delete;
+    ChunkLock &operator=(const ChunkLock &) = delete;
+    ~ChunkLock() { policy_.unlockChunks(); }
+
+  private:
+    ThreadingPolicy &policy_;
+  };
+
+  /**
+   * @brief サイズクラス単位ロックでの allocate。
+   *
+   * freelist の pop と reuse キューの処理は該当サイズクラスのロックだけで行う。
+   * freelist が空のときはチャンク追加用ロックと該当サイズクラスのロックだけを
+   * 取って拡張するので、他のサイズクラスの確保・解放は止まらない。
+   * チャンクは 1 つのサイズクラス専用に切り出されるため、チャンクの
+   * used/pending はそのサイズクラスのロックで保護される。
+   */
+  BufferResource allocateSharded(std::size_t size, std::size_t alignment,
+                                 LaunchParams &launch_params) {
+    const std::size_t list_idx = smallClassForAlloc(size, alignment);
+    if (list_idx == kLargeClass) {
+      LargeLock lock(threading_policy_);
+      stats_.updateAlloc(size, true);
+      BufferBlock block = large_alloc_policy_.allocate(size, alignment);
+      return BufferResource::fromBlock(block);
+    }
+
+    const std::size_t block_size = classBlockSize(list_idx);
+
+    BufferBlock block{};
+    {
+      SizeClassLock lock(threading_policy_, list_idx);
+      processShardPendingReuses(list_idx, launch_params);
+      block = tryPopSmallBlock(list_idx, launch_params);
+    }
+
+    if (!block.valid()) {
+      // 待っている間に他スレッドが拡張していれば popSmallBlock はそれを使う
+      ChunkLock chunk_lock(threading_policy_);
+      SizeClassLock lock(threading_policy_, list_idx);
+      block = popSmallBlock(block_size, launch_params);
+      if (!block.valid()) {
+        return {};
+      }
+    }
+
+    recordSmallAlloc(list_idx, size);
+    return BufferResource::fromBlock(block);
+  }
+
+  void deallocateSharded(BufferResource block, std::size_t size,
+                         std::size_t alignment) {
+    const std::size_t list_idx = smallClassForFree(size, alignment);
+    if (list_idx == kLargeClass) {
+      LargeLock lock(threading_policy_);
+      large_alloc_policy_.deallocate(block.handle, size, alignment);
+      stats_.updateDealloc(size);
+      return;
+    }
+
+    SizeClassLock lock(threading_policy_, list_idx);
+    scheduleSmallBlock(std::move(block), list_idx);
+    recordSmallDealloc(list_idx, size);
+  }
+
+  /**
+   * @brief 1 サイズクラス分の reuse キューを処理する（該当ロック保持中）。
+   */
+  void processShardPendingReuses(std::size_t list_idx,
+                                 LaunchParams &launch_params) {
+    ReuseLocatorPolicy &shard = reuse_shards_[list_idx];
+    shard.processPending();
+
+    std::size_t freelist_index = 0;
+    BufferBlock ready_block{};
+
+    while (shard.getReadyItem(freelist_index, ready_block)) {
+      chunk_locator_policy_.decrementPendingAndUsed(ready_block.handle);
+      free_list_policy_.push(freelist_index, ready_block, launch_params);
+    }
+  }
+
+  void recordSmallAlloc(std::size_t list_idx, std::size_t size) {
+    stats_.updateAlloc(size, false);
+    if constexpr (Stats::kSizeClassStatsEnabled) {
+      stats_.updateSizeClassAlloc(list_idx, size, classBlockSize(list_idx));
+    }
+  }
+
+  void recordSmallDealloc(std::size_t list_idx, std::size_t size) {
+    stats_.updateDealloc(size);
+    if constexpr (Stats::kSizeClassStatsEnabled) {
+      stats_.updateSizeClassDealloc(list_idx, size, classBlockSize(list_idx));
+    }
+  }
+
   /**
    * @brief サイズに対応するブロックサイズを計算
    */
   std::size_t blockSizeFor(std::size_t size) const {
-    return sizeClassToBlockSize(
-        sizeClassIndex(std::max(min_block_size_, size), min_block_size_),
-        min_block_size_);
+    return classBlockSize(classIndexOf(std::max(min_block_size_, size)));
   }
 
-  void expandPool(std::size_t list_idx, std::size_t block_size,
-                  LaunchParams &launch_params) {
+  static constexpr std::size_t kLargeClass =
+      std::numeric_limits<std::size_t>::max();
+
+  /**
+   * @brief サイズクラスのブロックが保証するアラインメント。
+   *
+   * チャンクをこの値でアラインして確保し、ブロックはチャンク先頭から
+   * block_size 間隔で並ぶため、全ブロックがこの境界に乗る。
+   */
+  static constexpr std::size_t naturalAlignment(std::size_t block_size) {
+    return block_size & (~block_size + 1);
+  }
+
+  /**
+   * @brief min(block_size, alignment) のアラインメントを満たす最初のサイズクラス。
+   *
+   * 2 の冪乗スキームでは常に list_idx 自身を返す。幾何級数スキームの中間クラス
+   * （80B など）は境界が粗いため、満たすクラスまで繰り上げる。
+   * 満たすクラスがなければ kLargeClass。
+   */
+  std::size_t alignedClassIndex(std::size_t list_idx,
+                                std::size_t alignment) const {
+    if (alignment <= 1) {
+      return list_idx;
+    }
+    const std::size_t count = classCount(min_block_size_, max_block_size_);
+    for (; list_idx < count; ++list_idx) {
+      const std::size_t block_size = classBlockSize(list_idx);
+      if (naturalAlignment(block_size) >= std::min(alignment, block_size)) {
+        return list_idx;
+      }
+    }
+    return kLargeClass;
+  }
+
+  std::size_t smallClassForAlloc(std::size_t size,
+                                 std::size_t alignment) const {
+    if (size > max_block_size_) {
+      return kLargeClass;
+    }
+    return alignedClassIndex(classIndexOf(blockSizeFor(size)), alignment);
+  }
+
+  /**
+   * @brief 返却時のサイズクラス（確保時と同じ size / alignment を渡すこと）。
+   */
+  std::size_t smallClassForFree(std::size_t size, std::size_t alignment) const {
+    if (size > max_block_size_) {
+      return kLargeClass;
+    }
+    return alignedClassIndex(freeListIndexFor(size), alignment);
+  }
+
+  // サイズクラスの定義は FastFreePolicy が提供する場合はそれに従い、
+  // 提供しない場合は2の冪乗スキーム（size_class_utils.h）を使う。
+  static constexpr bool kPolicySizeClasses =
+      requires(const FastFreePolicy &policy, std::size_t n) {
+        { policy.size_class_index(n, n) } -> std::convertible_to<std::size_t>;
+        {
+          policy.size_class_block_size(n, n)
+        } -> std::convertible_to<std::size_t>;
+        { policy.size_class_count(n, n) } -> std::convertible_to<std::size_t>;
+      };
+
+  std::size_t classIndexOf(std::size_t block_size) const {
+    if constexpr (kPolicySizeClasses) {
+      return fast_free_policy_.size_class_index(block_size, min_block_size_);
+    } else {
+      return sizeClassIndex(block_size, min_block_size_);
+    }
+  }
+
+  std::size_t classBlockSize(std::size_t index) const {
+    if constexpr (kPolicySizeClasses) {
+      return fast_free_policy_.size_class_block_size(index, min_block_size_);
+    } else {
+      return sizeClassToBlockSize(index, min_block_size_);
+    }
+  }
+
+  std::size_t classCount(std::size_t min_block_size,
+                         std::size_t max_block_size) const {
+    if constexpr (kPolicySizeClasses) {
+      return fast_free_policy_.size_class_count(min_block_size, max_block_size);
+    } else {
+      return sizeClassCount(min_block_size, max_block_size);
+    }
+  }
+
+  /**
+   * @brief ポリシーが一括除去に対応していればそれを使い、なければ 1 つずつ除く。
+   */
+  template <typename Policy>
+  static void removeBlocksInChunks(
+      Policy &policy,
+      std::span<const ::orteaf::internal::base::BufferViewHandle> handles) {
+    if constexpr (requires { policy.removeBlocksInChunks(handles); }) {
+      policy.removeBlocksInChunks(handles);
+    } else {
+      for (const auto &handle : handles) {
+        policy.removeBlocksInChunk(handle);
+      }
+    }
+  }
+
+  /**
+   * @brief freelist から 1 ブロック取り出す（拡張はしない）。
+   */
+  BufferBlock tryPopSmallBlock(std::size_t list_idx,
+                               LaunchParams &launch_params) {
+    BufferBlock block = free_list_policy_.pop(list_idx, launch_params);
+    if (block.valid()) {
+      chunk_locator_policy_.incrementUsed(block.handle);
+    }
+    return block;
+  }
+
+  BufferBlock popSmallBlock(std::size_t block_size,
+                            LaunchParams &launch_params) {
+    const std::size_t list_idx = classIndexOf(block_size);
+
+    BufferBlock block = tryPopSmallBlock(list_idx, launch_params);
+    if (!block.valid()) {
+      expandPool(list_idx, block_size, launch_params);
+      block = tryPopSmallBlock(list_idx, launch_params);
+    }
+    return block;
+  }
+
+  /**
+   * @brief 返却サイズから freelist インデックスを求める。
+   */
+  std::size_t freeListIndexFor(std::size_t size) const {
+    const std::size_t block_size =
+        fast_free_policy_.get_block_size(min_block_size_, size);
+    return classIndexOf(block_size);
+  }
+
+  void scheduleSmallBlock(BufferResource block, std::size_t list_idx) {
+    chunk_locator_policy_.incrementPending(block.handle);
+    if constexpr (kShardedLocking) {
+      reuse_shards_[list_idx].scheduleForReuse(std::move(block), list_idx);
+    } else {
+      reuse_policy_.scheduleForReuse(std::move(block), list_idx);
+    }
+  }
+
+  bool isWarmChunk(::orteaf::internal::base::BufferViewHandle handle) const {
+    if constexpr (requires { chunk_locator_policy_.isWarm(handle); }) {
+      return chunk_locator_policy_.isWarm(handle);
+    } else {
+      return false;
+    }
+  }
+
+  /**
+   * @param warm warmup() からの呼び出し。ChunkLocatorPolicy が対応していれば
+   *             チャンクをウォームアップ分として記録する
+   */
+  bool expandPool(std::size_t list_idx, std::size_t block_size,
+                  LaunchParams &launch_params, bool warm = false) {
     const std::size_t num_blocks = (chunk_size_ + block_size - 1) / block_size;
     const std::size_t actual_chunk_size = num_blocks * block_size;
 
-    BufferBlock chunk = chunk_locator_policy_.addChunk(actual_chunk_size, 0);
+    BufferBlock chunk = chunk_locator_policy_.addChunk(
+        actual_chunk_size, naturalAlignment(block_size));
     if (!chunk.valid())
-      return;
+      return false;
+    if constexpr (requires { chunk_locator_policy_.markWarm(chunk.handle); }) {
+      if (warm) {
+        chunk_locator_policy_.markWarm(chunk.handle);
+      }
+    }
 
     free_list_policy_.expand(list_idx, chunk, actual_chunk_size, block_size,
                              launch_params);
     stats_.updateExpansion();
+    return true;
   }
 
   std::size_t min_block_size_{64};
@@ -225,8 +1090,11 @@ private:
   LargeAllocPolicy large_alloc_policy_;
   ChunkLocatorPolicy chunk_locator_policy_;
   ReuseLocatorPolicy reuse_policy_;
+  // kShardedLocking のときのみ使用するサイズクラスごとの reuse キュー
+  ::orteaf::internal::base::HeapVector<ReuseLocatorPolicy> reuse_shards_{};
   FreeListPolicy free_list_policy_;
   Stats stats_;
+  trace::AllocationTraceRecorder *trace_recorder_{nullptr};
 };
 
 } // namespace orteaf::internal::execution::allocator::pool
@@ -1,13 +1,127 @@
 #pragma once
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
+#include <memory>
+#include <orteaf/internal/base/sharded_counter.h>
 #include <orteaf/internal/execution/execution.h>
 #include <sstream>
+#include <string>
+#include <vector>
 
 namespace orteaf::internal::execution::allocator::pool {
 
+/**
+ * @brief サイズクラス 1 つ分の統計スナップショット。
+ */
+struct SegregatePoolSizeClassSnapshot {
+  std::size_t index{0};
+  std::size_t block_size{0};
+  uint64_t allocations{0};
+  uint64_t deallocations{0};
+  uint64_t live_blocks{0};
+  /// freelist に積まれている（すぐに払い出せる）ブロック数
+  uint64_t free_blocks{0};
+  /// 生存中のブロックで、要求サイズをブロックサイズに丸めたことによる無駄
+  uint64_t wasted_bytes{0};
+  /// 生存ブロック数の最大値（ウォームアッププロファイルの元になる）
+  uint64_t peak_live_blocks{0};
+};
+
+/**
+ * @brief SegregatePool の統計スナップショット。
+ *
+ * SegregatePool::statsSnapshot() が作成する。カウンタは取得時点の値で、
+ * freelist / チャンクの状態はプールのロック下で集計される。
+ */
+struct SegregatePoolStatsSnapshot {
+  uint64_t total_allocations{0};
+  uint64_t total_deallocations{0};
+  uint64_t active_allocations{0};
+  uint64_t large_allocations{0};
+  uint64_t pool_expansions{0};
+  uint64_t current_allocated_bytes{0};
+  uint64_t peak_allocated_bytes{0};
+
+  uint64_t chunk_count{0};
+  uint64_t chunk_bytes{0};
+  /// used / pending が 0 で解放可能なチャンク数
+  uint64_t idle_chunks{0};
+  /// 生存ブロックが占めるバイト数（ブロックサイズ単位）
+  uint64_t chunk_used_bytes{0};
+  /// 再利用待ち（ReuseToken 完了待ち）のブロック数
+  uint64_t pending_reuse_blocks{0};
+
+  std::vector<SegregatePoolSizeClassSnapshot> size_classes{};
+
+  /// チャンクのうち生存ブロックが占める割合（チャンクがなければ 0）
+  double chunkOccupancy() const noexcept {
+    return chunk_bytes == 0 ? 0.0
+                            : static_cast<double>(chunk_used_bytes) /
+                                  static_cast<double>(chunk_bytes);
+  }
+
+  uint64_t totalWastedBytes() const noexcept {
+    uint64_t total = 0;
+    for (const auto &size_class : size_classes) {
+      total += size_class.wasted_bytes;
+    }
+    return total;
+  }
+
+  uint64_t totalFreeBlocks() const noexcept {
+    uint64_t total = 0;
+    for (const auto &size_class : size_classes) {
+      total += size_class.free_blocks;
+    }
+    return total;
+  }
+
+  std::string toJson() const {
+    std::ostringstream oss;
+    oss << "{\"total_allocations\":" << total_allocations
+        << ",\"total_deallocations\":" << total_deallocations
+        << ",\"active_allocations\":" << active_allocations
+        << ",\"large_allocations\":" << large_allocations
+        << ",\"pool_expansions\":" << pool_expansions
+        << ",\"current_allocated_bytes\":" << current_allocated_bytes
+        << ",\"peak_allocated_bytes\":" << peak_allocated_bytes
+        << ",\"chunk_count\":" << chunk_count
+        << ",\"chunk_bytes\":" << chunk_bytes
+        << ",\"idle_chunks\":" << idle_chunks
+        << ",\"chunk_used_bytes\":" << chunk_used_bytes
+        << ",\"chunk_occupancy\":" << chunkOccupancy()
+        << ",\"pending_reuse_blocks\":" << pending_reuse_blocks
+        << ",\"size_classes\":[";
+    for (std::size_t i = 0; i < size_classes.size(); ++i) {
+      const auto &c = size_classes[i];
+      if (i != 0) {
+        oss << ",";
+      }
+      oss << "{\"index\":" << c.index << ",\"block_size\":" << c.block_size
+          << ",\"allocations\":" << c.allocations
+          << ",\"deallocations\":" << c.deallocations
+          << ",\"live_blocks\":" << c.live_blocks
+          << ",\"free_blocks\":" << c.free_blocks
+          << ",\"wasted_bytes\":" << c.wasted_bytes
+          << ",\"peak_live_blocks\":" << c.peak_live_blocks << "}";
+    }
+    oss << "]}";
+    return oss.str();
+  }
+};
+
+/**
+ * @brief SegregatePool の統計カウンタ。
+ *
+ * 全体カウンタはスレッドごとのシャード（base::ShardedCounters /
+ * base::ShardedGauge）に書き込み、読み出し時に集計する。多数のスレッドが
+ * 同時に確保してもカウンタのキャッシュラインを奪い合わない。
+ * 値は更新が止まっていれば正確で、ピークバイト数のみ近似
+ * （真の最大値との差はシャード数 × batch バイト未満）。
+ */
 template <::orteaf::internal::execution::Execution ExecutionType>
 class SegregatePoolStats {
 private:
@@ -43,49 +157,28 @@ private:
   }();
 
 public:
+  /// サイズクラス別カウンタ（STATS_BASIC 以上で有効）
+  static constexpr bool kSizeClassStatsEnabled = StatsLevel >= 2;
+
   SegregatePoolStats() = default;
   SegregatePoolStats(const SegregatePoolStats &) = delete;
   SegregatePoolStats &operator=(const SegregatePoolStats &) = delete;
 
   SegregatePoolStats(SegregatePoolStats &&other) noexcept
-      : total_allocations_(
-            other.total_allocations_.load(std::memory_order_relaxed)),
-        total_deallocations_(
-            other.total_deallocations_.load(std::memory_order_relaxed)),
-        active_allocations_(
-            other.active_allocations_.load(std::memory_order_relaxed)),
-        large_allocations_(
-            other.large_allocations_.load(std::memory_order_relaxed)),
-        pool_expansions_(
-            other.pool_expansions_.load(std::memory_order_relaxed)),
-        current_allocated_bytes_(
-            other.current_allocated_bytes_.load(std::memory_order_relaxed)),
-        peak_allocated_bytes_(
-            other.peak_allocated_bytes_.load(std::memory_order_relaxed)) {}
+      : counts_(std::move(other.counts_)),
+        allocated_bytes_(std::move(other.allocated_bytes_)),
+        size_classes_(std::move(other.size_classes_)),
+        size_class_count_(other.size_class_count_) {
+    other.size_class_count_ = 0;
+  }
 
   SegregatePoolStats &operator=(SegregatePoolStats &&other) noexcept {
     if (this != &other) {
-      total_allocations_.store(
-          other.total_allocations_.load(std::memory_order_relaxed),
-          std::memory_order_relaxed);
-      total_deallocations_.store(
-          other.total_deallocations_.load(std::memory_order_relaxed),
-          std::memory_order_relaxed);
-      active_allocations_.store(
-          other.active_allocations_.load(std::memory_order_relaxed),
-          std::memory_order_relaxed);
-      large_allocations_.store(
-          other.large_allocations_.load(std::memory_order_relaxed),
-          std::memory_order_relaxed);
-      pool_expansions_.store(
-          other.pool_expansions_.load(std::memory_order_relaxed),
-          std::memory_order_relaxed);
-      current_allocated_bytes_.store(
-          other.current_allocated_bytes_.load(std::memory_order_relaxed),
-          std::memory_order_relaxed);
-      peak_allocated_bytes_.store(
-          other.peak_allocated_bytes_.load(std::memory_order_relaxed),
-          std::memory_order_relaxed);
+      counts_ = std::move(other.counts_);
+      allocated_bytes_ = std::move(other.allocated_bytes_);
+      size_classes_ = std::move(other.size_classes_);
+      size_class_count_ = other.size_class_count_;
+      other.size_class_count_ = 0;
     }
     return *this;
   }
@@ -93,86 +186,164 @@ public:
   ~SegregatePoolStats() = default;
   uint64_t totalAllocations() const noexcept {
     if constexpr (StatsLevel >= 2) {
-      return total_allocations_.load(std::memory_order_relaxed);
+      return counts_.load(kAllocationsSlot);
     }
     return 0;
   }
 
   uint64_t totalDeallocations() const noexcept {
     if constexpr (StatsLevel >= 2) {
-      return total_deallocations_.load(std::memory_order_relaxed);
+      return counts_.load(kDeallocationsSlot);
     }
     return 0;
   }
 
   uint64_t activeAllocations() const noexcept {
     if constexpr (StatsLevel >= 2) {
-      return active_allocations_.load(std::memory_order_relaxed);
+      return counts_.load(kAllocationsSlot) - counts_.load(kDeallocationsSlot);
     }
     return 0;
   }
 
   uint64_t currentAllocatedBytes() const noexcept {
     if constexpr (StatsLevel >= 4) {
-      return current_allocated_bytes_.load(std::memory_order_relaxed);
+      return allocated_bytes_.value();
     }
     return 0;
   }
 
   uint64_t peakAllocatedBytes() const noexcept {
     if constexpr (StatsLevel >= 4) {
-      return peak_allocated_bytes_.load(std::memory_order_relaxed);
+      return allocated_bytes_.peak();
     }
     return 0;
   }
 
   uint64_t largeAllocations() const noexcept {
     if constexpr (StatsLevel >= 2) {
-      return large_allocations_.load(std::memory_order_relaxed);
+      return counts_.load(kLargeAllocationsSlot);
     }
     return 0;
   }
 
   uint64_t poolExpansions() const noexcept {
     if constexpr (StatsLevel >= 2) {
-      return pool_expansions_.load(std::memory_order_relaxed);
+      return counts_.load(kExpansionsSlot);
     }
     return 0;
   }
 
   void updateAlloc(std::size_t size, bool is_large) noexcept {
     if constexpr (StatsLevel >= 2) {
-      total_allocations_.fetch_add(1, std::memory_order_relaxed);
-      active_allocations_.fetch_add(1, std::memory_order_relaxed);
+      counts_.add(kAllocationsSlot, 1);
       if (is_large) {
-        large_allocations_.fetch_add(1, std::memory_order_relaxed);
+        counts_.add(kLargeAllocationsSlot, 1);
       }
     }
     if constexpr (StatsLevel >= 4) {
-      uint64_t current =
-          current_allocated_bytes_.fetch_add(size, std::memory_order_relaxed) +
-          size;
-      uint64_t peak = peak_allocated_bytes_.load(std::memory_order_relaxed);
-      while (current > peak && !peak_allocated_bytes_.compare_exchange_weak(
-                                   peak, current, std::memory_order_relaxed)) {
-        peak = peak_allocated_bytes_.load(std::memory_order_relaxed);
-      }
+      allocated_bytes_.add(size);
     }
   }
 
   void updateDealloc(std::size_t size) noexcept {
     if constexpr (StatsLevel >= 2) {
-      total_deallocations_.fetch_add(1, std::memory_order_relaxed);
-      active_allocations_.fetch_sub(1, std::memory_order_relaxed);
+      counts_.add(kDeallocationsSlot, 1);
     }
     if constexpr (StatsLevel >= 4) {
-      current_allocated_bytes_.fetch_sub(size, std::memory_order_relaxed);
+      allocated_bytes_.sub(size);
+    }
+  }
+
+  /**
+   * @brief サイズクラス別カウンタを確保する（SegregatePool::initialize から）。
+   */
+  void configureSizeClasses(std::size_t size_class_count) {
+    if constexpr (kSizeClassStatsEnabled) {
+      size_classes_ = std::make_unique<SizeClassCounters[]>(size_class_count);
+      size_class_count_ = size_class_count;
+    }
+  }
+
+  std::size_t sizeClassCount() const noexcept { return size_class_count_; }
+
+  /**
+   * @brief small ブロックの確保をサイズクラス別に記録する。
+   * @param index サイズクラスインデックス
+   * @param size 要求サイズ
+   * @param block_size 払い出したブロックのサイズ
+   */
+  void updateSizeClassAlloc(std::size_t index, std::size_t size,
+                            std::size_t block_size) noexcept {
+    if constexpr (kSizeClassStatsEnabled) {
+      if (index >= size_class_count_) {
+        return;
+      }
+      SizeClassCounters &counters = size_classes_[index];
+      const uint64_t allocations =
+          counters.allocations.fetch_add(1, std::memory_order_relaxed) + 1;
+      if (block_size > size) {
+        counters.wasted_bytes.fetch_add(block_size - size,
+                                        std::memory_order_relaxed);
+      }
+      const uint64_t deallocations =
+          counters.deallocations.load(std::memory_order_relaxed);
+      const uint64_t live =
+          allocations >= deallocations ? allocations - deallocations : 0;
+      uint64_t peak = counters.peak_live_blocks.load(std::memory_order_relaxed);
+      while (live > peak && !counters.peak_live_blocks.compare_exchange_weak(
+                                peak, live, std::memory_order_relaxed)) {
+      }
     }
   }
 
+  void updateSizeClassDealloc(std::size_t index, std::size_t size,
+                              std::size_t block_size) noexcept {
+    if constexpr (kSizeClassStatsEnabled) {
+      if (index >= size_class_count_) {
+        return;
+      }
+      SizeClassCounters &counters = size_classes_[index];
+      counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+      if (block_size > size) {
+        counters.wasted_bytes.fetch_sub(block_size - size,
+                                        std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief カウンタ部分のスナップショットを作る。
+   *
+   * block_size / free_blocks / チャンク情報はプール側で埋める。
+   */
+  SegregatePoolStatsSnapshot snapshot() const {
+    SegregatePoolStatsSnapshot out{};
+    out.total_allocations = totalAllocations();
+    out.total_deallocations = totalDeallocations();
+    out.active_allocations = activeAllocations();
+    out.large_allocations = largeAllocations();
+    out.pool_expansions = poolExpansions();
+    out.current_allocated_bytes = currentAllocatedBytes();
+    out.peak_allocated_bytes = peakAllocatedBytes();
+    out.size_classes.resize(size_class_count_);
+    for (std::size_t i = 0; i < size_class_count_; ++i) {
+      const SizeClassCounters &counters = size_classes_[i];
+      auto &c = out.size_classes[i];
+      c.index = i;
+      c.allocations = counters.allocations.load(std::memory_order_relaxed);
+      c.deallocations = counters.deallocations.load(std::memory_order_relaxed);
+      c.live_blocks =
+          c.allocations >= c.deallocations ? c.allocations - c.deallocations : 0;
+      c.wasted_bytes = counters.wasted_bytes.load(std::memory_order_relaxed);
+      c.peak_live_blocks =
+          counters.peak_live_blocks.load(std::memory_order_relaxed);
+    }
+    return out;
+  }
+
   void updateExpansion() noexcept {
     if constexpr (StatsLevel >= 2) {
-      pool_expansions_.fetch_add(1, std::memory_order_relaxed);
+      counts_.add(kExpansionsSlot, 1);
     }
   }
 
@@ -200,13 +371,24 @@ public:
   void print() const { std::cout << toString(); }
 
 private:
-  std::atomic<uint64_t> total_allocations_{0};
-  std::atomic<uint64_t> total_deallocations_{0};
-  std::atomic<uint64_t> active_allocations_{0};
-  std::atomic<uint64_t> large_allocations_{0};
-  std::atomic<uint64_t> pool_expansions_{0};
-  std::atomic<uint64_t> current_allocated_bytes_{0};
-  std::atomic<uint64_t> peak_allocated_bytes_{0};
+  // サイズクラスごとに別キャッシュラインに置き、シャードロック間の偽共有を避ける
+  struct alignas(64) SizeClassCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> deallocations{0};
+    std::atomic<uint64_t> wasted_bytes{0};
+    std::atomic<uint64_t> peak_live_blocks{0};
+  };
+
+  // 全体カウンタのスロット（active は allocations - deallocations で求める）
+  static constexpr std::size_t kAllocationsSlot = 0;
+  static constexpr std::size_t kDeallocationsSlot = 1;
+  static constexpr std::size_t kLargeAllocationsSlot = 2;
+  static constexpr std::size_t kExpansionsSlot = 3;
+
+  ::orteaf::internal::base::ShardedCounters<4> counts_{};
+  ::orteaf::internal::base::ShardedGauge allocated_bytes_{};
+  std::unique_ptr<SizeClassCounters[]> size_classes_{};
+  std::size_t size_class_count_{0};
 };
 
 } // namespace orteaf::internal::execution::allocator::pool
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <orteaf/internal/diagnostics/error/error_macros.h>
+#include <orteaf/internal/execution/allocator/pool/segregate_pool_stats.h>
+
+namespace orteaf::internal::execution::allocator::pool {
+
+/**
+ * @brief ウォームアップで事前に用意するブロック数（サイズクラス 1 つ分）。
+ *
+ * block_size はサイズクラスのブロックサイズ（要求サイズでもよく、その場合は
+ * 該当サイズクラスに丸められる）。サイズクラスのインデックスは min_block_size
+ * によって変わるため、プロファイルはブロックサイズで持つ。
+ */
+struct SegregatePoolWarmupEntry {
+  std::size_t block_size{0};
+  std::size_t blocks{0};
+
+  friend bool operator==(const SegregatePoolWarmupEntry &,
+                         const SegregatePoolWarmupEntry &) = default;
+};
+
+using SegregatePoolWarmupProfile = std::vector<SegregatePoolWarmupEntry>;
+
+/**
+ * @brief LaunchParams を既定構築できないプールの Config::warmup。
+ *
+ * initialize はウォームアップ用の LaunchParams を用意できないため、
+ * プロファイルの代入をコンパイル時に拒否する。その場合は
+ * SegregatePool::warmup() を LaunchParams 付きで直接呼ぶ。
+ */
+struct SegregatePoolWarmupUnavailable {
+  SegregatePoolWarmupUnavailable &
+  operator=(const SegregatePoolWarmupProfile &) = delete;
+
+  bool empty() const noexcept { return true; }
+};
+
+/**
+ * @brief 前回の実行の統計からウォームアッププロファイルを作る。
+ *
+ * サイズクラスごとに生存ブロック数の最大値（取れなければ現在の生存数）を使う。
+ * 一度も使われなかったサイズクラスは含めない。
+ */
+inline SegregatePoolWarmupProfile
+makeWarmupProfile(const SegregatePoolStatsSnapshot &snapshot) {
+  SegregatePoolWarmupProfile profile;
+  for (const auto &size_class : snapshot.size_classes) {
+    const uint64_t blocks = size_class.peak_live_blocks != 0
+                                ? size_class.peak_live_blocks
+                                : size_class.live_blocks;
+    if (blocks != 0 && size_class.block_size != 0) {
+      profile.push_back({size_class.block_size,
+                         static_cast<std::size_t>(blocks)});
+    }
+  }
+  return profile;
+}
+
+/**
+ * @brief プロファイルを "block_size blocks" の行形式で書き出す。
+ */
+inline std::string
+formatWarmupProfile(const SegregatePoolWarmupProfile &profile) {
+  std::ostringstream oss;
+  for (const auto &entry : profile) {
+    oss << entry.block_size << ' ' << entry.blocks << '\n';
+  }
+  return oss.str();
+}
+
+/**
+ * @brief formatWarmupProfile の出力を読み込む。
+ *
+ * 空行と '#' で始まる行は無視する。形式が不正な場合は InvalidArgument を投げる。
+ */
+inline SegregatePoolWarmupProfile parseWarmupProfile(const std::string &text) {
+  SegregatePoolWarmupProfile profile;
+  std::istringstream lines(text);
+  std::string line;
+  while (std::getline(lines, line)) {
+    const auto first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    SegregatePoolWarmupEntry entry{};
+    std::string rest;
+    ORTEAF_THROW_IF(!(fields >> entry.block_size >> entry.blocks) ||
+                        (fields >> rest),
+                    InvalidArgument, "invalid warmup profile line: " + line);
+    profile.push_back(entry);
+  }
+  return profile;
+}
+
+} // namespace orteaf::internal::execution::allocator::pool
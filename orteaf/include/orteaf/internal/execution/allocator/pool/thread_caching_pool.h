@@ -0,0 +1,353 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <orteaf/internal/base/heap_vector.h>
+
+namespace orteaf::internal::execution::allocator::pool {
+
+/**
+ * @brief SegregatePool の前段に置くスレッドローカルキャッシュ（magazine）。
+ *
+ * スレッドごと・サイズクラスごとにブロックのスタック（magazine）を持ち、
+ * 空になったら SegregatePool::allocateBatch でまとめて refill、
+ * 上限に達したら SegregatePool::deallocateBatch でまとめて flush する。
+ * 大半の alloc/free は magazine 内で完結し、プールのロックを取らない。
+ *
+ * - large 扱いの要求（max_block_size 超など）は常にプールへ直接委譲する。
+ * - ReuseToken が未完了のブロックはキャッシュせずプールへ返す。
+ *   DeferredReusePolicy による完了待ちはそのまま維持される。
+ * - キャッシュ内のブロックは ChunkLocator 上 used として計上されたままなので、
+ *   キャッシュされている間はチャンクが解放対象にならない。
+ *
+ * プールの統計（SegregatePoolStats）は magazine 単位で記録される。
+ * refill / flush はブロックサイズを要求サイズとして渡すため、サイズクラス別の
+ * wasted_bytes は 0 のままで、live / peak はユーザの確保数ではなく
+ * magazine を含めてプールから払い出されたブロック数を表す。
+ * ヒット時にプール共有のカウンタを更新しないことがキャッシュの目的なので、
+ * 要求単位の統計が必要な場合はキャッシュを通さずにプールを使うこと。
+ *
+ * プール本体は所有しない（寿命は呼び出し側が管理する）。
+ * flushAll() とデストラクタは、他スレッドが本インスタンスを使用していない
+ * ことを前提とする。
+ *
+ * スレッド終了時には、そのスレッドの magazine が生存中のインスタンスへ
+ * 自動的に返却される。インスタンス破棄時に残っている他スレッドの
+ * キャッシュは flush 済みの空の状態で各スレッドへ引き渡され、
+ * 次の登録時かスレッド終了時に解放される。
+ *
+ * @tparam Pool SegregatePool インスタンス型
+ */
+template <typename Pool> class ThreadCachingPool {
+public:
+  using BufferResource = typename Pool::BufferResource;
+  using LaunchParams = typename Pool::LaunchParams;
+
+  struct Config {
+    /// サイズクラスごとに保持する最大ブロック数
+    std::size_t magazine_capacity{64};
+    /// refill / flush 1 回あたりのブロック数（0 なら capacity / 2）
+    std::size_t batch_size{0};
+  };
+
+  explicit ThreadCachingPool(Pool &pool, const Config &config = {})
+      : pool_(&pool), id_(nextInstanceId()) {
+    magazine_capacity_ = config.magazine_capacity == 0
+                             ? std::size_t{1}
+                             : config.magazine_capacity;
+    batch_size_ = config.batch_size == 0 ? magazine_capacity_ / 2
+                                         : config.batch_size;
+    if (batch_size_ == 0) {
+      batch_size_ = 1;
+    }
+    if (batch_size_ > magazine_capacity_) {
+      batch_size_ = magazine_capacity_;
+    }
+  }
+
+  ThreadCachingPool(const ThreadCachingPool &) = delete;
+  ThreadCachingPool &operator=(const ThreadCachingPool &) = delete;
+  ThreadCachingPool(ThreadCachingPool &&) = delete;
+  ThreadCachingPool &operator=(ThreadCachingPool &&) = delete;
+
+  ~ThreadCachingPool() {
+    std::lock_guard<std::mutex> lock(ownershipMutex());
+    flushAll();
+    // 生存中のスレッドが持つキャッシュは切り離し、そのスレッド側で解放させる。
+    for (std::size_t i = 0; i < caches_.size(); ++i) {
+      caches_[i]->owner = nullptr;
+    }
+    caches_.clear();
+    localCaches().pruneDetached();
+  }
+
+  Pool &pool() { return *pool_; }
+  std::size_t magazine_capacity() const { return magazine_capacity_; }
+  std::size_t batch_size() const { return batch_size_; }
+
+  BufferResource allocate(std::size_t size, std::size_t alignment,
+                          LaunchParams &launch_params) {
+    if (size == 0) {
+      return BufferResource{};
+    }
+    const std::size_t list_idx = pool_->sizeClassIndexFor(size, alignment);
+    if (list_idx >= pool_->size_class_count()) {
+      return pool_->allocate(size, alignment, launch_params);
+    }
+
+    ThreadCache &cache = localCache();
+    Magazine &magazine = cache.magazine(list_idx);
+
+    if (magazine.empty()) {
+      refill(magazine, list_idx, alignment, launch_params);
+      if (magazine.empty()) {
+        return BufferResource{};
+      }
+    }
+
+    BufferResource block = std::move(magazine.back());
+    magazine.resize(magazine.size() - 1);
+    return block;
+  }
+
+  void deallocate(BufferResource block, std::size_t size,
+                  std::size_t alignment, LaunchParams &launch_params) {
+    if (!block.valid() || size == 0) {
+      return;
+    }
+    const std::size_t list_idx = pool_->sizeClassIndexFor(size, alignment);
+    if (list_idx >= pool_->size_class_count() ||
+        !pool_->resource()->isCompleted(block.reuse_token)) {
+      pool_->deallocate(std::move(block), size, alignment, launch_params);
+      return;
+    }
+
+    ThreadCache &cache = localCache();
+    Magazine &magazine = cache.magazine(list_idx);
+
+    if (magazine.size() >= magazine_capacity_) {
+      flush(magazine, list_idx, batch_size_, alignment, launch_params);
+    }
+    magazine.pushBack(std::move(block));
+  }
+
+  /**
+   * @brief 呼び出しスレッドのキャッシュをすべてプールへ返す。
+   */
+  void flushThreadCache(LaunchParams &launch_params) {
+    if (ThreadCache *cache = findLocalCache()) {
+      flushCache(*cache, launch_params);
+    }
+  }
+
+  /**
+   * @brief 全スレッドのキャッシュをプールへ返す。
+   *
+   * 他スレッドが本インスタンスで alloc/free していないときのみ呼ぶこと。
+   */
+  void flushAll() {
+    LaunchParams launch_params{};
+    flushAll(launch_params);
+  }
+
+  void flushAll(LaunchParams &launch_params) {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    for (std::size_t i = 0; i < caches_.size(); ++i) {
+      flushCache(*caches_[i], launch_params);
+    }
+  }
+
+  /**
+   * @brief 呼び出しスレッドのキャッシュに保持されているブロック数を返す。
+   */
+  std::size_t cachedBlockCount() const {
+    const ThreadCache *cache = findLocalCache();
+    if (cache == nullptr) {
+      return 0;
+    }
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < cache->magazines.size(); ++i) {
+      total += cache->magazines[i].size();
+    }
+    return total;
+  }
+
+private:
+  using Magazine = ::orteaf::internal::base::HeapVector<BufferResource>;
+
+  struct ThreadCache {
+    ::orteaf::internal::base::HeapVector<Magazine> magazines{};
+    /// 所属インスタンス。破棄後は nullptr（ownershipMutex() で保護）
+    ThreadCachingPool *owner{nullptr};
+
+    Magazine &magazine(std::size_t list_idx) {
+      if (list_idx >= magazines.size()) {
+        magazines.resize(list_idx + 1);
+      }
+      return magazines[list_idx];
+    }
+  };
+
+  struct LocalEntry {
+    std::uint64_t owner_id{0};
+    std::unique_ptr<ThreadCache> cache{};
+  };
+
+  /**
+   * @brief スレッドごとのキャッシュ一覧。デストラクタがスレッド終了フックになる。
+   *
+   * 終了時、まだ生存しているインスタンスへ magazine を返してから解放する。
+   */
+  struct LocalCaches {
+    ::orteaf::internal::base::HeapVector<LocalEntry> entries{};
+
+    LocalCaches() = default;
+    LocalCaches(const LocalCaches &) = delete;
+    LocalCaches &operator=(const LocalCaches &) = delete;
+
+    ~LocalCaches() {
+      std::lock_guard<std::mutex> lock(ownershipMutex());
+      LaunchParams launch_params{};
+      for (std::size_t i = 0; i < entries.size(); ++i) {
+        ThreadCache &cache = *entries[i].cache;
+        if (cache.owner != nullptr) {
+          cache.owner->retireCache(cache, launch_params);
+        }
+      }
+    }
+
+    // ownershipMutex() を保持して呼ぶこと。
+    void pruneDetached() {
+      std::size_t i = 0;
+      while (i < entries.size()) {
+        if (entries[i].cache->owner == nullptr) {
+          entries[i] = std::move(entries.back());
+          entries.popBack();
+        } else {
+          ++i;
+        }
+      }
+    }
+  };
+
+  static std::uint64_t nextInstanceId() {
+    static std::atomic<std::uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // スレッド終了とインスタンス破棄の間で ThreadCache の所有権の受け渡しを
+  // 直列化する。
+  static std::mutex &ownershipMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  // インスタンス ID は再利用しないため、破棄済みプールのエントリが
+  // 新しいインスタンスと一致することはない。破棄済みのエントリは
+  // 新規登録時に取り除くので、走査対象は生存中のインスタンス数に収まる。
+  static LocalCaches &localCaches() {
+    thread_local LocalCaches caches;
+    return caches;
+  }
+
+  ThreadCache *findLocalCache() const {
+    auto &entries = localCaches().entries;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+      if (entries[i].owner_id == id_) {
+        return entries[i].cache.get();
+      }
+    }
+    return nullptr;
+  }
+
+  ThreadCache &localCache() {
+    if (ThreadCache *cache = findLocalCache()) {
+      return *cache;
+    }
+    auto owned = std::make_unique<ThreadCache>();
+    owned->magazines.resize(pool_->size_class_count());
+    owned->owner = this;
+    ThreadCache *cache = owned.get();
+    {
+      std::lock_guard<std::mutex> lock(registry_mutex_);
+      caches_.pushBack(cache);
+    }
+    LocalCaches &local = localCaches();
+    {
+      std::lock_guard<std::mutex> lock(ownershipMutex());
+      local.pruneDetached();
+    }
+    local.entries.pushBack(LocalEntry{id_, std::move(owned)});
+    return *cache;
+  }
+
+  // 終了するスレッドのキャッシュをプールへ返し、登録を外す。
+  // ownershipMutex() を保持して呼ぶこと。
+  void retireCache(ThreadCache &cache, LaunchParams &launch_params) {
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    flushCache(cache, launch_params);
+    for (std::size_t i = 0; i < caches_.size(); ++i) {
+      if (caches_[i] == &cache) {
+        caches_[i] = caches_.back();
+        caches_.popBack();
+        break;
+      }
+    }
+  }
+
+  void refill(Magazine &magazine, std::size_t list_idx, std::size_t alignment,
+              LaunchParams &launch_params) {
+    const std::size_t old_size = magazine.size();
+    magazine.resize(old_size + batch_size_);
+    const std::size_t got =
+        pool_->allocateBatch(blockSizeOf(list_idx), alignment,
+                             magazine.data() + old_size, batch_size_,
+                             launch_params);
+    magazine.resize(old_size + got);
+  }
+
+  void flush(Magazine &magazine, std::size_t list_idx, std::size_t count,
+             std::size_t alignment, LaunchParams &launch_params) {
+    if (count > magazine.size()) {
+      count = magazine.size();
+    }
+    if (count == 0) {
+      return;
+    }
+    // 古いブロック（スタック底側）から返し、ホットなブロックを手元に残す。
+    pool_->deallocateBatch(magazine.data(), count, blockSizeOf(list_idx),
+                           alignment, launch_params);
+    const std::size_t remaining = magazine.size() - count;
+    for (std::size_t i = 0; i < remaining; ++i) {
+      magazine[i] = std::move(magazine[count + i]);
+    }
+    magazine.resize(remaining);
+  }
+
+  void flushCache(ThreadCache &cache, LaunchParams &launch_params) {
+    for (std::size_t idx = 0; idx < cache.magazines.size(); ++idx) {
+      Magazine &magazine = cache.magazines[idx];
+      flush(magazine, idx, magazine.size(), 0, launch_params);
+    }
+  }
+
+  std::size_t blockSizeOf(std::size_t list_idx) const {
+    return pool_->sizeClassBlockSize(list_idx);
+  }
+
+  Pool *pool_{nullptr};
+  std::uint64_t id_{0};
+  std::size_t magazine_capacity_{64};
+  std::size_t batch_size_{32};
+
+  std::mutex registry_mutex_;
+  // 各スレッドの LocalCaches が所有するキャッシュへの非所有ポインタ
+  ::orteaf::internal::base::HeapVector<ThreadCache *> caches_{};
+};
+
+} // namespace orteaf::internal::execution::allocator::pool
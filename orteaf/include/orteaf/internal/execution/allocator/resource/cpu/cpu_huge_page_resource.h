@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+
+#include "orteaf/internal/execution/allocator/buffer.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_tokens.h"
+#include "orteaf/internal/execution/execution.h"
+
+namespace orteaf::internal::execution::cpu {
+
+// CPU execution resource that backs each allocation with huge pages.
+// Allocations are rounded up to kHugePageSize and mapped 2 MiB-aligned via
+// mmap, then advised with MADV_HUGEPAGE so the kernel can back them with
+// transparent huge pages. With Config::use_hugetlb the mapping is requested
+// from the hugetlbfs pool (MAP_HUGETLB) first, falling back to the
+// transparent path when no huge pages are reserved.
+// Intended as the chunk resource for SegregatePool, where every allocation
+// is a large pool chunk.
+class CpuHugePageResource {
+public:
+    using BufferView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+    using BufferResource =
+        ::orteaf::internal::execution::allocator::ExecutionBuffer<::orteaf::internal::execution::Execution::Cpu>;
+    using BufferBlock =
+        ::orteaf::internal::execution::allocator::ExecutionBufferBlock<::orteaf::internal::execution::Execution::Cpu>;
+    using FenceToken = ::orteaf::internal::execution::cpu::resource::FenceToken;
+    using ReuseToken = typename BufferResource::ReuseToken;
+    struct LaunchParams {};
+
+    static constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+
+    struct Config {
+        // Try MAP_HUGETLB before falling back to transparent huge pages.
+        bool use_hugetlb{false};
+    };
+
+    static constexpr ::orteaf::internal::execution::Execution execution_type_static() noexcept {
+        return ::orteaf::internal::execution::Execution::Cpu;
+    }
+    constexpr ::orteaf::internal::execution::Execution execution_type() const noexcept {
+        return execution_type_static();
+    }
+
+    static void initialize() noexcept;
+    static void initialize(const Config& config) noexcept;
+
+    static BufferView allocate(std::size_t size, std::size_t alignment);
+
+    static void deallocate(BufferView view, std::size_t size, std::size_t alignment);
+
+    static bool isCompleted(const FenceToken& token);
+    static bool isCompleted(const ReuseToken& token);
+
+    static BufferView makeView(BufferView base, std::size_t offset, std::size_t size);
+
+    // Bytes actually mapped for a request of `size` bytes.
+    static std::size_t mappedSize(std::size_t size) noexcept;
+};
+
+}  // namespace orteaf::internal::execution::cpu
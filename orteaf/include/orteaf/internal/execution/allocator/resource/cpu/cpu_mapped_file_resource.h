@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "orteaf/internal/execution/allocator/buffer.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_tokens.h"
+#include "orteaf/internal/execution/execution.h"
+
+namespace orteaf::internal::execution::cpu {
+
+// Read-only CPU resource backed by an mmap of a file (e.g. model weights).
+// Views alias the page cache directly, so loading a weight file neither
+// copies it nor doubles RSS; pages are faulted in on first touch or earlier
+// via prefetch(). Files of at least kHugePageSize are mapped at a 2 MiB
+// aligned address and advised with MADV_HUGEPAGE, so tensors stored at
+// 2 MiB aligned file offsets can be backed by huge pages where the kernel
+// supports it for file mappings.
+// Unlike the heap resources this one is stateful (one instance per file)
+// and has no allocate(); the mapping is released when the instance dies.
+// Writing through a view is undefined behaviour (the pages are PROT_READ).
+class CpuMappedFileResource {
+public:
+    using BufferView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+    using BufferResource =
+        ::orteaf::internal::execution::allocator::ExecutionBuffer<::orteaf::internal::execution::Execution::Cpu>;
+    using BufferBlock =
+        ::orteaf::internal::execution::allocator::ExecutionBufferBlock<::orteaf::internal::execution::Execution::Cpu>;
+    using FenceToken = ::orteaf::internal::execution::cpu::resource::FenceToken;
+    using ReuseToken = typename BufferResource::ReuseToken;
+    struct LaunchParams {};
+
+    static constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+
+    // Access pattern hint applied to the whole mapping (madvise).
+    enum class Access {
+        Normal,
+        Sequential,
+        Random,
+    };
+
+    struct Config {
+        Access access{Access::Normal};
+        // Ask the kernel to read the whole file ahead (MADV_WILLNEED).
+        bool prefetch{false};
+        // Map 2 MiB aligned and advise MADV_HUGEPAGE for files >= kHugePageSize.
+        // Falls back to an unaligned mapping if the aligned one fails.
+        bool huge_page_align{true};
+    };
+
+    static constexpr ::orteaf::internal::execution::Execution execution_type_static() noexcept {
+        return ::orteaf::internal::execution::Execution::Cpu;
+    }
+    constexpr ::orteaf::internal::execution::Execution execution_type() const noexcept {
+        return execution_type_static();
+    }
+
+    CpuMappedFileResource() = default;
+    // Throws OperationFailed if the file cannot be opened, stat'ed or mapped.
+    explicit CpuMappedFileResource(const std::string& path);
+    CpuMappedFileResource(const std::string& path, const Config& config);
+
+    CpuMappedFileResource(const CpuMappedFileResource&) = delete;
+    CpuMappedFileResource& operator=(const CpuMappedFileResource&) = delete;
+    CpuMappedFileResource(CpuMappedFileResource&& other) noexcept;
+    CpuMappedFileResource& operator=(CpuMappedFileResource&& other) noexcept;
+    ~CpuMappedFileResource();
+
+    bool isOpen() const noexcept { return opened_; }
+    std::size_t size() const noexcept { return size_; }
+    const void* data() const noexcept { return base_; }
+    // True when the mapping starts on a kHugePageSize boundary.
+    bool hugePageAligned() const noexcept;
+
+    // Whole file.
+    BufferView view() const noexcept { return BufferView{base_, 0, size_}; }
+    // [offset, offset + size) of the file; throws OutOfRange past the end.
+    BufferView view(std::size_t offset, std::size_t size) const;
+
+    // Hints the kernel to read [offset, offset + size) ahead (MADV_WILLNEED).
+    void prefetch(std::size_t offset, std::size_t size) const;
+    // Tells the kernel [offset, offset + size) is not needed soon (MADV_DONTNEED);
+    // the pages are re-read from the file on the next access.
+    void evict(std::size_t offset, std::size_t size) const;
+
+    void close() noexcept;
+
+    static bool isCompleted(const FenceToken& token);
+    static bool isCompleted(const ReuseToken& token);
+
+    static BufferView makeView(BufferView base, std::size_t offset, std::size_t size);
+
+private:
+    void advise(std::size_t offset, std::size_t size, int advice) const;
+
+    void* base_{nullptr};
+    std::size_t size_{0};
+    // Page-rounded length of the mapping.
+    std::size_t mapped_size_{0};
+    bool opened_{false};
+};
+
+}  // namespace orteaf::internal::execution::cpu
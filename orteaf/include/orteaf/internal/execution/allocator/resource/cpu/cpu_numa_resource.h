@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+
+#include "orteaf/internal/execution/allocator/buffer.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_tokens.h"
+#include "orteaf/internal/execution/execution.h"
+
+namespace orteaf::internal::execution::cpu {
+
+// CPU execution resource that places every allocation on one NUMA node.
+// Memory is mapped with mmap and bound to node() with mbind before it is
+// touched. When binding is unavailable (single-node machines, non-Linux
+// hosts) the mapping is left to first-touch placement, which puts pages on
+// the node of the thread that writes them first.
+// Alignments above the page size (SegregatePool aligns chunks to the block
+// size) are met by over-reserving and trimming the mapping.
+// Unlike CpuResource this type is stateful: each instance remembers its
+// node, so a SegregatePool constructed with it owns node-local chunks.
+// The node is a kernel node ID; IDs that are not online fall back to the
+// first online node.
+class CpuNumaResource {
+public:
+    using BufferView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+    using BufferResource =
+        ::orteaf::internal::execution::allocator::ExecutionBuffer<::orteaf::internal::execution::Execution::Cpu>;
+    using BufferBlock =
+        ::orteaf::internal::execution::allocator::ExecutionBufferBlock<::orteaf::internal::execution::Execution::Cpu>;
+    using FenceToken = ::orteaf::internal::execution::cpu::resource::FenceToken;
+    using ReuseToken = typename BufferResource::ReuseToken;
+    struct LaunchParams {};
+
+    CpuNumaResource() = default;
+    explicit CpuNumaResource(std::size_t node) noexcept;
+
+    static constexpr ::orteaf::internal::execution::Execution execution_type_static() noexcept {
+        return ::orteaf::internal::execution::Execution::Cpu;
+    }
+    constexpr ::orteaf::internal::execution::Execution execution_type() const noexcept {
+        return execution_type_static();
+    }
+
+    std::size_t node() const noexcept { return node_; }
+
+    BufferView allocate(std::size_t size, std::size_t alignment);
+
+    void deallocate(BufferView view, std::size_t size, std::size_t alignment);
+
+    static bool isCompleted(const FenceToken& token);
+    static bool isCompleted(const ReuseToken& token);
+
+    static BufferView makeView(BufferView base, std::size_t offset, std::size_t size);
+
+private:
+    std::size_t node_{0};
+};
+
+}  // namespace orteaf::internal::execution::cpu
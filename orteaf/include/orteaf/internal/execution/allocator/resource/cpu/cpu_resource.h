@@ -1,22 +1,39 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <optional>
 
+#include "orteaf/internal/execution/allocator/buffer.h"
 #include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
 #include "orteaf/internal/execution/cpu/resource/cpu_tokens.h"
+#include "orteaf/internal/execution/execution.h"
 
 namespace orteaf::internal::execution::cpu {
 
 // CPU execution resource for direct allocation.
 // For low-level heap operations (reserve/map/unmap), use CpuHeapOps.
+// Also usable as the ExecutionResource of a SegregatePool.
 class CpuResource {
 public:
     using BufferView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+    using BufferResource =
+        ::orteaf::internal::execution::allocator::ExecutionBuffer<::orteaf::internal::execution::Execution::Cpu>;
+    using BufferBlock =
+        ::orteaf::internal::execution::allocator::ExecutionBufferBlock<::orteaf::internal::execution::Execution::Cpu>;
     using FenceToken = ::orteaf::internal::execution::cpu::resource::FenceToken;
-    using ReuseToken = ::orteaf::internal::execution::cpu::resource::ReuseToken;
+    using ReuseToken = typename BufferResource::ReuseToken;
+    struct LaunchParams {};
 
     struct Config {};
 
+    static constexpr ::orteaf::internal::execution::Execution execution_type_static() noexcept {
+        return ::orteaf::internal::execution::Execution::Cpu;
+    }
+    constexpr ::orteaf::internal::execution::Execution execution_type() const noexcept {
+        return execution_type_static();
+    }
+
     static void initialize(const Config& config = {}) noexcept;
 
     static BufferView allocate(std::size_t size, std::size_t alignment);
@@ -26,6 +43,11 @@ public:
     static bool isCompleted(const FenceToken& token);
     static bool isCompleted(const ReuseToken& token);
 
+    // Host work is synchronous, so every reuse token is already complete and
+    // all of them share one trivially ordered queue (key 0). This lets
+    // QueueOrderedReusePolicy release a whole batch with a single check.
+    static std::optional<std::uint64_t> reuseQueueKey(const ReuseToken& token) noexcept;
+
     static BufferView makeView(BufferView base, std::size_t offset, std::size_t size);
 };
 
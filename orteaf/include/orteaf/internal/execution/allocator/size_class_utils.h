@@ -66,4 +66,90 @@ inline constexpr std::size_t sizeClassToBlockSize(std::size_t index,
   return std::bit_ceil(min_block_size) << index;
 }
 
+// ============================================================================
+// 幾何級数サイズクラス（オクターブ内サブクラス）
+// ============================================================================
+//
+// 2の冪乗の各オクターブ (B*2^o, B*2^(o+1)] を sub_classes 個に等分する
+// jemalloc 風のサイズクラス。B = bit_ceil(min_block_size)。
+//
+// 例: min_block_size=64, sub_classes=4 の場合
+//   index 0 -> 64
+//   index 1..4 -> 80, 96, 112, 128
+//   index 5..8 -> 160, 192, 224, 256
+//
+// sub_classes=1 のときは上記の2の冪乗スキームと一致する。
+// 前提: sub_classes は2の冪乗かつ bit_ceil(min_block_size) 以下。
+
+/**
+ * @brief 幾何級数スキームでブロックサイズからサイズクラスインデックスを計算
+ *
+ * @param block_size 対象のブロックサイズ（クラス境界でない場合は切り上げ）
+ * @param min_block_size 最小ブロックサイズ（サイズクラス0に対応）
+ * @param sub_classes オクターブあたりのサブクラス数
+ * @return サイズクラスインデックス
+ */
+inline constexpr std::size_t
+geometricSizeClassIndex(std::size_t block_size, std::size_t min_block_size,
+                        std::size_t sub_classes) {
+  const std::size_t base = std::bit_ceil(min_block_size);
+  if (block_size <= base) {
+    return 0;
+  }
+  const std::size_t octave =
+      static_cast<std::size_t>(std::bit_width((block_size - 1) / base)) - 1;
+  const std::size_t octave_base = base << octave;
+  const std::size_t step = octave_base / sub_classes;
+  const std::size_t sub = (block_size - octave_base + step - 1) / step;
+  return octave * sub_classes + sub;
+}
+
+/**
+ * @brief 幾何級数スキームでサイズクラスインデックスからブロックサイズを計算
+ *
+ * @param index サイズクラスインデックス
+ * @param min_block_size 最小ブロックサイズ
+ * @param sub_classes オクターブあたりのサブクラス数
+ * @return 対応するブロックサイズ
+ */
+inline constexpr std::size_t
+geometricSizeClassToBlockSize(std::size_t index, std::size_t min_block_size,
+                              std::size_t sub_classes) {
+  const std::size_t base = std::bit_ceil(min_block_size);
+  if (index == 0) {
+    return base;
+  }
+  const std::size_t octave = (index - 1) / sub_classes;
+  const std::size_t sub = (index - 1) % sub_classes + 1;
+  const std::size_t octave_base = base << octave;
+  return octave_base + sub * (octave_base / sub_classes);
+}
+
+/**
+ * @brief 幾何級数スキームで min/max ブロックサイズからサイズクラスの総数を計算
+ *
+ * 例: min=64, max=256, sub_classes=4 の場合
+ *   64, 80, 96, 112, 128, 160, 192, 224, 256 -> 9 クラス
+ */
+inline constexpr std::size_t
+geometricSizeClassCount(std::size_t min_block_size, std::size_t max_block_size,
+                        std::size_t sub_classes) {
+  if (max_block_size < min_block_size || min_block_size == 0) {
+    return 0;
+  }
+  return geometricSizeClassIndex(max_block_size, min_block_size, sub_classes) +
+         1;
+}
+
+/**
+ * @brief 要求サイズを幾何級数スキームのブロックサイズへ切り上げる
+ */
+inline constexpr std::size_t geometricBlockSize(std::size_t size,
+                                                std::size_t min_block_size,
+                                                std::size_t sub_classes) {
+  return geometricSizeClassToBlockSize(
+      geometricSizeClassIndex(size, min_block_size, sub_classes),
+      min_block_size, sub_classes);
+}
+
 } // namespace orteaf::internal::execution::allocator
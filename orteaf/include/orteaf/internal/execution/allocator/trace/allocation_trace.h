@@ -0,0 +1,144 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace orteaf::internal::execution::allocator::trace {
+
+/**
+ * @brief トレースに記録する操作の種類。
+ */
+enum class AllocationTraceOp : std::uint8_t {
+  Allocate = 0,
+  Deallocate = 1,
+};
+
+/**
+ * @brief allocate / deallocate 1 回分の記録。
+ *
+ * id は allocate ごとに 0 から連番で振られ、対応する deallocate は同じ id を持つ。
+ * thread は記録中に初めて現れた順に 0 から振ったスレッド番号。
+ * timestamp_ns は記録開始からの経過時間。
+ */
+struct AllocationTraceEvent {
+  AllocationTraceOp op{AllocationTraceOp::Allocate};
+  std::uint32_t thread{0};
+  std::uint64_t id{0};
+  std::uint64_t size{0};
+  std::uint64_t alignment{0};
+  std::uint64_t timestamp_ns{0};
+
+  friend bool operator==(const AllocationTraceEvent &,
+                         const AllocationTraceEvent &) = default;
+};
+
+/**
+ * @brief 記録済みのトレース。events は記録された順（全スレッドで直列化済み）。
+ */
+struct AllocationTrace {
+  std::vector<AllocationTraceEvent> events{};
+  /// 振られた allocate id の数（replay 側はこの長さの表で id を引く）
+  std::uint64_t id_count{0};
+  std::uint32_t thread_count{0};
+};
+
+/**
+ * @brief プール内のブロックを識別するキー（ハンドルとビューのオフセット）。
+ */
+struct AllocationTraceKey {
+  std::uint64_t handle{0};
+  std::uint64_t offset{0};
+
+  friend bool operator==(const AllocationTraceKey &,
+                         const AllocationTraceKey &) = default;
+};
+
+/**
+ * @brief allocate / deallocate 列を記録するレコーダ。
+ *
+ * SegregatePool::setTraceRecorder() に渡すと、成功した allocate と
+ * deallocate がすべて記録される。複数スレッドから同時に呼ばれてよい。
+ * 記録はレコーダ内部の mutex で直列化されるため、本番計測中の
+ * オーバーヘッドは 1 操作あたりロック 1 回と map 更新 1 回分になる。
+ *
+ * 記録開始前に確保されたブロックの deallocate は対応する id がないため捨てる。
+ */
+class AllocationTraceRecorder {
+public:
+  AllocationTraceRecorder();
+  AllocationTraceRecorder(const AllocationTraceRecorder &) = delete;
+  AllocationTraceRecorder &operator=(const AllocationTraceRecorder &) = delete;
+
+  /**
+   * @brief allocate を記録する。
+   * @return 振られた id
+   */
+  std::uint64_t recordAllocate(AllocationTraceKey key, std::size_t size,
+                               std::size_t alignment);
+
+  /**
+   * @brief deallocate を記録する。
+   * @return 対応する allocate が記録済みなら true
+   */
+  bool recordDeallocate(AllocationTraceKey key, std::size_t size,
+                        std::size_t alignment);
+
+  /// 記録済みのイベント数
+  std::size_t eventCount() const;
+
+  /// これまでの記録のコピーを返す
+  AllocationTrace snapshot() const;
+
+  /// 記録を破棄し、時刻とスレッド番号を振り直す
+  void clear();
+
+private:
+  struct KeyHash {
+    std::size_t operator()(const AllocationTraceKey &key) const noexcept {
+      return std::hash<std::uint64_t>{}(key.handle * 0x9E3779B97F4A7C15ull ^
+                                        key.offset);
+    }
+  };
+
+  std::uint32_t threadIndexLocked();
+  std::uint64_t nowNs() const;
+
+  mutable std::mutex mutex_;
+  std::chrono::steady_clock::time_point start_;
+  std::vector<AllocationTraceEvent> events_;
+  std::unordered_map<AllocationTraceKey, std::uint64_t, KeyHash> live_;
+  std::unordered_map<std::thread::id, std::uint32_t> threads_;
+  std::uint64_t next_id_{0};
+};
+
+/**
+ * @brief トレースをバイナリ形式にエンコードする。
+ *
+ * 形式: "OATR" + バージョン(u32 LE) + イベント数・id 数・スレッド数(varint)、
+ * 続いて各イベントを [op(1B)] [thread] [id] [size] [alignment]
+ * [前イベントからの時刻差 ns] の順に LEB128 varint で並べる。
+ * 典型的なイベントは 8〜12 バイトに収まる。
+ */
+std::string encodeAllocationTrace(const AllocationTrace &trace);
+
+/**
+ * @brief encodeAllocationTrace の出力を復元する。
+ *
+ * 形式が壊れている場合は InvalidArgument を投げる。
+ */
+AllocationTrace decodeAllocationTrace(const std::string &bytes);
+
+/// トレースをファイルに書き出す（失敗時は OperationFailed を投げる）
+void writeAllocationTrace(const std::string &path,
+                          const AllocationTrace &trace);
+
+/// ファイルからトレースを読み込む（失敗時は OperationFailed を投げる）
+AllocationTrace readAllocationTrace(const std::string &path);
+
+} // namespace orteaf::internal::execution::allocator::trace
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <orteaf/internal/execution/allocator/trace/allocation_trace.h>
+
+namespace orteaf::internal::execution::allocator::trace {
+
+/**
+ * @brief replay で駆動する確保器のアダプタが満たすべき要件。
+ *
+ * - Block: allocate が返す値（デフォルト構築できること）
+ * - allocate(size, alignment) / deallocate(block, size, alignment)
+ * - valid(block): 確保に成功したブロックかどうか
+ * - residentBytes(): その時点で確保器が下位リソースから確保しているバイト数
+ */
+template <typename Target>
+concept AllocationReplayTarget =
+    requires(Target &target, typename Target::Block &block, std::size_t n) {
+      { target.allocate(n, n) } -> std::convertible_to<typename Target::Block>;
+      target.deallocate(block, n, n);
+      { target.residentBytes() } -> std::convertible_to<std::size_t>;
+      { target.valid(block) } -> std::convertible_to<bool>;
+    };
+
+struct AllocationReplayOptions {
+  /// residentBytes() を取る間隔（操作数）。計測時間にはサンプリングを含めない
+  std::size_t sample_interval{256};
+};
+
+/**
+ * @brief replay の結果。
+ *
+ * fragmentation は resident が最大になったサンプル時点での
+ * 1 - (生存中の要求バイト数 / resident バイト数)。
+ */
+struct AllocationReplayReport {
+  std::size_t allocations{0};
+  std::size_t deallocations{0};
+  /// 確保に失敗した allocate と、それに対応して飛ばした deallocate の数
+  std::size_t failed_allocations{0};
+  double seconds{0.0};
+  std::size_t peak_live_bytes{0};
+  std::size_t peak_resident_bytes{0};
+  std::size_t live_bytes_at_peak_resident{0};
+
+  double opsPerSecond() const {
+    return seconds > 0.0
+               ? static_cast<double>(allocations + deallocations) / seconds
+               : 0.0;
+  }
+
+  double fragmentation() const {
+    if (peak_resident_bytes == 0) {
+      return 0.0;
+    }
+    return 1.0 - static_cast<double>(live_bytes_at_peak_resident) /
+                     static_cast<double>(peak_resident_bytes);
+  }
+
+  std::string toJson() const {
+    std::ostringstream out;
+    out << "{\"allocations\":" << allocations
+        << ",\"deallocations\":" << deallocations
+        << ",\"failed_allocations\":" << failed_allocations
+        << ",\"seconds\":" << seconds
+        << ",\"ops_per_second\":" << opsPerSecond()
+        << ",\"peak_live_bytes\":" << peak_live_bytes
+        << ",\"peak_resident_bytes\":" << peak_resident_bytes
+        << ",\"fragmentation\":" << fragmentation() << "}";
+    return out.str();
+  }
+};
+
+/**
+ * @brief トレースを記録順に 1 スレッドで再生する。
+ *
+ * 全スレッドの操作は記録時に直列化された順序で再生するので、結果は
+ * 記録した実行のスレッド数に依存せず再現できる。記録時刻の間隔は再現しない。
+ * トレース終了時点で生存しているブロックは最後にまとめて解放する（計測外）。
+ */
+template <AllocationReplayTarget Target>
+AllocationReplayReport
+replayAllocationTrace(const AllocationTrace &trace, Target &target,
+                      const AllocationReplayOptions &options = {}) {
+  using Block = typename Target::Block;
+  using Clock = std::chrono::steady_clock;
+
+  struct Live {
+    Block block{};
+    std::size_t size{0};
+    std::size_t alignment{0};
+  };
+  std::vector<Live> live(static_cast<std::size_t>(trace.id_count));
+
+  AllocationReplayReport report{};
+  std::size_t live_bytes = 0;
+  const std::size_t interval = std::max<std::size_t>(options.sample_interval, 1);
+
+  auto sample = [&] {
+    const std::size_t resident = target.residentBytes();
+    if (resident > report.peak_resident_bytes) {
+      report.peak_resident_bytes = resident;
+      report.live_bytes_at_peak_resident = live_bytes;
+    }
+  };
+
+  Clock::duration elapsed{};
+  const auto &events = trace.events;
+  for (std::size_t begin = 0; begin < events.size(); begin += interval) {
+    const std::size_t end = std::min(events.size(), begin + interval);
+    const auto start = Clock::now();
+    for (std::size_t i = begin; i < end; ++i) {
+      const AllocationTraceEvent &event = events[i];
+      Live &slot = live[static_cast<std::size_t>(event.id)];
+      if (event.op == AllocationTraceOp::Allocate) {
+        slot.block = target.allocate(static_cast<std::size_t>(event.size),
+                                     static_cast<std::size_t>(event.alignment));
+        if (!target.valid(slot.block)) {
+          ++report.failed_allocations;
+          continue;
+        }
+        slot.size = static_cast<std::size_t>(event.size);
+        slot.alignment = static_cast<std::size_t>(event.alignment);
+        ++report.allocations;
+        live_bytes += slot.size;
+        report.peak_live_bytes = std::max(report.peak_live_bytes, live_bytes);
+      } else {
+        if (!target.valid(slot.block)) {
+          continue;
+        }
+        target.deallocate(slot.block, slot.size, slot.alignment);
+        slot.block = Block{};
+        ++report.deallocations;
+        live_bytes -= slot.size;
+      }
+    }
+    elapsed += Clock::now() - start;
+    sample();
+  }
+  report.seconds = std::chrono::duration<double>(elapsed).count();
+
+  for (auto &slot : live) {
+    if (target.valid(slot.block)) {
+      target.deallocate(slot.block, slot.size, slot.alignment);
+    }
+  }
+  return report;
+}
+
+/**
+ * @brief SegregatePool を replay で駆動するアダプタ。
+ *
+ * resident は ChunkLocator のチャンク総量と生存中の large 確保の合計。
+ * ChunkLocator が usage() を持たない場合、チャンク分は 0 として扱う。
+ */
+template <typename Pool> class SegregatePoolReplayTarget {
+public:
+  using Block = typename Pool::BufferResource;
+
+  explicit SegregatePoolReplayTarget(Pool &pool) : pool_(pool) {}
+
+  Block allocate(std::size_t size, std::size_t alignment) {
+    Block block = pool_.allocate(size, alignment, launch_params_);
+    if (block.valid() && isLarge(size, alignment)) {
+      large_bytes_ += size;
+    }
+    return block;
+  }
+
+  bool valid(const Block &block) const { return block.valid(); }
+
+  void deallocate(Block &block, std::size_t size, std::size_t alignment) {
+    if (isLarge(size, alignment)) {
+      large_bytes_ -= size;
+    }
+    pool_.deallocate(std::move(block), size, alignment, launch_params_);
+  }
+
+  std::size_t residentBytes() {
+    std::size_t chunk_bytes = 0;
+    if constexpr (requires { pool_.chunk_locator_policy().usage(); }) {
+      chunk_bytes = pool_.chunk_locator_policy().usage().chunk_bytes;
+    }
+    return chunk_bytes + large_bytes_;
+  }
+
+private:
+  bool isLarge(std::size_t size, std::size_t alignment) const {
+    return pool_.sizeClassIndexFor(size, alignment) >= pool_.size_class_count();
+  }
+
+  Pool &pool_;
+  typename Pool::LaunchParams launch_params_{};
+  std::size_t large_bytes_{0};
+};
+
+/**
+ * @brief HierarchicalSlotAllocator を replay で駆動するアダプタ。
+ *
+ * 解放済みスロットは decommit されるため、resident は使用中スロットの合計。
+ * スロットは階層サイズに揃っているので alignment は使わない。
+ */
+template <typename Allocator> class HierarchicalSlotReplayTarget {
+public:
+  using Block = typename Allocator::BufferView;
+
+  explicit HierarchicalSlotReplayTarget(Allocator &allocator)
+      : allocator_(allocator) {}
+
+  Block allocate(std::size_t size, std::size_t /*alignment*/) {
+    Block view = allocator_.allocate(size);
+    if (view) {
+      resident_bytes_ += view.size();
+    }
+    return view;
+  }
+
+  bool valid(const Block &view) const { return static_cast<bool>(view); }
+
+  void deallocate(Block &view, std::size_t /*size*/,
+                  std::size_t /*alignment*/) {
+    resident_bytes_ -= view.size();
+    allocator_.deallocate(view);
+  }
+
+  std::size_t residentBytes() const { return resident_bytes_; }
+
+private:
+  Allocator &allocator_;
+  std::size_t resident_bytes_{0};
+};
+
+} // namespace orteaf::internal::execution::allocator::trace
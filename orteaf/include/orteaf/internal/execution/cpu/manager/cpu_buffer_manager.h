@@ -0,0 +1,341 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "orteaf/internal/base/handle.h"
+#include "orteaf/internal/base/lease/control_block/shared.h"
+#include "orteaf/internal/base/lease/strong_lease.h"
+#include "orteaf/internal/base/lease/weak_lease.h"
+#include "orteaf/internal/base/manager/pool_manager.h"
+#include "orteaf/internal/base/pool/slot_pool.h"
+#include "orteaf/internal/diagnostics/error/error.h"
+#include "orteaf/internal/execution/allocator/buffer.h"
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "orteaf/internal/execution/execution.h"
+
+namespace orteaf::internal::execution::cpu::manager {
+
+using ::orteaf::internal::execution::Execution;
+
+// ============================================================================
+// SegregatePool type alias template (for host memory allocation)
+// ============================================================================
+template <typename ResourceT>
+using CpuBufferPoolT =
+    ::orteaf::internal::execution::allocator::pool::SegregatePool<
+        ResourceT,
+        ::orteaf::internal::execution::allocator::policies::FastFreePolicy,
+        ::orteaf::internal::execution::allocator::policies::
+            NoLockThreadingPolicy,
+        ::orteaf::internal::execution::allocator::policies::
+            DirectResourceLargeAllocPolicy<ResourceT>,
+        ::orteaf::internal::execution::allocator::policies::
+            DirectChunkLocatorPolicy<ResourceT>,
+        ::orteaf::internal::execution::allocator::policies::DeferredReusePolicy<
+            ResourceT>,
+        ::orteaf::internal::execution::allocator::policies::
+            HostStackFreelistPolicy<ResourceT>>;
+
+// Forward declaration
+template <typename ResourceT> class CpuBufferManagerT;
+
+// ============================================================================
+// BufferPayloadPoolTraits - Defines Payload/Handle/Request/Context for SlotPool
+// ============================================================================
+template <typename ResourceT> struct BufferPayloadPoolTraitsT {
+  using CpuBuffer =
+      ::orteaf::internal::execution::allocator::ExecutionBuffer<Execution::Cpu>;
+  // The block together with the size and alignment it was requested with.
+  // SegregatePool needs the same pair back on deallocate to pick the size
+  // class, account stats/trace bytes and free large blocks correctly.
+  struct Payload : CpuBuffer {
+    std::size_t requested_size{0};
+    std::size_t requested_alignment{0};
+  };
+  using Handle = ::orteaf::internal::base::BufferHandle;
+  using SegregatePool = CpuBufferPoolT<ResourceT>;
+  using LaunchParams = typename SegregatePool::LaunchParams;
+
+  // Blocks go back to the SegregatePool as soon as the last strong lease is
+  // released, so a released slot never pins memory of a stale size.
+  static constexpr bool destroy_on_release = true;
+
+  struct Request {
+    std::size_t size{0};
+    std::size_t alignment{0};
+  };
+
+  struct Context {
+    SegregatePool *segregate_pool{nullptr};
+    LaunchParams *launch_params{nullptr};
+  };
+
+  static bool create(Payload &payload, const Request &request,
+                     const Context &context) {
+    if (context.segregate_pool == nullptr || context.launch_params == nullptr) {
+      return false;
+    }
+    if (request.size == 0) {
+      // Zero-size is valid but results in invalid buffer
+      payload = Payload{};
+      return true;
+    }
+    auto res = context.segregate_pool->allocate(request.size, request.alignment,
+                                                *context.launch_params);
+    if (!res.valid()) {
+      return false;
+    }
+    static_cast<CpuBuffer &>(payload) = std::move(res);
+    payload.requested_size = request.size;
+    payload.requested_alignment = request.alignment;
+    return true;
+  }
+
+  static void destroy(Payload &payload, const Request & /*request*/,
+                      const Context &context) {
+    if (!payload.valid()) {
+      return;
+    }
+    if (context.segregate_pool == nullptr || context.launch_params == nullptr) {
+      payload = Payload{};
+      return;
+    }
+    context.segregate_pool->deallocate(
+        std::move(static_cast<CpuBuffer &>(payload)), payload.requested_size,
+        payload.requested_alignment, *context.launch_params);
+    payload = Payload{};
+  }
+};
+
+// ============================================================================
+// PayloadPool - SlotPool that destroys payloads with a bound context
+// ============================================================================
+// SharedControlBlock releases payloads through release(handle), which has no
+// way to pass a Context. PoolManager::configure binds the manager context so
+// that release can return the block to the SegregatePool. The manager is
+// therefore not movable: the bound context points into it.
+template <typename ResourceT>
+class BufferPayloadPoolT : public ::orteaf::internal::base::pool::SlotPool<
+                               BufferPayloadPoolTraitsT<ResourceT>> {
+public:
+  using Base =
+      ::orteaf::internal::base::pool::SlotPool<BufferPayloadPoolTraitsT<ResourceT>>;
+  using Handle = typename Base::Handle;
+  using Request = typename BufferPayloadPoolTraitsT<ResourceT>::Request;
+  using Context = typename BufferPayloadPoolTraitsT<ResourceT>::Context;
+
+  void bindReleaseContext(const Context &context) noexcept {
+    release_context_ = context;
+  }
+
+  bool release(Handle handle) noexcept {
+    return Base::release(handle, Request{}, release_context_);
+  }
+
+private:
+  Context release_context_{};
+};
+
+// ============================================================================
+// ControlBlock type using SharedControlBlock
+// ============================================================================
+template <typename ResourceT>
+using CpuBufferT =
+    ::orteaf::internal::execution::allocator::ExecutionBuffer<Execution::Cpu>;
+
+template <typename ResourceT>
+using BufferControlBlockT = ::orteaf::internal::base::SharedControlBlock<
+    ::orteaf::internal::base::BufferHandle, CpuBufferT<ResourceT>,
+    BufferPayloadPoolT<ResourceT>>;
+
+// ============================================================================
+// Traits for PoolManager
+// ============================================================================
+template <typename ResourceT> struct CpuBufferManagerTraitsT {
+  using PayloadPool = BufferPayloadPoolT<ResourceT>;
+  using ControlBlock = BufferControlBlockT<ResourceT>;
+  struct ControlBlockTag {};
+  using PayloadHandle = ::orteaf::internal::base::BufferHandle;
+  static constexpr const char *Name = "CpuBufferManager";
+};
+
+// ============================================================================
+// CpuBufferManagerT - Templated buffer manager using PoolManager
+// ============================================================================
+template <typename ResourceT> class CpuBufferManagerT {
+public:
+  using Traits = CpuBufferManagerTraitsT<ResourceT>;
+  using Core = ::orteaf::internal::base::PoolManager<Traits>;
+  using CpuBuffer = CpuBufferT<ResourceT>;
+  using BufferHandle = ::orteaf::internal::base::BufferHandle;
+  using SegregatePool = CpuBufferPoolT<ResourceT>;
+  using LaunchParams = typename SegregatePool::LaunchParams;
+  using Resource = ResourceT;
+
+  using ControlBlock = typename Core::ControlBlock;
+  using ControlBlockHandle = typename Core::ControlBlockHandle;
+  using ControlBlockPool = typename Core::ControlBlockPool;
+  using PayloadPool = typename Core::PayloadPool;
+
+  // Lease types
+  using StrongBufferLease = typename Core::StrongLeaseType;
+  using WeakBufferLease = typename Core::WeakLeaseType;
+  using BufferLease = StrongBufferLease;
+
+  // =========================================================================
+  // Config - All dependencies and settings in one struct
+  // =========================================================================
+  struct Config {
+    // SegregatePool config
+    std::size_t chunk_size{16 * 1024 * 1024};
+    std::size_t min_block_size{64};
+    std::size_t max_block_size{16 * 1024 * 1024};
+    // PoolManager config
+    Core::Config pool{};
+  };
+
+  // =========================================================================
+  // Lifecycle
+  // =========================================================================
+  CpuBufferManagerT() = default;
+  CpuBufferManagerT(const CpuBufferManagerT &) = delete;
+  CpuBufferManagerT &operator=(const CpuBufferManagerT &) = delete;
+  CpuBufferManagerT(CpuBufferManagerT &&) = delete;
+  CpuBufferManagerT &operator=(CpuBufferManagerT &&) = delete;
+  ~CpuBufferManagerT() = default;
+
+  void configure(const Config &config) {
+    shutdown();
+
+    // Host resources are stateless; a default-constructed one is ready.
+    segregate_pool_.~SegregatePool();
+    new (&segregate_pool_) SegregatePool(Resource{});
+
+    typename SegregatePool::Config pool_cfg{};
+    pool_cfg.chunk_size = config.chunk_size;
+    pool_cfg.min_block_size = config.min_block_size;
+    pool_cfg.max_block_size = config.max_block_size;
+    pool_cfg.fast_free.resource = segregate_pool_.resource();
+    pool_cfg.threading.resource = segregate_pool_.resource();
+    pool_cfg.large_alloc.resource = segregate_pool_.resource();
+    pool_cfg.chunk_locator.resource = segregate_pool_.resource();
+    pool_cfg.reuse.resource = segregate_pool_.resource();
+    pool_cfg.freelist.resource = segregate_pool_.resource();
+    segregate_pool_.initialize(pool_cfg);
+
+    // Configure PoolManager + PayloadPool
+    typename BufferPayloadPoolTraitsT<ResourceT>::Request request{};
+    auto context = makePayloadContext();
+    core_.configure(config.pool, request, context);
+  }
+
+  void shutdown() {
+    if (!core_.isConfigured()) {
+      return;
+    }
+
+    // Shutdown PoolManager (includes check and clear for both pools)
+    auto context = makePayloadContext();
+    typename BufferPayloadPoolTraitsT<ResourceT>::Request request{};
+    core_.shutdown(request, context);
+
+    // Shutdown SegregatePool (returns every chunk to the resource)
+    segregate_pool_.releaseChunk(default_params_);
+    segregate_pool_.~SegregatePool();
+    new (&segregate_pool_) SegregatePool{};
+  }
+
+  // =========================================================================
+  // Acquire (allocate new buffer)
+  // =========================================================================
+  StrongBufferLease acquire(std::size_t size, std::size_t alignment) {
+    return acquire(size, alignment, default_params_);
+  }
+
+  StrongBufferLease acquire(std::size_t size, std::size_t alignment,
+                            LaunchParams &params) {
+    core_.ensureConfigured();
+    if (size == 0) {
+      return {};
+    }
+
+    // Released slots are uncreated (destroy_on_release), so reserve one and
+    // allocate the block for this request.
+    auto payload_handle = core_.reserveUncreatedPayloadOrGrow();
+    if (!payload_handle.isValid()) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+          "CPU buffer manager has no available slots");
+    }
+    typename BufferPayloadPoolTraitsT<ResourceT>::Request request{size,
+                                                                  alignment};
+    auto context = makePayloadContext(&params);
+    if (!core_.emplacePayload(payload_handle, request, context)) {
+      ::orteaf::internal::diagnostics::error::throwError(
+          ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfMemory,
+          "CPU buffer manager failed to allocate a buffer");
+    }
+    return core_.acquireStrongLease(payload_handle);
+  }
+
+  SegregatePool &segregatePool() noexcept { return segregate_pool_; }
+
+#if ORTEAF_ENABLE_TEST
+  bool isConfiguredForTest() const noexcept { return core_.isConfigured(); }
+  std::size_t payloadPoolSizeForTest() const noexcept {
+    return core_.payloadPoolSizeForTest();
+  }
+  std::size_t payloadPoolCapacityForTest() const noexcept {
+    return core_.payloadPoolCapacityForTest();
+  }
+  std::size_t payloadPoolAvailableForTest() const noexcept {
+    return core_.payloadPoolAvailableForTest();
+  }
+  std::size_t controlBlockPoolSizeForTest() const noexcept {
+    return core_.controlBlockPoolSizeForTest();
+  }
+  std::size_t controlBlockPoolCapacityForTest() const noexcept {
+    return core_.controlBlockPoolCapacityForTest();
+  }
+  bool isAliveForTest(BufferHandle handle) const noexcept {
+    return core_.isAlive(handle);
+  }
+#endif
+
+private:
+  typename BufferPayloadPoolTraitsT<ResourceT>::Context
+  makePayloadContext(LaunchParams *params = nullptr) noexcept {
+    typename BufferPayloadPoolTraitsT<ResourceT>::Context ctx{};
+    ctx.segregate_pool = &segregate_pool_;
+    ctx.launch_params = params ? params : &default_params_;
+    return ctx;
+  }
+
+  // Runtime state
+  SegregatePool segregate_pool_{};
+  LaunchParams default_params_{};
+  Core core_{};
+};
+
+} // namespace orteaf::internal::execution::cpu::manager
+
+// ============================================================================
+// Default type alias (after namespace to avoid circular dependency)
+// ============================================================================
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
+
+namespace orteaf::internal::execution::cpu::manager {
+using CpuBufferPool = CpuBufferPoolT<::orteaf::internal::execution::cpu::CpuResource>;
+using CpuBufferManagerTraits =
+    CpuBufferManagerTraitsT<::orteaf::internal::execution::cpu::CpuResource>;
+using CpuBufferManager =
+    CpuBufferManagerT<::orteaf::internal::execution::cpu::CpuResource>;
+} // namespace orteaf::internal::execution::cpu::manager
@@ -0,0 +1,45 @@
+#pragma once
+
+/**
+ * @file cpu_mmap.h
+ * @brief Aligned anonymous mappings for the host CPU.
+ *
+ * `mmap` only guarantees page alignment. Resources that need a larger
+ * boundary (block-size aligned chunks, 2 MiB huge pages, huge-page aligned
+ * file mappings) over-reserve by the alignment and unmap the unaligned head
+ * and tail, which this helper does in one place.
+ */
+
+#include <cstddef>
+
+namespace orteaf::internal::execution::cpu::platform::wrapper {
+
+/**
+ * @brief Access of an aligned anonymous mapping.
+ */
+enum class MapAccess {
+    /// Readable and writable memory, committed on first touch.
+    ReadWrite,
+    /// Address space only (`PROT_NONE`, `MAP_NORESERVE`), to be replaced by a
+    /// later `MAP_FIXED` mapping.
+    Reserve,
+};
+
+/**
+ * @brief Map @p size bytes of anonymous memory starting on an @p alignment boundary.
+ *
+ * Reserves `size + alignment` bytes and unmaps the unaligned head and tail,
+ * so exactly @p size bytes remain mapped and must later be released with
+ * `munmap(ptr, size)`.
+ *
+ * @param size Mapping size in bytes; should be a multiple of the page size.
+ * @param alignment Required alignment; must be a power of two.
+ * @param access Protection of the returned range.
+ * @return Aligned start of the mapping; nullptr if the kernel refuses the
+ *         reservation or the request overflows.
+ * @throws std::system_error If @p alignment is not a power of two
+ *         (OrteafErrc::InvalidParameter).
+ */
+void* mapAligned(std::size_t size, std::size_t alignment, MapAccess access = MapAccess::ReadWrite);
+
+} // namespace orteaf::internal::execution::cpu::platform::wrapper
@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ * @file cpu_numa.h
+ * @brief NUMA topology queries and memory placement for the host CPU.
+ *
+ * Implemented with raw Linux syscalls (`getcpu`, `mbind`) so no libnuma
+ * dependency is needed. On other platforms, or on single-node machines,
+ * every function degrades to the single-node behaviour: one node (0), and
+ * placement requests are no-ops so memory lands where it is first touched.
+ *
+ * Node IDs reported by the kernel may be sparse (e.g. nodes 0 and 2 only).
+ * Functions taking or returning a "node" use the real kernel ID; the dense
+ * index in [0, numaNodeCount()) is converted with numaNodeId()/numaNodeIndex().
+ */
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace orteaf::internal::execution::cpu::platform::wrapper {
+
+/**
+ * @brief Number of online NUMA nodes visible to this process.
+ *
+ * Read once from `/sys/devices/system/node/online` (falling back to the
+ * `nodeN` directories) and cached.
+ *
+ * @return Node count; 1 when NUMA information is unavailable.
+ */
+std::size_t numaNodeCount() noexcept;
+
+/**
+ * @brief Kernel node ID of the @p index-th online node, in ascending order.
+ *
+ * @return Node ID; the first online node's ID when @p index is out of range.
+ */
+std::size_t numaNodeId(std::size_t index) noexcept;
+
+/**
+ * @brief Dense index of the online node with kernel ID @p node.
+ *
+ * @return Index in [0, numaNodeCount()); numaNodeCount() if @p node is not online.
+ */
+std::size_t numaNodeIndex(std::size_t node) noexcept;
+
+/**
+ * @brief NUMA node of the CPU the calling thread is currently running on.
+ *
+ * The result is a snapshot; the scheduler may migrate the thread afterwards.
+ *
+ * @return Kernel node ID of an online node; numaNodeId(0) when unavailable.
+ */
+std::size_t currentNumaNode() noexcept;
+
+/**
+ * @brief Ask the kernel to place the pages of a range on @p node.
+ *
+ * Uses `mbind(MPOL_PREFERRED)`, so allocation falls back to other nodes
+ * instead of failing when @p node is out of memory. Must be called before
+ * the pages are first touched to have any effect.
+ *
+ * @param ptr Page-aligned start of the range.
+ * @param size Size of the range in bytes.
+ * @param node Target kernel node ID.
+ * @return true if the policy was applied; false on single-node machines,
+ *         unsupported platforms, or when the kernel rejects the request.
+ */
+bool bindToNumaNode(void* ptr, std::size_t size, std::size_t node) noexcept;
+
+/**
+ * @brief Parse a kernel node list such as "0-1,4,6-7" into sorted node IDs.
+ *
+ * This is the format of `/sys/devices/system/node/online`. Exposed for testing.
+ *
+ * @return Sorted, de-duplicated IDs; empty if @p list is malformed.
+ */
+std::vector<std::size_t> parseNumaNodeList(std::string_view list);
+
+} // namespace orteaf::internal::execution::cpu::platform::wrapper
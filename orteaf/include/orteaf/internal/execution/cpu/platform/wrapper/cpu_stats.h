@@ -1,10 +1,13 @@
 #pragma once
 
 #include <atomic>
+#include <cstdint>
 #include <string>
 #include <sstream>
 #include <iostream>
 
+#include "orteaf/internal/base/sharded_counter.h"
+
 namespace orteaf::internal::execution::cpu::platform::wrapper {
 
 /**
@@ -16,7 +19,11 @@ namespace orteaf::internal::execution::cpu::platform::wrapper {
  * - STATS_EXTENDED (4): Additionally tracks current allocated bytes and peak allocated bytes.
  * - Disabled: Provides no-op methods when statistics are disabled.
  *
- * All statistics are thread-safe and use atomic operations with relaxed memory ordering.
+ * All statistics are thread-safe. Updates go to per-thread shards (see
+ * base::ShardedCounters / base::ShardedGauge) so allocating threads do not
+ * contend on a shared cache line; getters aggregate the shards on read.
+ * Counters are exact once writers are quiescent; the peak is approximate
+ * (within shards * batch bytes of the true maximum).
  * All public methods are always declared, ensuring a consistent interface regardless of
  * the statistics level configuration.
  */
@@ -31,7 +38,7 @@ public:
     uint64_t totalAllocations() const noexcept {
         #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 2
-                return total_allocations_.load(std::memory_order_relaxed);
+                return counts_.load(kAllocationsSlot);
             #endif
         #endif
         return 0;
@@ -45,7 +52,7 @@ public:
     uint64_t totalDeallocations() const noexcept {
         #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 2
-                return total_deallocations_.load(std::memory_order_relaxed);
+                return counts_.load(kDeallocationsSlot);
             #endif
         #endif
         return 0;
@@ -61,7 +68,7 @@ public:
     uint64_t activeAllocations() const noexcept {
         #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 2
-                return active_allocations_.load(std::memory_order_relaxed);
+                return counts_.load(kAllocationsSlot) - counts_.load(kDeallocationsSlot);
             #endif
         #endif
         return 0;
@@ -75,7 +82,7 @@ public:
     uint64_t currentAllocatedBytes() const noexcept {
         #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 4
-                return current_allocated_bytes_.load(std::memory_order_relaxed);
+                return allocated_bytes_.value();
             #endif
         #endif
         return 0;
@@ -92,7 +99,7 @@ public:
     uint64_t peakAllocatedBytes() const noexcept {
         #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 4
-                return peak_allocated_bytes_.load(std::memory_order_relaxed);
+                return allocated_bytes_.peak();
             #endif
         #endif
         return 0;
@@ -103,22 +110,17 @@ public:
      * @brief Update statistics when memory is allocated.
      *
      * Updates allocation counts and byte tracking based on the configured statistics level.
-     * Thread-safe operation using atomic operations.
+     * Thread-safe; only the calling thread's shard is written.
      *
      * @param size Size of the allocated memory in bytes.
      */
     void updateAlloc(size_t size) noexcept {
         #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 2
-                total_allocations_.fetch_add(1, std::memory_order_relaxed);
-                active_allocations_.fetch_add(1, std::memory_order_relaxed);
+                counts_.add(kAllocationsSlot, 1);
             #endif
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 4
-                uint64_t current = current_allocated_bytes_.fetch_add(size, std::memory_order_relaxed) + size;
-                uint64_t peak = peak_allocated_bytes_.load(std::memory_order_relaxed);
-                while (current > peak && !peak_allocated_bytes_.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
-                    peak = peak_allocated_bytes_.load(std::memory_order_relaxed);
-                }
+                allocated_bytes_.add(size);
             #endif
         #endif
     }
@@ -127,18 +129,17 @@ public:
      * @brief Update statistics when memory is deallocated.
      *
      * Updates deallocation counts and byte tracking based on the configured statistics level.
-     * Thread-safe operation using atomic operations.
+     * Thread-safe; only the calling thread's shard is written.
      *
      * @param size Size of the deallocated memory in bytes.
      */
     void updateDealloc(size_t size) noexcept {
         #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 2
-                total_deallocations_.fetch_add(1, std::memory_order_relaxed);
-                active_allocations_.fetch_sub(1, std::memory_order_relaxed);
+                counts_.add(kDeallocationsSlot, 1);
             #endif
             #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 4
-                current_allocated_bytes_.fetch_sub(size, std::memory_order_relaxed);
+                allocated_bytes_.sub(size);
             #endif
         #endif
     }
@@ -182,13 +183,13 @@ public:
 private:
 #ifdef ORTEAF_STATS_LEVEL_CPU_VALUE
     #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 2
-        std::atomic<uint64_t> total_allocations_{0};
-        std::atomic<uint64_t> total_deallocations_{0};
-        std::atomic<uint64_t> active_allocations_{0};
+        // Active allocations are derived as allocations - deallocations.
+        static constexpr std::size_t kAllocationsSlot = 0;
+        static constexpr std::size_t kDeallocationsSlot = 1;
+        ::orteaf::internal::base::ShardedCounters<2> counts_{};
     #endif
     #if ORTEAF_STATS_LEVEL_CPU_VALUE <= 4
-        std::atomic<uint64_t> current_allocated_bytes_{0};
-        std::atomic<uint64_t> peak_allocated_bytes_{0};
+        ::orteaf::internal::base::ShardedGauge allocated_bytes_{};
     #endif
 #endif
 };
@@ -9,6 +9,8 @@ namespace orteaf::internal::execution::cpu::resource {
 
 // Low-level heap operations for CPU execution.
 // Used by HierarchicalSlotAllocator for VA reservation and mapping.
+// map/unmap accept any page-aligned sub-range of a reservation, so a run of
+// contiguous slots can be committed or decommitted with a single call.
 struct CpuHeapOps {
     using BufferView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
     using HeapRegion = ::orteaf::internal::execution::cpu::resource::CpuHeapRegion;
@@ -19,8 +21,13 @@ struct CpuHeapOps {
     // Map reserved region to RW.
     static BufferView map(HeapRegion region);
 
-    // Unmap and release the region.
+    // Decommit the region. Physical pages are returned to the OS and the
+    // range goes back to PROT_NONE, but the VA stays reserved so it can be
+    // mapped again.
     static void unmap(HeapRegion region, std::size_t size);
+
+    // Release the VA reservation itself (munmap).
+    static void release(HeapRegion region);
 };
 
-}  // namespace orteaf::internal::execution::cpu::resource
\ No newline at end of file
+}  // namespace orteaf::internal::execution::cpu::resource
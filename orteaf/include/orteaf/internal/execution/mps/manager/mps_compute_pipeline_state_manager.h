@@ -6,9 +6,9 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <utility>
 
+#include "orteaf/internal/base/flat_hash_map.h"
 #include "orteaf/internal/base/handle.h"
 #include "orteaf/internal/base/lease/control_block/weak.h"
 #include "orteaf/internal/base/lease/weak_lease.h"
@@ -209,7 +209,9 @@ private:
   void validateKey(const FunctionKey &key) const;
   PipelinePayloadPoolTraits::Context makePayloadContext() const noexcept;
 
-  std::unordered_map<FunctionKey, std::size_t, FunctionKeyHasher> key_to_index_{};
+  ::orteaf::internal::base::FlatHashMap<FunctionKey, std::size_t,
+                                        FunctionKeyHasher>
+      key_to_index_{};
   LibraryType library_{nullptr};
   DeviceType device_{nullptr};
   SlowOps *ops_{nullptr};
@@ -7,9 +7,9 @@
 #include <functional>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
+#include "orteaf/internal/base/flat_hash_map.h"
 #include "orteaf/internal/base/handle.h"
 #include "orteaf/internal/base/lease/control_block/strong.h"
 #include "orteaf/internal/base/lease/strong_lease.h"
@@ -237,7 +237,9 @@ private:
   void validateKey(const GraphKey &key) const;
   GraphPayloadPoolTraits::Context makePayloadContext() const noexcept;
 
-  std::unordered_map<GraphKey, std::size_t, GraphKeyHasher> key_to_index_{};
+  ::orteaf::internal::base::FlatHashMap<GraphKey, std::size_t,
+                                        GraphKeyHasher>
+      key_to_index_{};
   DeviceType device_{nullptr};
   SlowOps *ops_{nullptr};
   Core core_{};
@@ -4,8 +4,8 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <unordered_map>
 
+#include "orteaf/internal/base/flat_hash_map.h"
 #include "orteaf/internal/base/handle.h"
 #include "orteaf/internal/base/lease/control_block/weak.h"
 #include "orteaf/internal/base/lease/weak_lease.h"
@@ -215,7 +215,8 @@ private:
   HeapPayloadPoolTraits::Context makePayloadContext() const noexcept;
   HeapType createHeap(const HeapDescriptorKey &key);
 
-  std::unordered_map<HeapDescriptorKey, std::size_t, HeapDescriptorKeyHasher>
+  ::orteaf::internal::base::FlatHashMap<HeapDescriptorKey, std::size_t,
+                                        HeapDescriptorKeyHasher>
       key_to_index_{};
   DeviceType device_{nullptr};
   ::orteaf::internal::base::DeviceHandle device_handle_{};
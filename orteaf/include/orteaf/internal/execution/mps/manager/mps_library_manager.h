@@ -6,8 +6,8 @@
 #include <cstdint>
 #include <string>
 #include <string_view>
-#include <unordered_map>
 
+#include "orteaf/internal/base/flat_hash_map.h"
 #include "orteaf/internal/base/handle.h"
 #include "orteaf/internal/base/lease/control_block/weak.h"
 #include "orteaf/internal/base/lease/weak_lease.h"
@@ -189,7 +189,9 @@ private:
   void validateKey(const LibraryKey &key) const;
   LibraryPayloadPoolTraits::Context makePayloadContext() const noexcept;
 
-  std::unordered_map<LibraryKey, std::size_t, LibraryKeyHasher> key_to_index_{};
+  ::orteaf::internal::base::FlatHashMap<LibraryKey, std::size_t,
+                                        LibraryKeyHasher>
+      key_to_index_{};
   DeviceType device_{nullptr};
   SlowOps *ops_{nullptr};
   MpsComputePipelineStateManager::Config pipeline_config_{};
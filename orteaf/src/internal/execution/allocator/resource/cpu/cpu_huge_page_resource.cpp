@@ -0,0 +1,98 @@
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_huge_page_resource.h"
+
+#include <sys/mman.h>
+
+#include <atomic>
+
+#include "orteaf/internal/diagnostics/error/error_macros.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_mmap.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_stats.h"
+
+namespace orteaf::internal::execution::cpu {
+namespace cpu = ::orteaf::internal::execution::cpu::platform::wrapper;
+
+namespace {
+
+std::atomic<bool> g_use_hugetlb{false};
+
+std::size_t roundUp(std::size_t value, std::size_t multiple) noexcept {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+void* mapHugeTlb(std::size_t size) noexcept {
+#if defined(MAP_HUGETLB)
+    void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_HUGETLB, -1, 0);
+    return base == MAP_FAILED ? nullptr : base;
+#else
+    (void)size;
+    return nullptr;
+#endif
+}
+
+// Maps an `alignment`-aligned range and asks for transparent huge pages.
+void* mapTransparentHuge(std::size_t size, std::size_t alignment) {
+    void* base = cpu::mapAligned(size, alignment);
+#if defined(MADV_HUGEPAGE)
+    // Advisory only; THP may be disabled system-wide.
+    if (base != nullptr) {
+        (void)madvise(base, size, MADV_HUGEPAGE);
+    }
+#endif
+    return base;
+}
+
+}  // namespace
+
+void CpuHugePageResource::initialize() noexcept {
+    initialize(Config{});
+}
+
+void CpuHugePageResource::initialize(const Config& config) noexcept {
+    g_use_hugetlb.store(config.use_hugetlb, std::memory_order_relaxed);
+}
+
+std::size_t CpuHugePageResource::mappedSize(std::size_t size) noexcept {
+    return roundUp(size, kHugePageSize);
+}
+
+CpuHugePageResource::BufferView CpuHugePageResource::allocate(std::size_t size, std::size_t alignment) {
+    ORTEAF_THROW_IF(size == 0, InvalidParameter, "CpuHugePageResource::allocate requires size > 0");
+    const std::size_t mapped = mappedSize(size);
+    const std::size_t align = alignment > kHugePageSize ? alignment : kHugePageSize;
+
+    void* base = nullptr;
+    if (g_use_hugetlb.load(std::memory_order_relaxed) && align == kHugePageSize) {
+        base = mapHugeTlb(mapped);
+    }
+    if (base == nullptr) {
+        base = mapTransparentHuge(mapped, align);
+    }
+    ORTEAF_THROW_IF(base == nullptr, OutOfMemory, "CpuHugePageResource::allocate mmap failed");
+    cpu::updateAlloc(mapped);
+    return BufferView{base, 0, size};
+}
+
+void CpuHugePageResource::deallocate(BufferView view, std::size_t size, std::size_t /*alignment*/) {
+    if (!view) {
+        return;
+    }
+    const std::size_t mapped = mappedSize(size);
+    ORTEAF_THROW_IF(munmap(view.raw(), mapped) != 0, OperationFailed, "CpuHugePageResource::deallocate munmap failed");
+    cpu::updateDealloc(mapped);
+}
+
+bool CpuHugePageResource::isCompleted(const FenceToken& token) {
+    (void)token;
+    return true;
+}
+
+bool CpuHugePageResource::isCompleted(const ReuseToken& token) {
+    (void)token;
+    return true;
+}
+
+CpuHugePageResource::BufferView CpuHugePageResource::makeView(BufferView base, std::size_t offset, std::size_t size) {
+    return BufferView{base.raw(), offset, size};
+}
+
+}  // namespace orteaf::internal::execution::cpu
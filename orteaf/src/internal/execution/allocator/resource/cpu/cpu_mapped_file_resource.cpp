@@ -0,0 +1,186 @@
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_mapped_file_resource.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <utility>
+
+#include "orteaf/internal/diagnostics/error/error_macros.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_mmap.h"
+
+namespace orteaf::internal::execution::cpu {
+namespace cpu = ::orteaf::internal::execution::cpu::platform::wrapper;
+
+namespace {
+
+std::size_t pageSize() noexcept {
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+std::size_t roundUp(std::size_t value, std::size_t multiple) noexcept {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+class FileDescriptor {
+public:
+    explicit FileDescriptor(int fd) noexcept : fd_(fd) {}
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor& operator=(const FileDescriptor&) = delete;
+    ~FileDescriptor() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+    int get() const noexcept { return fd_; }
+
+private:
+    int fd_;
+};
+
+}  // namespace
+
+CpuMappedFileResource::CpuMappedFileResource(const std::string& path)
+    : CpuMappedFileResource(path, Config{}) {}
+
+CpuMappedFileResource::CpuMappedFileResource(const std::string& path, const Config& config) {
+    FileDescriptor fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+    ORTEAF_THROW_IF(fd.get() < 0, OperationFailed, "CpuMappedFileResource cannot open " + path);
+
+    struct stat st {};
+    ORTEAF_THROW_IF(::fstat(fd.get(), &st) != 0, OperationFailed, "CpuMappedFileResource cannot stat " + path);
+    ORTEAF_THROW_IF(!S_ISREG(st.st_mode), OperationFailed, "CpuMappedFileResource requires a regular file: " + path);
+
+    opened_ = true;
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ == 0) {
+        return;
+    }
+
+    const std::size_t length = roundUp(size_, pageSize());
+    const bool align_huge = config.huge_page_align && size_ >= kHugePageSize;
+    void* base = nullptr;
+    if (align_huge) {
+        void* reserved = cpu::mapAligned(length, kHugePageSize, cpu::MapAccess::Reserve);
+        if (reserved != nullptr) {
+            base = mmap(reserved, length, PROT_READ, MAP_SHARED | MAP_FIXED, fd.get(), 0);
+            if (base == MAP_FAILED) {
+                munmap(reserved, length);
+                base = nullptr;
+            }
+        }
+    }
+    // Alignment is only an optimization; fall back to wherever the kernel
+    // places the mapping.
+    if (base == nullptr) {
+        base = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd.get(), 0);
+    }
+    if (base == MAP_FAILED) {
+        opened_ = false;
+        size_ = 0;
+        ORTEAF_THROW(OperationFailed, "CpuMappedFileResource cannot mmap " + path);
+    }
+    base_ = base;
+    mapped_size_ = length;
+
+    // Hints are advisory; failures (e.g. THP disabled) are ignored.
+    switch (config.access) {
+        case Access::Sequential:
+            (void)madvise(base_, mapped_size_, MADV_SEQUENTIAL);
+            break;
+        case Access::Random:
+            (void)madvise(base_, mapped_size_, MADV_RANDOM);
+            break;
+        case Access::Normal:
+            break;
+    }
+#if defined(MADV_HUGEPAGE)
+    if (align_huge && hugePageAligned()) {
+        (void)madvise(base_, mapped_size_, MADV_HUGEPAGE);
+    }
+#endif
+    if (config.prefetch) {
+        (void)madvise(base_, mapped_size_, MADV_WILLNEED);
+    }
+}
+
+CpuMappedFileResource::CpuMappedFileResource(CpuMappedFileResource&& other) noexcept
+    : base_(std::exchange(other.base_, nullptr)),
+      size_(std::exchange(other.size_, 0)),
+      mapped_size_(std::exchange(other.mapped_size_, 0)),
+      opened_(std::exchange(other.opened_, false)) {}
+
+CpuMappedFileResource& CpuMappedFileResource::operator=(CpuMappedFileResource&& other) noexcept {
+    if (this != &other) {
+        close();
+        base_ = std::exchange(other.base_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+        mapped_size_ = std::exchange(other.mapped_size_, 0);
+        opened_ = std::exchange(other.opened_, false);
+    }
+    return *this;
+}
+
+CpuMappedFileResource::~CpuMappedFileResource() {
+    close();
+}
+
+void CpuMappedFileResource::close() noexcept {
+    if (base_ != nullptr) {
+        munmap(base_, mapped_size_);
+    }
+    base_ = nullptr;
+    size_ = 0;
+    mapped_size_ = 0;
+    opened_ = false;
+}
+
+bool CpuMappedFileResource::hugePageAligned() const noexcept {
+    return base_ != nullptr && reinterpret_cast<std::uintptr_t>(base_) % kHugePageSize == 0;
+}
+
+CpuMappedFileResource::BufferView CpuMappedFileResource::view(std::size_t offset, std::size_t size) const {
+    ORTEAF_THROW_IF(offset > size_ || size > size_ - offset, OutOfRange,
+                    "CpuMappedFileResource::view range exceeds the file size");
+    return BufferView{base_, offset, size};
+}
+
+void CpuMappedFileResource::prefetch(std::size_t offset, std::size_t size) const {
+    advise(offset, size, MADV_WILLNEED);
+}
+
+void CpuMappedFileResource::evict(std::size_t offset, std::size_t size) const {
+    advise(offset, size, MADV_DONTNEED);
+}
+
+void CpuMappedFileResource::advise(std::size_t offset, std::size_t size, int advice) const {
+    ORTEAF_THROW_IF(offset > size_ || size > size_ - offset, OutOfRange,
+                    "CpuMappedFileResource advice range exceeds the file size");
+    if (size == 0) {
+        return;
+    }
+    // madvise requires a page-aligned start.
+    const std::size_t begin = offset / pageSize() * pageSize();
+    const std::size_t end = roundUp(offset + size, pageSize());
+    (void)madvise(static_cast<char*>(base_) + begin, end - begin, advice);
+}
+
+bool CpuMappedFileResource::isCompleted(const FenceToken& token) {
+    (void)token;
+    return true;
+}
+
+bool CpuMappedFileResource::isCompleted(const ReuseToken& token) {
+    (void)token;
+    return true;
+}
+
+CpuMappedFileResource::BufferView CpuMappedFileResource::makeView(BufferView base, std::size_t offset,
+                                                                  std::size_t size) {
+    return BufferView{base.raw(), offset, size};
+}
+
+}  // namespace orteaf::internal::execution::cpu
@@ -0,0 +1,70 @@
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_numa_resource.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "orteaf/internal/diagnostics/error/error_macros.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_mmap.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_stats.h"
+
+namespace orteaf::internal::execution::cpu {
+namespace cpu = ::orteaf::internal::execution::cpu::platform::wrapper;
+
+namespace {
+
+std::size_t pageSize() noexcept {
+    static const std::size_t size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+std::size_t roundUp(std::size_t value, std::size_t multiple) noexcept {
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+}  // namespace
+
+CpuNumaResource::CpuNumaResource(std::size_t node) noexcept
+    : node_(cpu::numaNodeIndex(node) < cpu::numaNodeCount() ? node : cpu::numaNodeId(0)) {}
+
+CpuNumaResource::BufferView CpuNumaResource::allocate(std::size_t size, std::size_t alignment) {
+    ORTEAF_THROW_IF(size == 0, InvalidParameter, "CpuNumaResource::allocate requires size > 0");
+    const std::size_t mapped = roundUp(size, pageSize());
+    void* base = nullptr;
+    if (alignment > pageSize()) {
+        base = cpu::mapAligned(mapped, alignment);
+    } else {
+        base = mmap(nullptr, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        base = base == MAP_FAILED ? nullptr : base;
+    }
+    ORTEAF_THROW_IF(base == nullptr, OutOfMemory, "CpuNumaResource::allocate mmap failed");
+    // Falls back to first-touch placement when binding is unavailable.
+    (void)cpu::bindToNumaNode(base, mapped, node_);
+    cpu::updateAlloc(mapped);
+    return BufferView{base, 0, size};
+}
+
+void CpuNumaResource::deallocate(BufferView view, std::size_t size, std::size_t /*alignment*/) {
+    if (!view) {
+        return;
+    }
+    const std::size_t mapped = roundUp(size, pageSize());
+    ORTEAF_THROW_IF(munmap(view.raw(), mapped) != 0, OperationFailed, "CpuNumaResource::deallocate munmap failed");
+    cpu::updateDealloc(mapped);
+}
+
+bool CpuNumaResource::isCompleted(const FenceToken& token) {
+    (void)token;
+    return true;
+}
+
+bool CpuNumaResource::isCompleted(const ReuseToken& token) {
+    (void)token;
+    return true;
+}
+
+CpuNumaResource::BufferView CpuNumaResource::makeView(BufferView base, std::size_t offset, std::size_t size) {
+    return BufferView{base.raw(), offset, size};
+}
+
+}  // namespace orteaf::internal::execution::cpu
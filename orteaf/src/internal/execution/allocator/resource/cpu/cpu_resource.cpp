@@ -34,6 +34,11 @@ bool CpuResource::isCompleted(const ReuseToken& token) {
     return true;
 }
 
+std::optional<std::uint64_t> CpuResource::reuseQueueKey(const ReuseToken& token) noexcept {
+    (void)token;
+    return 0;
+}
+
 CpuResource::BufferView CpuResource::makeView(BufferView base, std::size_t offset, std::size_t size) {
     return BufferView{base.raw(), offset, size};
 }
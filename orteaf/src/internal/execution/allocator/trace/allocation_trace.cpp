@@ -0,0 +1,194 @@
+#include "orteaf/internal/execution/allocator/trace/allocation_trace.h"
+
+#include <fstream>
+#include <iterator>
+
+#include "orteaf/internal/diagnostics/error/error_macros.h"
+
+namespace orteaf::internal::execution::allocator::trace {
+
+namespace {
+
+constexpr char kMagic[4] = {'O', 'A', 'T', 'R'};
+constexpr std::uint32_t kVersion = 1;
+
+void putVarint(std::string& out, std::uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+class Reader {
+public:
+    explicit Reader(const std::string& bytes) : bytes_(bytes) {}
+
+    std::uint8_t byte() {
+        ORTEAF_THROW_IF(pos_ >= bytes_.size(), InvalidArgument, "allocation trace is truncated");
+        return static_cast<std::uint8_t>(bytes_[pos_++]);
+    }
+
+    std::uint64_t varint() {
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            const std::uint8_t b = byte();
+            value |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) {
+                return value;
+            }
+        }
+        ORTEAF_THROW(InvalidArgument, "allocation trace has an overlong varint");
+    }
+
+    bool done() const { return pos_ == bytes_.size(); }
+
+private:
+    const std::string& bytes_;
+    std::size_t pos_{0};
+};
+
+}  // namespace
+
+AllocationTraceRecorder::AllocationTraceRecorder() : start_(std::chrono::steady_clock::now()) {}
+
+std::uint64_t AllocationTraceRecorder::recordAllocate(AllocationTraceKey key, std::size_t size,
+                                                      std::size_t alignment) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::uint64_t id = next_id_++;
+    live_[key] = id;
+    events_.push_back(AllocationTraceEvent{AllocationTraceOp::Allocate, threadIndexLocked(), id, size,
+                                           alignment, nowNs()});
+    return id;
+}
+
+bool AllocationTraceRecorder::recordDeallocate(AllocationTraceKey key, std::size_t size,
+                                               std::size_t alignment) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = live_.find(key);
+    if (it == live_.end()) {
+        return false;
+    }
+    const std::uint64_t id = it->second;
+    live_.erase(it);
+    events_.push_back(AllocationTraceEvent{AllocationTraceOp::Deallocate, threadIndexLocked(), id, size,
+                                           alignment, nowNs()});
+    return true;
+}
+
+std::size_t AllocationTraceRecorder::eventCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return events_.size();
+}
+
+AllocationTrace AllocationTraceRecorder::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AllocationTrace trace{};
+    trace.events = events_;
+    trace.id_count = next_id_;
+    trace.thread_count = static_cast<std::uint32_t>(threads_.size());
+    return trace;
+}
+
+void AllocationTraceRecorder::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    events_.clear();
+    live_.clear();
+    threads_.clear();
+    next_id_ = 0;
+    start_ = std::chrono::steady_clock::now();
+}
+
+std::uint32_t AllocationTraceRecorder::threadIndexLocked() {
+    const auto [it, inserted] =
+        threads_.try_emplace(std::this_thread::get_id(), static_cast<std::uint32_t>(threads_.size()));
+    return it->second;
+}
+
+std::uint64_t AllocationTraceRecorder::nowNs() const {
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_)
+            .count());
+}
+
+std::string encodeAllocationTrace(const AllocationTrace& trace) {
+    std::string out;
+    out.reserve(16 + trace.events.size() * 12);
+    out.append(kMagic, sizeof(kMagic));
+    for (unsigned i = 0; i < 4; ++i) {
+        out.push_back(static_cast<char>((kVersion >> (8 * i)) & 0xFF));
+    }
+    putVarint(out, trace.events.size());
+    putVarint(out, trace.id_count);
+    putVarint(out, trace.thread_count);
+
+    std::uint64_t previous_ns = 0;
+    for (const auto& event : trace.events) {
+        out.push_back(static_cast<char>(event.op));
+        putVarint(out, event.thread);
+        putVarint(out, event.id);
+        putVarint(out, event.size);
+        putVarint(out, event.alignment);
+        // 時刻はレコーダのロック下で取るので単調増加する
+        putVarint(out, event.timestamp_ns - previous_ns);
+        previous_ns = event.timestamp_ns;
+    }
+    return out;
+}
+
+AllocationTrace decodeAllocationTrace(const std::string& bytes) {
+    Reader reader(bytes);
+    for (char c : kMagic) {
+        ORTEAF_THROW_IF(reader.byte() != static_cast<std::uint8_t>(c), InvalidArgument,
+                        "not an allocation trace");
+    }
+    std::uint32_t version = 0;
+    for (unsigned i = 0; i < 4; ++i) {
+        version |= static_cast<std::uint32_t>(reader.byte()) << (8 * i);
+    }
+    ORTEAF_THROW_IF(version != kVersion, InvalidArgument, "unsupported allocation trace version");
+
+    AllocationTrace trace{};
+    const std::uint64_t count = reader.varint();
+    trace.id_count = reader.varint();
+    trace.thread_count = static_cast<std::uint32_t>(reader.varint());
+    // 1 イベントは最低 6 バイトなので、それを超える件数は壊れたヘッダとみなす
+    ORTEAF_THROW_IF(count > bytes.size() / 6, InvalidArgument, "allocation trace event count is corrupt");
+    trace.events.reserve(static_cast<std::size_t>(count));
+
+    std::uint64_t now_ns = 0;
+    for (std::uint64_t i = 0; i < count; ++i) {
+        AllocationTraceEvent event{};
+        const std::uint8_t op = reader.byte();
+        ORTEAF_THROW_IF(op > static_cast<std::uint8_t>(AllocationTraceOp::Deallocate), InvalidArgument,
+                        "allocation trace has an unknown op");
+        event.op = static_cast<AllocationTraceOp>(op);
+        event.thread = static_cast<std::uint32_t>(reader.varint());
+        event.id = reader.varint();
+        event.size = reader.varint();
+        event.alignment = reader.varint();
+        now_ns += reader.varint();
+        event.timestamp_ns = now_ns;
+        ORTEAF_THROW_IF(event.id >= trace.id_count, InvalidArgument, "allocation trace id is out of range");
+        trace.events.push_back(event);
+    }
+    ORTEAF_THROW_IF(!reader.done(), InvalidArgument, "allocation trace has trailing bytes");
+    return trace;
+}
+
+void writeAllocationTrace(const std::string& path, const AllocationTrace& trace) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    ORTEAF_THROW_IF(!out, OperationFailed, "failed to open allocation trace for writing: " + path);
+    const std::string bytes = encodeAllocationTrace(trace);
+    out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    ORTEAF_THROW_IF(!out, OperationFailed, "failed to write allocation trace: " + path);
+}
+
+AllocationTrace readAllocationTrace(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    ORTEAF_THROW_IF(!in, OperationFailed, "failed to open allocation trace: " + path);
+    const std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return decodeAllocationTrace(bytes);
+}
+
+}  // namespace orteaf::internal::execution::allocator::trace
@@ -27,10 +27,20 @@ CpuHeapOps::BufferView CpuHeapOps::map(HeapRegion region) {
 }
 
 void CpuHeapOps::unmap(HeapRegion region, std::size_t size) {
-    if (!region) return;
+    if (!region || size == 0) return;
     void* base = region.data();
-    if (munmap(base, size) != 0) {
-        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu unmap munmap failed");
+    if (madvise(base, size, MADV_DONTNEED) != 0) {
+        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu unmap madvise failed");
+    }
+    if (mprotect(base, size, PROT_NONE) != 0) {
+        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu unmap mprotect failed");
+    }
+}
+
+void CpuHeapOps::release(HeapRegion region) {
+    if (!region) return;
+    if (munmap(region.data(), region.size()) != 0) {
+        diagnostics::error::throwError(diagnostics::error::OrteafErrc::OperationFailed, "cpu release munmap failed");
     }
 }
 
@@ -0,0 +1,40 @@
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_mmap.h"
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <limits>
+
+#include "orteaf/internal/base/math_utils.h"
+#include "orteaf/internal/diagnostics/error/error_macros.h"
+
+namespace orteaf::internal::execution::cpu::platform::wrapper {
+
+void* mapAligned(std::size_t size, std::size_t alignment, MapAccess access) {
+    ORTEAF_THROW_IF(!::orteaf::internal::base::isPowerOfTwo(alignment), InvalidParameter,
+                    "cpu::mapAligned requires a power-of-two alignment");
+    if (size == 0 || size > std::numeric_limits<std::size_t>::max() - alignment) {
+        return nullptr;
+    }
+    const std::size_t reserve_size = size + alignment;
+    const bool reserve_only = access == MapAccess::Reserve;
+    const int prot = reserve_only ? PROT_NONE : PROT_READ | PROT_WRITE;
+    const int flags = reserve_only ? MAP_PRIVATE | MAP_ANON | MAP_NORESERVE : MAP_PRIVATE | MAP_ANON;
+    void* raw = mmap(nullptr, reserve_size, prot, flags, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    const auto raw_addr = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t aligned_addr = (raw_addr + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+    const std::size_t head = aligned_addr - raw_addr;
+    const std::size_t tail = reserve_size - head - size;
+    if (head != 0) {
+        munmap(raw, head);
+    }
+    if (tail != 0) {
+        munmap(reinterpret_cast<void*>(aligned_addr + size), tail);
+    }
+    return reinterpret_cast<void*>(aligned_addr);
+}
+
+} // namespace orteaf::internal::execution::cpu::platform::wrapper
@@ -0,0 +1,173 @@
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+
+namespace orteaf::internal::execution::cpu::platform::wrapper {
+
+namespace {
+
+// Matches MPOL_PREFERRED in <linux/mempolicy.h>.
+constexpr int kMpolPreferred = 1;
+constexpr std::size_t kMaxNodes = 1024;
+constexpr std::size_t kBitsPerWord = sizeof(unsigned long) * 8;
+
+// Reads a decimal number at list[pos], advancing pos. Returns false when no
+// digit is present.
+bool parseNumber(std::string_view list, std::size_t& pos, std::size_t& value) noexcept {
+    const std::size_t start = pos;
+    value = 0;
+    while (pos < list.size() && list[pos] >= '0' && list[pos] <= '9') {
+        value = value * 10 + static_cast<std::size_t>(list[pos] - '0');
+        if (value >= kMaxNodes) {
+            return false;
+        }
+        ++pos;
+    }
+    return pos != start;
+}
+
+#if defined(__linux__)
+// Fallback for kernels without the `online` file: collect the IDs of the
+// nodeN directories. IDs may be sparse, so they are parsed, not counted.
+std::vector<std::size_t> scanNodeDirectories() {
+    std::vector<std::size_t> ids;
+    std::error_code ec;
+    std::filesystem::directory_iterator it("/sys/devices/system/node", ec);
+    if (ec) {
+        return ids;
+    }
+    for (const auto& entry : it) {
+        const std::string name = entry.path().filename().string();
+        if (name.size() > 4 && name.compare(0, 4, "node") == 0) {
+            std::size_t pos = 4;
+            std::size_t id = 0;
+            if (parseNumber(name, pos, id) && pos == name.size()) {
+                ids.push_back(id);
+            }
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+#endif
+
+std::vector<std::size_t> detectNodeIds() {
+    std::vector<std::size_t> ids;
+#if defined(__linux__)
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string list;
+    if (online && std::getline(online, list)) {
+        ids = parseNumaNodeList(list);
+    }
+    if (ids.empty()) {
+        ids = scanNodeDirectories();
+    }
+#endif
+    if (ids.empty()) {
+        ids.push_back(0);
+    }
+    return ids;
+}
+
+const std::vector<std::size_t>& nodeIds() noexcept {
+    static const std::vector<std::size_t> ids = detectNodeIds();
+    return ids;
+}
+
+}  // namespace
+
+std::vector<std::size_t> parseNumaNodeList(std::string_view list) {
+    std::vector<std::size_t> ids;
+    std::size_t pos = 0;
+    while (pos < list.size() && list[pos] != '\n') {
+        std::size_t first = 0;
+        if (!parseNumber(list, pos, first)) {
+            return {};
+        }
+        std::size_t last = first;
+        if (pos < list.size() && list[pos] == '-') {
+            ++pos;
+            if (!parseNumber(list, pos, last) || last < first) {
+                return {};
+            }
+        }
+        for (std::size_t id = first; id <= last; ++id) {
+            ids.push_back(id);
+        }
+        if (pos < list.size() && list[pos] == ',') {
+            ++pos;
+            if (pos == list.size() || list[pos] == '\n') {
+                return {};
+            }
+        } else if (pos < list.size() && list[pos] != '\n') {
+            return {};
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    return ids;
+}
+
+std::size_t numaNodeCount() noexcept {
+    return nodeIds().size();
+}
+
+std::size_t numaNodeId(std::size_t index) noexcept {
+    const auto& ids = nodeIds();
+    return index < ids.size() ? ids[index] : ids.front();
+}
+
+std::size_t numaNodeIndex(std::size_t node) noexcept {
+    const auto& ids = nodeIds();
+    const auto it = std::lower_bound(ids.begin(), ids.end(), node);
+    if (it == ids.end() || *it != node) {
+        return ids.size();
+    }
+    return static_cast<std::size_t>(it - ids.begin());
+}
+
+std::size_t currentNumaNode() noexcept {
+#if defined(__linux__) && defined(SYS_getcpu)
+    if (numaNodeCount() <= 1) {
+        return numaNodeId(0);
+    }
+    unsigned cpu = 0;
+    unsigned node = 0;
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return numaNodeId(0);
+    }
+    return numaNodeIndex(node) < numaNodeCount() ? node : numaNodeId(0);
+#else
+    return numaNodeId(0);
+#endif
+}
+
+bool bindToNumaNode(void* ptr, std::size_t size, std::size_t node) noexcept {
+#if defined(__linux__) && defined(SYS_mbind)
+    if (ptr == nullptr || size == 0 || numaNodeCount() <= 1 || node >= kMaxNodes) {
+        return false;
+    }
+    unsigned long mask[kMaxNodes / kBitsPerWord] = {};
+    mask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+    // The kernel treats maxnode as one past the highest usable bit.
+    const long rc = syscall(SYS_mbind, ptr, size, kMpolPreferred, mask, kMaxNodes + 1, 0u);
+    return rc == 0;
+#else
+    (void)ptr;
+    (void)size;
+    (void)node;
+    return false;
+#endif
+}
+
+} // namespace orteaf::internal::execution::cpu::platform::wrapper
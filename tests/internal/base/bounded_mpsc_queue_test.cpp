@@ -0,0 +1,89 @@
+#include "orteaf/internal/base/bounded_mpsc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace orteaf::internal::base {
+namespace {
+
+TEST(BoundedMpscQueue, RoundsCapacityUpToPowerOfTwo) {
+    EXPECT_EQ(BoundedMpscQueue<int>(0).capacity(), 2u);
+    EXPECT_EQ(BoundedMpscQueue<int>(5).capacity(), 8u);
+    EXPECT_EQ(BoundedMpscQueue<int>(16).capacity(), 16u);
+}
+
+TEST(BoundedMpscQueue, PopsInFifoOrderAndRejectsPushWhenFull) {
+    BoundedMpscQueue<int> queue(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(queue.tryPush(i));
+    }
+    int rejected = 99;
+    EXPECT_FALSE(queue.tryPush(rejected));
+    EXPECT_EQ(rejected, 99);
+    EXPECT_EQ(queue.sizeApprox(), 4u);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+    EXPECT_TRUE(queue.emptyApprox());
+
+    // 周回後も同じ順序で使える
+    for (int round = 0; round < 10; ++round) {
+        EXPECT_TRUE(queue.tryPush(round));
+        ASSERT_TRUE(queue.tryPop(value));
+        EXPECT_EQ(value, round);
+    }
+}
+
+TEST(BoundedMpscQueue, ConcurrentProducersDeliverEveryValueOnce) {
+    constexpr int kProducers = 4;
+    constexpr int kPerProducer = 20000;
+    BoundedMpscQueue<int> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < kProducers; ++p) {
+        producers.emplace_back([&queue, p] {
+            for (int i = 0; i < kPerProducer; ++i) {
+                int value = p * kPerProducer + i;
+                while (!queue.tryPush(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> seen(kProducers * kPerProducer, 0);
+    std::vector<int> last_from(kProducers, -1);
+    int received = 0;
+    int value = 0;
+    while (received < kProducers * kPerProducer) {
+        if (!queue.tryPop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ++seen[value];
+        // 同じ producer からの値は push 順に届く
+        const int producer = value / kPerProducer;
+        EXPECT_LT(last_from[producer], value);
+        last_from[producer] = value;
+        ++received;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    for (int count : seen) {
+        EXPECT_EQ(count, 1);
+    }
+    EXPECT_FALSE(queue.tryPop(value));
+}
+
+}  // namespace
+}  // namespace orteaf::internal::base
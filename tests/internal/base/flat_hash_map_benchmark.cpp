@@ -0,0 +1,105 @@
+#include "orteaf/internal/base/flat_hash_map.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "tests/internal/testing/benchmark.h"
+
+namespace {
+
+namespace base = ::orteaf::internal::base;
+
+constexpr std::size_t kKeys = 4096;
+constexpr std::size_t kLookups = 2'000'000;
+
+std::vector<std::uint64_t> makeIntegerKeys() {
+  std::mt19937_64 rng(42);
+  std::vector<std::uint64_t> keys(kKeys);
+  for (auto &key : keys) {
+    key = rng();
+  }
+  return keys;
+}
+
+// Cache keys look like "graph/<op>/<shape>"; long enough to defeat SSO.
+std::vector<std::string> makeStringKeys() {
+  std::vector<std::string> keys(kKeys);
+  for (std::size_t i = 0; i < kKeys; ++i) {
+    keys[i] = "graph/matmul_bias_relu/" + std::to_string(i * 7919) + "x" +
+              std::to_string(i);
+  }
+  return keys;
+}
+
+// Half of the probes hit, half miss (the key is perturbed so it is absent).
+template <typename Map, typename Keys, typename MakeMiss>
+double nsPerLookup(const Keys &keys, MakeMiss &&make_miss) {
+  Map map;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    map.emplace(keys[i], i);
+  }
+  auto misses = keys;
+  for (auto &key : misses) {
+    key = make_miss(key);
+  }
+
+  std::size_t found = 0;
+  const auto start = std::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < kLookups; ++i) {
+    const auto &key = (i & 1) != 0 ? misses[(i * 31) % kKeys]
+                                   : keys[(i * 17) % kKeys];
+    auto it = map.find(key);
+    found += it != map.end() ? 1 : 0;
+  }
+  const auto end = std::chrono::steady_clock::now();
+  ::orteaf::tests::doNotOptimize(found);
+  EXPECT_EQ(found, kLookups / 2);
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         static_cast<double>(kLookups);
+}
+
+TEST(FlatHashMapBenchmark, IntegerLookupVersusUnorderedMap) {
+  ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+
+  const auto keys = makeIntegerKeys();
+  auto miss = [](std::uint64_t key) { return ~key; };
+  const double unordered =
+      nsPerLookup<std::unordered_map<std::uint64_t, std::size_t>>(keys, miss);
+  const double flat =
+      nsPerLookup<base::FlatHashMap<std::uint64_t, std::size_t>>(keys, miss);
+
+  std::cout << "[flat_hash_map] uint64 keys=" << kKeys << " unordered_map "
+            << unordered << " ns/lookup flat " << flat << " ns/lookup"
+            << std::endl;
+  // 最適化なしのビルドでは抽象化のコストが支配的なので緩い上限のみ確認する
+  EXPECT_LT(flat, unordered * 2.0);
+}
+
+TEST(FlatHashMapBenchmark, StringKeyLookupVersusUnorderedMap) {
+  ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+
+  const auto keys = makeStringKeys();
+  auto miss = [](std::string key) {
+    key.back() = '#';
+    return key;
+  };
+  const double unordered =
+      nsPerLookup<std::unordered_map<std::string, std::size_t>>(keys, miss);
+  const double flat =
+      nsPerLookup<base::FlatHashMap<std::string, std::size_t>>(keys, miss);
+
+  std::cout << "[flat_hash_map] string keys=" << kKeys << " unordered_map "
+            << unordered << " ns/lookup flat " << flat << " ns/lookup"
+            << std::endl;
+  EXPECT_LT(flat, unordered * 2.0);
+}
+
+} // namespace
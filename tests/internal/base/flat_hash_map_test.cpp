@@ -0,0 +1,295 @@
+/**
+ * @file
+ * @brief FlatHashMapの挿入・検索・削除とリハッシュ、異種キー検索を検証するユニットテスト。
+ *
+ * - 大量挿入/削除を std::unordered_map と突き合わせ、tombstone 再利用とリハッシュ後の整合性を確認。
+ * - string_view / 文字列リテラルによる異種キー検索、Handle キー、例外を投げる要素での状態保持。
+ * - ポータブル (SWAR) グループのマッチ結果を SIMD 版と同じ規約で検証。
+ */
+#include "orteaf/internal/base/flat_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "orteaf/internal/base/handle.h"
+
+namespace orteaf::internal::base {
+namespace {
+
+struct CountingValue {
+  static inline int live_instances = 0;
+  int value = 0;
+
+  CountingValue() { ++live_instances; }
+  explicit CountingValue(int v) : value(v) { ++live_instances; }
+  CountingValue(const CountingValue &other) : value(other.value) {
+    ++live_instances;
+  }
+  CountingValue(CountingValue &&other) noexcept : value(other.value) {
+    ++live_instances;
+  }
+  CountingValue &operator=(const CountingValue &) = default;
+  ~CountingValue() { --live_instances; }
+
+  friend bool operator==(const CountingValue &lhs,
+                         const CountingValue &rhs) noexcept {
+    return lhs.value == rhs.value;
+  }
+};
+
+// 全キーを同じバケットに落とし、プローブ列と tombstone を強制的に使わせる
+struct CollidingHash {
+  std::size_t operator()(int) const noexcept { return 7; }
+};
+
+struct ThrowingCopy {
+  static inline int copies_until_throw = -1;
+  int value = 0;
+
+  explicit ThrowingCopy(int v) : value(v) {}
+  ThrowingCopy(const ThrowingCopy &other) : value(other.value) {
+    if (copies_until_throw == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    --copies_until_throw;
+  }
+  ThrowingCopy &operator=(const ThrowingCopy &) = default;
+};
+
+TEST(FlatHashMap, DefaultConstructedIsEmptyWithoutAllocation) {
+  FlatHashMap<int, int> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_EQ(map.capacity(), 0u);
+  EXPECT_EQ(map.begin(), map.end());
+  EXPECT_EQ(map.find(1), map.end());
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.erase(1), 0u);
+}
+
+TEST(FlatHashMap, InsertFindAndOverwrite) {
+  FlatHashMap<int, std::string> map;
+  auto [it, inserted] = map.emplace(1, "one");
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(it->first, 1);
+  EXPECT_EQ(it->second, "one");
+
+  // 既存キーへの emplace は値を作らず既存要素を返す
+  auto [again, inserted_again] = map.emplace(1, "uno");
+  EXPECT_FALSE(inserted_again);
+  EXPECT_EQ(again->second, "one");
+
+  auto [assigned, inserted_assign] = map.insertOrAssign(1, std::string("uno"));
+  EXPECT_FALSE(inserted_assign);
+  EXPECT_EQ(assigned->second, "uno");
+
+  map[2] = "two";
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_EQ(map.at(2), "two");
+  EXPECT_EQ(map.count(2), 1u);
+  EXPECT_THROW(map.at(3), std::out_of_range);
+}
+
+TEST(FlatHashMap, MatchesUnorderedMapUnderRandomChurn) {
+  FlatHashMap<std::uint64_t, std::uint64_t> map;
+  std::unordered_map<std::uint64_t, std::uint64_t> reference;
+  std::mt19937_64 rng(12345);
+  for (int i = 0; i < 20000; ++i) {
+    const std::uint64_t key = rng() % 2048;
+    switch (rng() % 3) {
+    case 0:
+    case 1:
+      map.insertOrAssign(key, static_cast<std::uint64_t>(i));
+      reference[key] = i;
+      break;
+    default:
+      EXPECT_EQ(map.erase(key), reference.erase(key));
+      break;
+    }
+  }
+  ASSERT_EQ(map.size(), reference.size());
+  for (const auto &[key, value] : reference) {
+    auto it = map.find(key);
+    ASSERT_NE(it, map.end());
+    EXPECT_EQ(it->second, value);
+  }
+  std::size_t visited = 0;
+  for (const auto &[key, value] : map) {
+    EXPECT_EQ(reference.at(key), value);
+    ++visited;
+  }
+  EXPECT_EQ(visited, reference.size());
+}
+
+TEST(FlatHashMap, CollidingKeysSurviveEraseAndReinsert) {
+  FlatHashMap<int, int, CollidingHash> map;
+  for (int i = 0; i < 100; ++i) {
+    map.emplace(i, i * 10);
+  }
+  for (int i = 0; i < 100; i += 2) {
+    EXPECT_EQ(map.erase(i), 1u);
+  }
+  // tombstone を跨いで奇数キーが見つかり、偶数キーは見つからない
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(map.contains(i), i % 2 == 1) << i;
+  }
+  const std::size_t capacity = map.capacity();
+  for (int round = 0; round < 20; ++round) {
+    for (int i = 0; i < 100; i += 2) {
+      map.emplace(i, i);
+    }
+    for (int i = 0; i < 100; i += 2) {
+      map.erase(i);
+    }
+  }
+  // 削除済みスロットの再利用/同容量での再構築で容量は増え続けない
+  EXPECT_EQ(map.capacity(), capacity);
+  EXPECT_EQ(map.size(), 50u);
+}
+
+TEST(FlatHashMap, ReserveAvoidsRehashing) {
+  FlatHashMap<int, int> map;
+  map.reserve(1000);
+  const std::size_t capacity = map.capacity();
+  EXPECT_GE(capacity * 7 / 8, 1000u);
+  auto first = map.emplace(0, 0).first;
+  for (int i = 1; i < 1000; ++i) {
+    map.emplace(i, i);
+  }
+  EXPECT_EQ(map.capacity(), capacity);
+  EXPECT_EQ(first->first, 0);
+}
+
+TEST(FlatHashMap, EraseByIteratorReturnsNext) {
+  FlatHashMap<int, int> map{{1, 1}, {2, 2}, {3, 3}, {4, 4}};
+  std::size_t erased = 0;
+  for (auto it = map.begin(); it != map.end();) {
+    if (it->first % 2 == 0) {
+      it = map.erase(it);
+      ++erased;
+    } else {
+      ++it;
+    }
+  }
+  EXPECT_EQ(erased, 2u);
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_TRUE(map.contains(3));
+}
+
+TEST(FlatHashMap, HeterogeneousStringLookup) {
+  FlatHashMap<std::string, int> map;
+  map.emplace("alpha", 1);
+  map.tryEmplace(std::string_view("beta"), 2);
+
+  const std::string_view key = "alpha";
+  EXPECT_EQ(map.find(key)->second, 1);
+  EXPECT_TRUE(map.contains("beta"));
+  EXPECT_EQ(map.at(std::string_view("beta")), 2);
+  EXPECT_EQ(map.count("gamma"), 0u);
+  EXPECT_EQ(map.erase(std::string_view("alpha")), 1u);
+  EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(FlatHashMap, HandleKeysDistinguishGenerations) {
+  struct Tag {};
+  using Key = Handle<Tag, std::uint32_t, std::uint8_t>;
+  FlatHashMap<Key, int> map;
+  map.emplace(Key{3, 0}, 1);
+  map.emplace(Key{3, 1}, 2);
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_EQ(map.at(Key{3, 0}), 1);
+  EXPECT_EQ(map.at(Key{3, 1}), 2);
+  EXPECT_FALSE(map.contains(Key{4, 0}));
+}
+
+TEST(FlatHashMap, CopyMoveAndClearManageLifetimes) {
+  CountingValue::live_instances = 0;
+  {
+    FlatHashMap<int, CountingValue> map;
+    for (int i = 0; i < 50; ++i) {
+      map.emplace(i, i);
+    }
+    EXPECT_EQ(CountingValue::live_instances, 50);
+
+    FlatHashMap<int, CountingValue> copy(map);
+    EXPECT_EQ(CountingValue::live_instances, 100);
+    EXPECT_TRUE(copy == map);
+
+    FlatHashMap<int, CountingValue> moved(std::move(copy));
+    EXPECT_EQ(CountingValue::live_instances, 100);
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.at(49).value, 49);
+
+    const std::size_t capacity = map.capacity();
+    map.clear();
+    EXPECT_EQ(CountingValue::live_instances, 50);
+    EXPECT_EQ(map.capacity(), capacity);
+    EXPECT_FALSE(map.contains(1));
+
+    swap(map, moved);
+    EXPECT_EQ(map.size(), 50u);
+    EXPECT_TRUE(moved.empty());
+  }
+  EXPECT_EQ(CountingValue::live_instances, 0);
+}
+
+TEST(FlatHashMap, ThrowingCopyDuringGrowthKeepsTable) {
+  FlatHashMap<int, ThrowingCopy> map;
+  ThrowingCopy::copies_until_throw = -1;
+  int inserted = 0;
+  while (map.size() < map.capacity() - map.capacity() / 8 || inserted == 0) {
+    map.emplace(inserted, inserted);
+    ++inserted;
+  }
+  const std::size_t capacity = map.capacity();
+
+  // 次の挿入で成長し、移動できない要素のコピー中に例外が飛ぶ
+  ThrowingCopy::copies_until_throw = 1;
+  EXPECT_THROW(map.emplace(inserted, inserted), std::runtime_error);
+  ThrowingCopy::copies_until_throw = -1;
+  EXPECT_EQ(map.capacity(), capacity);
+  EXPECT_EQ(map.size(), static_cast<std::size_t>(inserted));
+  for (int i = 0; i < inserted; ++i) {
+    EXPECT_EQ(map.at(i).value, i);
+  }
+}
+
+TEST(FlatHashGroup, PortableGroupMatchesLikeSimdGroup) {
+  using detail::FlatCtrl;
+  // 9 バイト目は ctrl + 1 からのグループ読み込み用
+  const FlatCtrl ctrl[9] = {5, detail::kFlatEmpty, 5, detail::kFlatDeleted,
+                            7, detail::kFlatEmpty, 0, 5, 1};
+  const detail::FlatGroupPortable group(ctrl);
+
+  std::vector<std::uint32_t> matches;
+  for (auto bits = group.match(5); bits; bits.clearLowestBit()) {
+    matches.push_back(bits.lowestBitSet());
+  }
+  EXPECT_EQ(matches, (std::vector<std::uint32_t>{0, 2, 7}));
+
+  auto empty = group.matchEmpty();
+  ASSERT_TRUE(empty);
+  EXPECT_EQ(empty.trailingZeros(), 1u);
+  EXPECT_EQ(empty.leadingZeros(), 2u);
+
+  std::uint32_t empty_or_deleted = 0;
+  for (auto bits = group.matchEmptyOrDeleted(); bits; bits.clearLowestBit()) {
+    ++empty_or_deleted;
+  }
+  EXPECT_EQ(empty_or_deleted, 3u);
+  EXPECT_EQ(group.countLeadingEmptyOrDeleted(), 0u);
+  EXPECT_EQ(detail::FlatGroupPortable(ctrl + 1).countLeadingEmptyOrDeleted(),
+            1u);
+}
+
+} // namespace
+} // namespace orteaf::internal::base
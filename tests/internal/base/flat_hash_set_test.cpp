@@ -0,0 +1,48 @@
+#include "orteaf/internal/base/flat_hash_set.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <set>
+#include <string>
+#include <string_view>
+
+namespace orteaf::internal::base {
+namespace {
+
+TEST(FlatHashSet, InsertRejectsDuplicates) {
+  FlatHashSet<int> set;
+  EXPECT_TRUE(set.insert(1).second);
+  EXPECT_FALSE(set.insert(1).second);
+  EXPECT_TRUE(set.emplace(2).second);
+  EXPECT_EQ(set.size(), 2u);
+  EXPECT_EQ(*set.find(2), 2);
+  EXPECT_EQ(set.find(3), set.end());
+}
+
+TEST(FlatHashSet, GrowsAndIteratesEveryKey) {
+  FlatHashSet<int> set;
+  for (int i = 0; i < 1000; ++i) {
+    set.insert(i);
+  }
+  for (int i = 0; i < 1000; i += 3) {
+    EXPECT_EQ(set.erase(i), 1u);
+  }
+  std::set<int> seen(set.begin(), set.end());
+  EXPECT_EQ(seen.size(), set.size());
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(seen.count(i) == 1, i % 3 != 0) << i;
+  }
+}
+
+TEST(FlatHashSet, HeterogeneousStringLookupAndInsert) {
+  FlatHashSet<std::string> set{"graph", "library"};
+  EXPECT_TRUE(set.contains(std::string_view("graph")));
+  EXPECT_TRUE(set.insert(std::string_view("pipeline")).second);
+  EXPECT_FALSE(set.insert("pipeline").second);
+  EXPECT_EQ(set.erase("library"), 1u);
+  EXPECT_EQ(set, (FlatHashSet<std::string>{"graph", "pipeline"}));
+}
+
+} // namespace
+} // namespace orteaf::internal::base
@@ -0,0 +1,147 @@
+#include "orteaf/internal/base/lease/control_block/ref_count.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+
+#include "orteaf/internal/base/handle.h"
+#include "orteaf/internal/base/lease/control_block/shared.h"
+#include "orteaf/internal/base/lease/control_block/strong.h"
+#include "orteaf/internal/base/lease/control_block/weak.h"
+
+namespace {
+
+namespace base = ::orteaf::internal::base;
+
+struct PayloadTag {};
+using PayloadHandle =
+    base::Handle<PayloadTag, std::uint32_t, std::uint8_t>;
+
+struct DummyPayload {
+  int value{0};
+};
+
+struct DummyPool {
+  std::size_t release_calls{0};
+
+  bool release(PayloadHandle) {
+    ++release_calls;
+    return true;
+  }
+};
+
+template <typename CountT> class RefCountPolicyTest : public ::testing::Test {};
+
+using Policies = ::testing::Types<base::AtomicRefCount, base::PlainRefCount,
+                                  base::BiasedRefCount>;
+TYPED_TEST_SUITE(RefCountPolicyTest, Policies);
+
+TYPED_TEST(RefCountPolicyTest, DecrementReportsTransitionToZero) {
+  TypeParam count;
+  count.increment();
+  count.increment();
+  EXPECT_EQ(count.load(), 2u);
+  EXPECT_FALSE(count.decrement());
+  EXPECT_TRUE(count.decrement());
+  EXPECT_EQ(count.load(), 0u);
+  // 0 からの decrement は無視される
+  EXPECT_FALSE(count.decrement());
+  EXPECT_EQ(count.load(), 0u);
+}
+
+TYPED_TEST(RefCountPolicyTest, PromotionOnlySucceedsWhileNonZero) {
+  TypeParam count;
+  EXPECT_FALSE(count.tryIncrementIfNonZero());
+  count.increment();
+  EXPECT_TRUE(count.tryIncrementIfNonZero());
+  EXPECT_EQ(count.load(), 2u);
+}
+
+TYPED_TEST(RefCountPolicyTest, SharedControlBlockReleasesPayloadOnce) {
+  using CB = base::SharedControlBlock<PayloadHandle, DummyPayload, DummyPool,
+                                      TypeParam>;
+  static_assert(std::is_same_v<typename CB::RefCount, TypeParam>);
+  DummyPool pool{};
+  DummyPayload payload{};
+  CB cb;
+  ASSERT_TRUE(cb.tryBindPayload(PayloadHandle{1, 0}, &payload, &pool));
+
+  cb.acquireStrong();
+  cb.acquireWeak();
+  EXPECT_TRUE(cb.tryPromoteWeakToStrong());
+  EXPECT_FALSE(cb.releaseStrong());
+  EXPECT_TRUE(cb.releaseStrong());
+  EXPECT_EQ(pool.release_calls, 1u);
+  EXPECT_FALSE(cb.tryPromoteWeakToStrong());
+  EXPECT_TRUE(cb.releaseWeak());
+  EXPECT_TRUE(cb.canShutdown());
+}
+
+TEST(BiasedRefCount, OwnerKeepsBiasUntilAnotherThreadTouchesIt) {
+  base::BiasedRefCount count;
+  EXPECT_FALSE(count.isBiased());
+  count.increment();
+  EXPECT_TRUE(count.isBiased());
+  count.increment();
+  EXPECT_FALSE(count.decrement());
+  EXPECT_TRUE(count.isBiased());
+
+  // 別スレッドへの受け渡し（join で同期）で bias が外れる
+  std::thread([&count] {
+    count.increment();
+    EXPECT_FALSE(count.decrement());
+  }).join();
+  EXPECT_FALSE(count.isBiased());
+  EXPECT_EQ(count.load(), 1u);
+  EXPECT_TRUE(count.decrement());
+}
+
+TEST(BiasedRefCount, LastReleaseOnAnotherThreadReportsZero) {
+  base::BiasedRefCount count;
+  count.increment();
+  bool released = false;
+  std::thread([&] { released = count.decrement(); }).join();
+  EXPECT_TRUE(released);
+  EXPECT_EQ(count.load(), 0u);
+
+  // 0 から再取得したスレッドが新しい owner になる
+  std::thread([&count] {
+    count.increment();
+    EXPECT_TRUE(count.isBiased());
+    EXPECT_TRUE(count.decrement());
+  }).join();
+}
+
+TEST(RebindRefCount, ReplacesPolicyOfControlBlockTemplates) {
+  using Strong = base::StrongControlBlock<PayloadHandle, DummyPayload, DummyPool>;
+  using Weak = base::WeakControlBlock<PayloadHandle, DummyPayload, DummyPool>;
+  static_assert(std::is_same_v<typename Strong::RefCount, base::AtomicRefCount>);
+  static_assert(
+      std::is_same_v<base::RebindRefCountT<Strong, base::PlainRefCount>,
+                     base::StrongControlBlock<PayloadHandle, DummyPayload,
+                                              DummyPool, base::PlainRefCount>>);
+  static_assert(
+      std::is_same_v<
+          typename base::RebindRefCountT<Weak, base::BiasedRefCount>::RefCount,
+          base::BiasedRefCount>);
+  static_assert(std::is_same_v<base::RebindRefCountT<int, base::PlainRefCount>,
+                               int>);
+}
+
+TEST(RebindRefCount, UsesRefCountDetectsUnchangedTypes) {
+  using Strong = base::StrongControlBlock<PayloadHandle, DummyPayload, DummyPool>;
+  static_assert(base::ControlBlockUsesRefCount<
+                base::RebindRefCountT<Strong, base::PlainRefCount>,
+                base::PlainRefCount>);
+  static_assert(
+      !base::ControlBlockUsesRefCount<Strong, base::PlainRefCount>);
+  // 差し替えられない型は RefCount を持たないか、元の方式のまま残る
+  static_assert(!base::ControlBlockUsesRefCount<
+                base::RebindRefCountT<int, base::PlainRefCount>,
+                base::PlainRefCount>);
+}
+
+} // namespace
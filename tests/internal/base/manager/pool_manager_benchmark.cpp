@@ -0,0 +1,109 @@
+#include "orteaf/internal/base/manager/pool_manager.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/base/handle.h"
+#include "orteaf/internal/base/lease/control_block/shared.h"
+#include "orteaf/internal/base/pool/slot_pool.h"
+#include "tests/internal/testing/benchmark.h"
+
+namespace {
+
+struct BenchPayloadTag {};
+using BenchPayloadHandle =
+    ::orteaf::internal::base::Handle<BenchPayloadTag, std::uint32_t,
+                                     std::uint8_t>;
+
+struct BenchPayloadTraits {
+  using Payload = int;
+  using Handle = BenchPayloadHandle;
+  struct Request {};
+  struct Context {};
+
+  static bool create(Payload &payload, const Request &, const Context &) {
+    payload = 1;
+    return true;
+  }
+
+  static void destroy(Payload &payload, const Request &, const Context &) {
+    payload = 0;
+  }
+};
+
+using BenchPayloadPool =
+    ::orteaf::internal::base::pool::SlotPool<BenchPayloadTraits>;
+
+struct BenchManagerTraits {
+  using PayloadHandle = BenchPayloadHandle;
+  using PayloadPool = BenchPayloadPool;
+  using ControlBlock = ::orteaf::internal::base::SharedControlBlock<
+      PayloadHandle, int, PayloadPool>;
+  struct ControlBlockTag {};
+  static constexpr const char *Name = "BenchManager";
+};
+
+using BenchManager = ::orteaf::internal::base::PoolManager<BenchManagerTraits>;
+
+constexpr std::size_t kLeasesPerGraph = 256;
+constexpr std::size_t kRounds = 2000;
+
+// One "graph build": fresh manager, kLeasesPerGraph payloads, then one lease
+// per payload. Control blocks start empty so growth is part of the cost.
+template <typename AcquireAndRelease>
+double nsPerLease(AcquireAndRelease &&acquire_and_release) {
+  double total_ns = 0.0;
+  for (std::size_t round = 0; round < kRounds; ++round) {
+    BenchManager manager;
+    BenchManager::Config config{};
+    config.control_block_block_size = 64;
+    config.control_block_growth_chunk_size = 16;
+    config.payload_capacity = kLeasesPerGraph;
+    config.payload_block_size = kLeasesPerGraph;
+    BenchPayloadTraits::Request req{};
+    BenchPayloadTraits::Context ctx{};
+    manager.configure(config, req, ctx);
+    manager.createAllPayloads(req, ctx);
+    std::vector<BenchPayloadHandle> handles(kLeasesPerGraph);
+    for (auto &handle : handles) {
+      handle = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    acquire_and_release(manager, handles);
+    const auto end = std::chrono::steady_clock::now();
+    total_ns += std::chrono::duration<double, std::nano>(end - start).count();
+  }
+  return total_ns / static_cast<double>(kRounds * kLeasesPerGraph);
+}
+
+TEST(PoolManagerBenchmark, BatchVersusSingleStrongLeaseAcquisition) {
+  ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+
+  const double single = nsPerLease(
+      [](BenchManager &manager, const std::vector<BenchPayloadHandle> &handles) {
+        std::vector<BenchManager::StrongLeaseType> leases{};
+        leases.reserve(handles.size());
+        for (const auto &handle : handles) {
+          leases.push_back(manager.acquireStrongLease(handle));
+        }
+        leases.clear();
+      });
+  const double batch = nsPerLease(
+      [](BenchManager &manager, const std::vector<BenchPayloadHandle> &handles) {
+        auto leases = manager.acquireStrongLeases(handles);
+        manager.releaseStrongLeases(leases);
+      });
+
+  std::cout << "[pool_manager] leases=" << kLeasesPerGraph << " single "
+            << single << " ns/lease batch " << batch << " ns/lease"
+            << std::endl;
+  EXPECT_LT(batch, single * 2.0);
+}
+
+} // namespace
@@ -2,10 +2,16 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <type_traits>
+#include <vector>
+
 #include "orteaf/internal/base/handle.h"
 #include "orteaf/internal/base/lease/control_block/shared.h"
+#include "orteaf/internal/base/pool/concurrent_slot_pool.h"
 #include "orteaf/internal/base/pool/slot_pool.h"
 #include "orteaf/internal/base/pool/with_control_block_binding.h"
+#include "tests/internal/testing/benchmark.h"
 #include "tests/internal/testing/error_assert.h"
 
 namespace {
@@ -41,11 +47,11 @@ using ControlBlock = ::orteaf::internal::base::SharedControlBlock<
     PayloadHandle, DummyPayload, PayloadPool>;
 
 struct DummyManagerTraits {
+  using PayloadHandle = ::PayloadHandle;
   using PayloadPool = ::orteaf::internal::base::pool::SlotPool<DummyPayloadTraits>;
   using ControlBlock = ::orteaf::internal::base::SharedControlBlock<
       PayloadHandle, DummyPayload, PayloadPool>;
   struct ControlBlockTag {};
-  using PayloadHandle = ::PayloadHandle;
   static constexpr const char *Name = "DummyManager";
 };
 
@@ -71,6 +77,30 @@ struct BoundManagerTraits {
 using BoundPoolManager =
     ::orteaf::internal::base::PoolManager<BoundManagerTraits>;
 
+using ConcurrentPayloadPool =
+    ::orteaf::internal::base::pool::ConcurrentSlotPool<DummyPayloadTraits>;
+
+struct ConcurrentManagerTraits {
+  using PayloadHandle = ::PayloadHandle;
+  using PayloadPool = ConcurrentPayloadPool;
+  using ControlBlock = ::orteaf::internal::base::SharedControlBlock<
+      PayloadHandle, DummyPayload, ConcurrentPayloadPool>;
+  struct ControlBlockTag {};
+  static constexpr const char *Name = "ConcurrentManager";
+  static constexpr bool concurrent_control_block_pool = true;
+};
+
+using ConcurrentPoolManager =
+    ::orteaf::internal::base::PoolManager<ConcurrentManagerTraits>;
+
+struct PlainCountManagerTraits : DummyManagerTraits {
+  using RefCountPolicy = ::orteaf::internal::base::PlainRefCount;
+  static constexpr const char *Name = "PlainCountManager";
+};
+
+using PlainCountPoolManager =
+    ::orteaf::internal::base::PoolManager<PlainCountManagerTraits>;
+
 PoolManager::Config makeBaseConfig() {
   PoolManager::Config config{};
   config.control_block_capacity = 2;
@@ -797,4 +827,248 @@ TEST(PoolManager, AcquireWeakLeaseTwiceReusesSameControlBlockAndHandle) {
   EXPECT_EQ(second.payloadHandle(), handle);
 }
 
+std::vector<PayloadHandle> createPayloads(PoolManager &manager,
+                                          std::size_t count) {
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  std::vector<PayloadHandle> handles{};
+  for (std::size_t i = 0; i < count; ++i) {
+    handles.push_back(manager.acquirePayloadOrGrowAndCreate(req, ctx));
+  }
+  return handles;
+}
+
+TEST(PoolManager, AcquireStrongLeasesBindsPayloadsInOrderWithOneGrowth) {
+  PoolManager manager;
+  auto config = makeBaseConfig();
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+  const auto handles = createPayloads(manager, 5);
+
+  auto leases = manager.acquireStrongLeases(handles);
+  ASSERT_EQ(leases.size(), handles.size());
+  for (std::size_t i = 0; i < handles.size(); ++i) {
+    EXPECT_TRUE(leases[i]);
+    EXPECT_EQ(leases[i].payloadHandle(), handles[i]);
+    EXPECT_EQ(leases[i].strongCount(), 1u);
+    EXPECT_EQ(leases[i].payloadPtr()->value, 1);
+  }
+  // 不足分 3 個だけを一度に拡張する
+  EXPECT_EQ(manager.controlBlockPoolSizeForTest(), 5u);
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(), 0u);
+}
+
+TEST(PoolManager, AcquireStrongLeasesRoundsGrowthUpToChunkSize) {
+  PoolManager manager;
+  auto config = makeBaseConfig();
+  config.control_block_growth_chunk_size = 4;
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+  const auto handles = createPayloads(manager, 5);
+
+  auto leases = manager.acquireStrongLeases(handles);
+  EXPECT_EQ(leases.size(), 5u);
+  EXPECT_EQ(manager.controlBlockPoolSizeForTest(), 6u);
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(), 1u);
+}
+
+TEST(PoolManager, AcquireStrongLeasesRejectsInvalidHandleWithoutSideEffects) {
+  PoolManager manager;
+  auto config = makeBaseConfig();
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+  auto handles = createPayloads(manager, 2);
+  handles.push_back(PayloadHandle::invalid());
+
+  ::orteaf::tests::ExpectErrorMessage(
+      ::orteaf::internal::diagnostics::error::OrteafErrc::InvalidArgument,
+      {"DummyManager", "handle is invalid"},
+      [&] { (void)manager.acquireStrongLeases(handles); });
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(),
+            manager.controlBlockPoolSizeForTest());
+  EXPECT_TRUE(manager.payloadCreatedForTest(handles[0]));
+}
+
+TEST(PoolManager, AcquireStrongLeasesReusesBoundControlBlockForDuplicates) {
+  BoundPoolManager manager;
+  BoundPoolManager::Config config{};
+  config.control_block_capacity = 1;
+  config.control_block_block_size = 1;
+  config.control_block_growth_chunk_size = 1;
+  config.payload_growth_chunk_size = 1;
+  config.payload_capacity = 2;
+  config.payload_block_size = 2;
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+  auto first = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+  auto second = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+
+  const std::vector<PayloadHandle> handles{first, second, first};
+  auto leases = manager.acquireStrongLeases(handles);
+  ASSERT_EQ(leases.size(), 3u);
+  EXPECT_EQ(leases[0].handle(), leases[2].handle());
+  EXPECT_NE(leases[0].handle(), leases[1].handle());
+  EXPECT_EQ(leases[0].strongCount(), 2u);
+  EXPECT_EQ(manager.boundControlBlockForTest(first), leases[0].handle());
+  // 重複分に確保した CB は返却済み
+  EXPECT_EQ(manager.controlBlockPoolSizeForTest() -
+                manager.controlBlockPoolAvailableForTest(),
+            2u);
+}
+
+TEST(PoolManager, ReleaseStrongLeasesReturnsControlBlocksAndPayloads) {
+  PoolManager manager;
+  auto config = makeBaseConfig();
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+  const auto handles = createPayloads(manager, 4);
+  auto leases = manager.acquireStrongLeases(handles);
+  auto kept = leases[1];
+
+  manager.releaseStrongLeases(leases);
+  for (const auto &lease : leases) {
+    EXPECT_FALSE(lease);
+  }
+  // コピーが残っている Lease の CB と payload は生きたまま
+  EXPECT_TRUE(kept);
+  EXPECT_EQ(kept.strongCount(), 1u);
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(),
+            manager.controlBlockPoolSizeForTest() - 1);
+  EXPECT_EQ(manager.payloadPoolAvailableForTest(),
+            manager.payloadPoolSizeForTest() - 1);
+
+  kept.release();
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(),
+            manager.controlBlockPoolSizeForTest());
+  EXPECT_EQ(manager.payloadPoolAvailableForTest(),
+            manager.payloadPoolSizeForTest());
+}
+
+TEST(PoolManager, ConcurrentBatchLeasesFromManyThreads) {
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kIterations = 500;
+  constexpr std::size_t kBatch = 8;
+  ConcurrentPoolManager manager;
+  ConcurrentPoolManager::Config config{};
+  config.control_block_capacity = 0;
+  config.control_block_block_size = 4;
+  config.control_block_growth_chunk_size = 4;
+  config.payload_growth_chunk_size = kBatch;
+  config.payload_capacity = 4;
+  config.payload_block_size = 4;
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+
+  std::atomic<std::size_t> failures{0};
+  ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t) {
+    std::vector<PayloadHandle> handles(kBatch);
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      for (auto &handle : handles) {
+        handle = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+        while (!handle.isValid()) {
+          handle = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+        }
+      }
+      auto leases = manager.acquireStrongLeases(handles);
+      for (std::size_t j = 0; j < kBatch; ++j) {
+        if (leases[j].payloadHandle() != handles[j]) {
+          failures.fetch_add(1);
+        }
+      }
+      manager.releaseStrongLeases(leases);
+    }
+  });
+  EXPECT_EQ(failures.load(), 0u);
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(),
+            manager.controlBlockPoolSizeForTest());
+  EXPECT_EQ(manager.payloadPoolAvailableForTest(),
+            manager.payloadPoolSizeForTest());
+}
+
+TEST(PoolManager, RefCountPolicyIsSelectedByTraits) {
+  static_assert(std::is_same_v<PoolManager::ControlBlock::RefCount,
+                               ::orteaf::internal::base::AtomicRefCount>);
+  static_assert(std::is_same_v<PlainCountPoolManager::ControlBlock::RefCount,
+                               ::orteaf::internal::base::PlainRefCount>);
+
+  PlainCountPoolManager manager;
+  PlainCountPoolManager::Config config{};
+  config.control_block_capacity = 1;
+  config.control_block_block_size = 1;
+  config.control_block_growth_chunk_size = 1;
+  config.payload_growth_chunk_size = 1;
+  config.payload_capacity = 1;
+  config.payload_block_size = 1;
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+  auto handle = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+
+  auto lease = manager.acquireStrongLease(handle);
+  {
+    auto copy = lease;
+    EXPECT_EQ(lease.strongCount(), 2u);
+  }
+  EXPECT_EQ(lease.strongCount(), 1u);
+  lease.release();
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(),
+            manager.controlBlockPoolSizeForTest());
+  EXPECT_EQ(manager.payloadPoolAvailableForTest(),
+            manager.payloadPoolSizeForTest());
+}
+
+TEST(PoolManager, ConcurrentControlBlockPoolIsSelectedByTraits) {
+  static_assert(!PoolManager::kConcurrentControlBlockPool);
+  static_assert(ConcurrentPoolManager::kConcurrentControlBlockPool);
+  static_assert(std::is_same_v<
+                ConcurrentPoolManager::ControlBlockPool,
+                ::orteaf::internal::base::pool::ConcurrentSlotPool<
+                    ConcurrentPoolManager::ControlBlockPoolTraits>>);
+}
+
+TEST(PoolManager, ConcurrentLeaseAcquisitionFromManyThreads) {
+  constexpr std::size_t kThreads = 8;
+  constexpr std::size_t kIterations = 2000;
+  ConcurrentPoolManager manager;
+  ConcurrentPoolManager::Config config{};
+  config.control_block_capacity = 0;
+  config.control_block_block_size = 4;
+  config.control_block_growth_chunk_size = 2;
+  config.payload_growth_chunk_size = 1;
+  config.payload_capacity = 4;
+  config.payload_block_size = 4;
+  DummyPayloadTraits::Request req{};
+  DummyPayloadTraits::Context ctx{};
+  manager.configure(config, req, ctx);
+
+  // 最後の StrongLease が破棄されると payload も Pool に返却される
+  std::atomic<std::size_t> failures{0};
+  ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t) {
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      auto payload = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+      while (!payload.isValid()) {
+        payload = manager.acquirePayloadOrGrowAndCreate(req, ctx);
+      }
+      auto lease = manager.acquireStrongLease(payload);
+      auto copy = lease;
+      if (!copy || copy.payloadPtr() == nullptr ||
+          copy.payloadPtr()->value != 1) {
+        failures.fetch_add(1);
+      }
+    }
+  });
+  EXPECT_EQ(failures.load(), 0u);
+  // 全 Lease が返却済みなら ControlBlock はすべて再利用可能
+  EXPECT_EQ(manager.controlBlockPoolAvailableForTest(),
+            manager.controlBlockPoolSizeForTest());
+  EXPECT_EQ(manager.payloadPoolAvailableForTest(),
+            manager.payloadPoolSizeForTest());
+}
+
 } // namespace
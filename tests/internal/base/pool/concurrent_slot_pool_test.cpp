@@ -0,0 +1,286 @@
+#include "orteaf/internal/base/pool/concurrent_slot_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <span>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "orteaf/internal/base/handle.h"
+#include "tests/internal/testing/benchmark.h"
+
+namespace {
+
+struct SlotTag {};
+using SlotHandle =
+    ::orteaf::internal::base::Handle<SlotTag, std::uint32_t, std::uint8_t>;
+
+struct DummyPayload {
+  int value{0};
+  std::atomic<int> owner{-1};
+};
+
+struct DummyTraits {
+  using Payload = DummyPayload;
+  using Handle = SlotHandle;
+  struct Request {};
+  struct Context {};
+
+  static bool create(Payload &payload, const Request &, const Context &) {
+    payload.value = 42;
+    return true;
+  }
+
+  static void destroy(Payload &payload, const Request &, const Context &) {
+    payload.value = 0;
+  }
+};
+
+using Pool = ::orteaf::internal::base::pool::ConcurrentSlotPool<DummyTraits>;
+
+DummyTraits::Request req{};
+DummyTraits::Context ctx{};
+
+Pool makePool(std::size_t size, std::size_t block_size = 4) {
+  Pool pool;
+  pool.setBlockSize(block_size);
+  pool.resize(size);
+  return pool;
+}
+
+TEST(ConcurrentSlotPool, ResizeAddsUncreatedSlotsLowestFirst) {
+  auto pool = makePool(3);
+  EXPECT_EQ(pool.size(), 3u);
+  EXPECT_EQ(pool.available(), 3u);
+
+  auto first = pool.reserveUncreated();
+  EXPECT_EQ(first.index, 0u);
+  EXPECT_FALSE(pool.isCreated(first));
+  EXPECT_FALSE(pool.tryAcquireCreated().isValid());
+  EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(ConcurrentSlotPool, ResizeThenCreateRangeFilesSlotsAsCreated) {
+  auto pool = makePool(2);
+  const std::size_t old_size = pool.resize(5);
+  EXPECT_EQ(old_size, 2u);
+  EXPECT_TRUE(pool.createRange(old_size, pool.size(), req, ctx));
+
+  std::set<std::size_t> created{};
+  for (int i = 0; i < 3; ++i) {
+    auto handle = pool.tryAcquireCreated();
+    ASSERT_TRUE(handle.isValid());
+    EXPECT_EQ(pool.get(handle)->value, 42);
+    created.insert(handle.index);
+  }
+  EXPECT_EQ(created, (std::set<std::size_t>{2, 3, 4}));
+  EXPECT_FALSE(pool.tryAcquireCreated().isValid());
+  EXPECT_TRUE(pool.tryReserveUncreated().isValid());
+  EXPECT_TRUE(pool.tryReserveUncreated().isValid());
+  EXPECT_FALSE(pool.tryReserveUncreated().isValid());
+}
+
+TEST(ConcurrentSlotPool, CreateAllAfterPublicationIsStillAcquirable) {
+  auto pool = makePool(3);
+  // 一度取得・返却して freelist に載せた後で作成する
+  auto slot = pool.reserveUncreated();
+  EXPECT_TRUE(pool.release(slot));
+  EXPECT_TRUE(pool.createAll(req, ctx));
+
+  for (int i = 0; i < 3; ++i) {
+    auto handle = pool.tryAcquireCreated();
+    ASSERT_TRUE(handle.isValid());
+    EXPECT_TRUE(pool.isCreated(handle));
+  }
+  EXPECT_FALSE(pool.tryAcquireCreated().isValid());
+  EXPECT_FALSE(pool.tryReserveUncreated().isValid());
+}
+
+TEST(ConcurrentSlotPool, ReleaseBumpsGenerationAndRejectsStaleHandles) {
+  auto pool = makePool(1);
+  auto first = pool.reserveUncreated();
+  EXPECT_TRUE(pool.emplace(first, req, ctx));
+  EXPECT_TRUE(pool.release(first));
+  EXPECT_FALSE(pool.release(first));
+  EXPECT_EQ(pool.get(first), nullptr);
+
+  auto second = pool.acquireCreated();
+  EXPECT_EQ(second.index, first.index);
+  EXPECT_EQ(static_cast<std::size_t>(second.generation),
+            static_cast<std::size_t>(first.generation) + 1u);
+}
+
+TEST(ConcurrentSlotPool, GenerationKeepsWorkingPastHandleWidth) {
+  auto pool = makePool(1);
+  SlotHandle handle = pool.reserveUncreated();
+  for (int i = 0; i < 600; ++i) {
+    ASSERT_TRUE(pool.release(handle));
+    handle = pool.reserveUncreated();
+    ASSERT_TRUE(pool.isValid(handle));
+  }
+  EXPECT_EQ(handle.generation, static_cast<std::uint8_t>(600));
+}
+
+TEST(ConcurrentSlotPool, DestroyedSlotReturnsToUncreatedList) {
+  auto pool = makePool(2);
+  EXPECT_TRUE(pool.createAll(req, ctx));
+  auto slot = pool.acquireCreated();
+  EXPECT_TRUE(pool.destroy(slot, req, ctx));
+  EXPECT_EQ(pool.get(slot)->value, 0);
+  EXPECT_TRUE(pool.release(slot));
+
+  auto reserved = pool.reserveUncreated();
+  EXPECT_EQ(reserved.index, slot.index);
+}
+
+TEST(ConcurrentSlotPool, ThrowsWhenEmptyOrShrinking) {
+  auto pool = makePool(1);
+  EXPECT_THROW(pool.acquireCreated(), std::system_error);
+  (void)pool.reserveUncreated();
+  EXPECT_THROW(pool.reserveUncreated(), std::system_error);
+  EXPECT_THROW(pool.resize(0), std::system_error);
+  EXPECT_THROW(pool.setBlockSize(0), std::system_error);
+}
+
+TEST(ConcurrentSlotPool, StorageGrowsInStableSegments) {
+  auto pool = makePool(1, /*block_size=*/2);
+  auto first = pool.reserveUncreated();
+  DummyPayload *address = pool.get(first);
+  pool.resize(100);
+  EXPECT_GE(pool.capacity(), 100u);
+  EXPECT_EQ(pool.get(first), address);
+}
+
+TEST(ConcurrentSlotPool, ClearDestroysCreatedAndMoveKeepsFreelists) {
+  auto pool = makePool(3);
+  EXPECT_TRUE(pool.createRange(0, 2, req, ctx));
+  auto held = pool.acquireCreated();
+
+  Pool moved(std::move(pool));
+  EXPECT_EQ(moved.size(), 3u);
+  EXPECT_EQ(moved.available(), 2u);
+  EXPECT_TRUE(moved.isCreated(held));
+  EXPECT_TRUE(moved.tryAcquireCreated().isValid());
+  EXPECT_TRUE(moved.tryReserveUncreated().isValid());
+  EXPECT_EQ(pool.size(), 0u);
+
+  std::size_t visited = 0;
+  moved.forEachCreated([&](std::size_t, const DummyPayload &) { ++visited; });
+  EXPECT_EQ(visited, 2u);
+  moved.clear(req, ctx);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(moved.available(), 0u);
+}
+
+TEST(ConcurrentSlotPool, BatchReleaseSplicesEachFreelist) {
+  auto pool = makePool(4);
+  EXPECT_TRUE(pool.createRange(0, 2, req, ctx));
+
+  std::vector<SlotHandle> handles(4);
+  EXPECT_EQ(pool.tryAcquireCreated(handles), 2u);
+  handles[2] = pool.reserveUncreated();
+  handles[3] = handles[0];
+  EXPECT_EQ(pool.release(std::span<const SlotHandle>(handles)), 3u);
+  EXPECT_EQ(pool.available(), 4u);
+
+  std::set<std::size_t> created{};
+  for (auto handle = pool.tryAcquireCreated(); handle.isValid();
+       handle = pool.tryAcquireCreated()) {
+    created.insert(handle.index);
+  }
+  EXPECT_EQ(created, (std::set<std::size_t>{0, 1}));
+  EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(ConcurrentSlotPool, ConcurrentChurnNeverHandsOutASlotTwice) {
+  constexpr std::size_t kThreads = 8;
+  constexpr std::size_t kIterations = 20000;
+  auto pool = makePool(kThreads * 2);
+  EXPECT_TRUE(pool.createAll(req, ctx));
+
+  std::atomic<std::size_t> conflicts{0};
+  ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t t) {
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      auto handle = pool.tryAcquireCreated();
+      if (!handle.isValid()) {
+        continue;
+      }
+      DummyPayload *payload = pool.get(handle);
+      int expected = -1;
+      if (!payload->owner.compare_exchange_strong(expected,
+                                                  static_cast<int>(t))) {
+        conflicts.fetch_add(1);
+      }
+      payload->owner.store(-1);
+      if (!pool.release(handle)) {
+        conflicts.fetch_add(1);
+      }
+    }
+  });
+  EXPECT_EQ(conflicts.load(), 0u);
+  EXPECT_EQ(pool.available(), kThreads * 2);
+}
+
+TEST(ConcurrentSlotPool, ConcurrentBatchChurnKeepsEverySlot) {
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kIterations = 5000;
+  constexpr std::size_t kBatch = 4;
+  auto pool = makePool(kThreads * kBatch);
+  EXPECT_TRUE(pool.createAll(req, ctx));
+
+  std::atomic<std::size_t> conflicts{0};
+  ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t t) {
+    std::vector<SlotHandle> handles(kBatch);
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      const std::size_t count = pool.tryAcquireCreated(handles);
+      for (std::size_t j = 0; j < count; ++j) {
+        int expected = -1;
+        DummyPayload *payload = pool.get(handles[j]);
+        if (!payload->owner.compare_exchange_strong(expected,
+                                                    static_cast<int>(t))) {
+          conflicts.fetch_add(1);
+        }
+        payload->owner.store(-1);
+      }
+      if (pool.release(std::span<const SlotHandle>(handles.data(), count)) !=
+          count) {
+        conflicts.fetch_add(1);
+      }
+    }
+  });
+  EXPECT_EQ(conflicts.load(), 0u);
+  EXPECT_EQ(pool.available(), kThreads * kBatch);
+}
+
+TEST(ConcurrentSlotPool, ConcurrentGrowByAndCreateGivesDisjointSlots) {
+  constexpr std::size_t kThreads = 4;
+  constexpr std::size_t kPerThread = 64;
+  Pool pool;
+  pool.setBlockSize(8);
+
+  std::vector<std::vector<std::size_t>> acquired(kThreads);
+  ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t t) {
+    for (std::size_t i = 0; i < kPerThread; ++i) {
+      auto handle = pool.tryAcquireCreated();
+      while (!handle.isValid()) {
+        pool.growByAndCreate(1, req, ctx);
+        handle = pool.tryAcquireCreated();
+      }
+      acquired[t].push_back(handle.index);
+    }
+  });
+
+  std::set<std::size_t> unique{};
+  for (const auto &indices : acquired) {
+    unique.insert(indices.begin(), indices.end());
+  }
+  EXPECT_EQ(unique.size(), kThreads * kPerThread);
+  EXPECT_EQ(pool.size(), pool.available() + kThreads * kPerThread);
+}
+
+} // namespace
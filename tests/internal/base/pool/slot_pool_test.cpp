@@ -1,6 +1,7 @@
 #include "orteaf/internal/base/pool/slot_pool.h"
 
 #include <gtest/gtest.h>
+#include <span>
 #include <system_error>
 #include <vector>
 
@@ -329,6 +330,115 @@ TEST(SlotPool, InitializeAndCreateCreatesAllSlots) {
   EXPECT_TRUE(pool.tryAcquireCreated().isValid());
 }
 
+TEST(SlotPool, MixedFreelistServesEachKindDirectly) {
+  auto pool = makePool(4);
+  DummyTraits::Request req{};
+  DummyTraits::Context ctx{};
+
+  // 上位の 2 スロットだけ作成済みにする（部分的な createRange と同じ形）
+  EXPECT_TRUE(pool.createRange(2, 4, req, ctx));
+  EXPECT_EQ(pool.available(), 4u);
+
+  auto uncreated_a = pool.tryReserveUncreated();
+  auto uncreated_b = pool.tryReserveUncreated();
+  ASSERT_TRUE(uncreated_a.isValid());
+  ASSERT_TRUE(uncreated_b.isValid());
+  EXPECT_FALSE(pool.isCreated(uncreated_a));
+  EXPECT_FALSE(pool.isCreated(uncreated_b));
+  EXPECT_FALSE(pool.tryReserveUncreated().isValid());
+
+  auto created_a = pool.tryAcquireCreated();
+  auto created_b = pool.tryAcquireCreated();
+  ASSERT_TRUE(created_a.isValid());
+  ASSERT_TRUE(created_b.isValid());
+  EXPECT_TRUE(pool.isCreated(created_a));
+  EXPECT_TRUE(pool.isCreated(created_b));
+  EXPECT_FALSE(pool.tryAcquireCreated().isValid());
+  EXPECT_EQ(pool.available(), 0u);
+}
+
+TEST(SlotPool, ReleaseFilesSlotByCreatedState) {
+  auto pool = makePool(2);
+  DummyTraits::Request req{};
+  DummyTraits::Context ctx{};
+
+  auto created = pool.reserveUncreated();
+  EXPECT_TRUE(pool.emplace(created, req, ctx));
+  auto uncreated = pool.reserveUncreated();
+
+  EXPECT_TRUE(pool.release(created));
+  EXPECT_TRUE(pool.release(uncreated));
+
+  auto reacquired = pool.tryAcquireCreated();
+  ASSERT_TRUE(reacquired.isValid());
+  EXPECT_EQ(reacquired.index, created.index);
+  auto rereserved = pool.tryReserveUncreated();
+  ASSERT_TRUE(rereserved.isValid());
+  EXPECT_EQ(rereserved.index, uncreated.index);
+}
+
+TEST(SlotPool, CreateRangeMovesFreeSlotsToCreatedList) {
+  auto pool = makePool(3);
+  DummyTraits::Request req{};
+  DummyTraits::Context ctx{};
+
+  // 中央のスロットだけ作成し、先頭・末尾は未作成のまま残す
+  EXPECT_TRUE(pool.createRange(1, 2, req, ctx));
+  EXPECT_EQ(pool.available(), 3u);
+
+  auto created = pool.tryAcquireCreated();
+  ASSERT_TRUE(created.isValid());
+  EXPECT_EQ(created.index, 1u);
+  EXPECT_FALSE(pool.tryAcquireCreated().isValid());
+
+  auto first = pool.tryReserveUncreated();
+  auto last = pool.tryReserveUncreated();
+  ASSERT_TRUE(first.isValid());
+  ASSERT_TRUE(last.isValid());
+  EXPECT_EQ(first.index, 0u);
+  EXPECT_EQ(last.index, 2u);
+}
+
+TEST(SlotPool, DestroyedSlotReturnsToUncreatedList) {
+  auto pool = makePool(3);
+  DummyTraits::Request req{};
+  DummyTraits::Context ctx{};
+
+  EXPECT_TRUE(pool.createAll(req, ctx));
+  EXPECT_FALSE(pool.tryReserveUncreated().isValid());
+
+  auto slot = pool.acquireCreated();
+  EXPECT_TRUE(pool.destroy(slot, req, ctx));
+  EXPECT_TRUE(pool.release(slot));
+
+  auto rereserved = pool.tryReserveUncreated();
+  ASSERT_TRUE(rereserved.isValid());
+  EXPECT_EQ(rereserved.index, slot.index);
+  EXPECT_EQ(pool.available(), 2u);
+}
+
+TEST(SlotPool, BatchAcquireTakesOnlyCreatedSlots) {
+  auto pool = makePool(4);
+  DummyTraits::Request req{};
+  DummyTraits::Context ctx{};
+  EXPECT_TRUE(pool.createRange(0, 3, req, ctx));
+
+  std::vector<SlotHandle> handles(5);
+  EXPECT_EQ(pool.tryAcquireCreated(handles), 3u);
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_TRUE(pool.isCreated(handles[i]));
+  }
+  EXPECT_FALSE(pool.tryAcquireCreated().isValid());
+  EXPECT_EQ(pool.available(), 1u);
+
+  // 無効・重複した handle は数えずにスキップする
+  handles[3] = handles[0];
+  handles[4] = SlotHandle::invalid();
+  EXPECT_EQ(pool.release(std::span<const SlotHandle>(handles)), 3u);
+  EXPECT_EQ(pool.available(), 4u);
+  EXPECT_FALSE(pool.isValid(handles[0]));
+}
+
 TEST(SlotPool, ReserveDoesNotChangeSize) {
   Pool pool;
   pool.reserve(4);
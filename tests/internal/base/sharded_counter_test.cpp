@@ -0,0 +1,165 @@
+#include "orteaf/internal/base/sharded_counter.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+
+#include "tests/internal/testing/benchmark.h"
+
+namespace orteaf::internal::base {
+namespace {
+
+TEST(ShardedCounters, RoundsShardCountUpToPowerOfTwo) {
+    EXPECT_EQ(ShardedCounters<1>(3).shardCount(), 4u);
+    EXPECT_EQ(ShardedCounters<1>(1).shardCount(), 1u);
+    EXPECT_GE(defaultShardCount(), 1u);
+    EXPECT_LE(defaultShardCount(), kMaxCounterShards);
+}
+
+TEST(ShardedCounters, SlotsAreIndependent) {
+    ShardedCounters<2> counters(4);
+    counters.add(0, 5);
+    counters.add(1, 7);
+    counters.sub(0, 2);
+    EXPECT_EQ(counters.load(0), 3u);
+    EXPECT_EQ(counters.load(1), 7u);
+
+    counters.reset();
+    EXPECT_EQ(counters.load(0), 0u);
+    EXPECT_EQ(counters.load(1), 0u);
+}
+
+TEST(ShardedCounters, SumIsExactAcrossThreads) {
+    ShardedCounters<2> counters(4);
+    constexpr std::size_t kThreads = 8;
+    constexpr std::size_t kOps = 10000;
+    tests::runConcurrently(kThreads, [&](std::size_t) {
+        for (std::size_t i = 0; i < kOps; ++i) {
+            counters.add(0, 1);
+            counters.add(1, 3);
+        }
+    });
+    EXPECT_EQ(counters.load(0), kThreads * kOps);
+    EXPECT_EQ(counters.load(1), 3 * kThreads * kOps);
+}
+
+TEST(ShardedCounters, SubtractionOnAnotherShardStillSumsExactly) {
+    ShardedCounters<1> counters(8);
+    tests::runConcurrently(1, [&](std::size_t) { counters.add(0, 100); });
+    tests::runConcurrently(1, [&](std::size_t) { counters.sub(0, 40); });
+    EXPECT_EQ(counters.load(0), 60u);
+}
+
+TEST(ShardedCounters, MovedFromInstanceIgnoresUpdates) {
+    ShardedCounters<1> source(2);
+    source.add(0, 9);
+    ShardedCounters<1> target(std::move(source));
+    EXPECT_EQ(target.load(0), 9u);
+
+    EXPECT_EQ(source.add(0, 1), 0u);
+    EXPECT_EQ(source.load(0), 0u);
+    EXPECT_EQ(target.load(0), 9u);
+}
+
+TEST(ShardedGauge, ValueIsExactBelowAndAboveBatch) {
+    ShardedGauge gauge(/*batch=*/100, /*shard_count=*/4);
+    gauge.add(30);
+    EXPECT_EQ(gauge.value(), 30u);
+    gauge.add(500);
+    EXPECT_EQ(gauge.value(), 530u);
+    gauge.sub(530);
+    EXPECT_EQ(gauge.value(), 0u);
+}
+
+TEST(ShardedGauge, PeakIsMonotonicAndRaisedOnRead) {
+    ShardedGauge gauge(/*batch=*/1 << 20, /*shard_count=*/4);
+    gauge.add(1024);
+    gauge.add(2048);
+    // 未 fold でも読み出し時に現在値まで引き上げられる
+    EXPECT_EQ(gauge.peak(), 3072u);
+    gauge.sub(1024);
+    EXPECT_EQ(gauge.peak(), 3072u);
+    gauge.sub(2048);
+    EXPECT_EQ(gauge.value(), 0u);
+    EXPECT_EQ(gauge.peak(), 3072u);
+}
+
+TEST(ShardedGauge, FoldRecordsPeakWithoutReads) {
+    ShardedGauge gauge(/*batch=*/64, /*shard_count=*/1);
+    gauge.add(1000);
+    gauge.sub(1000);
+    EXPECT_EQ(gauge.value(), 0u);
+    EXPECT_EQ(gauge.peak(), 1000u);
+}
+
+TEST(ShardedGauge, SubBatchPeakIsVisibleAfterRelease) {
+    ShardedGauge gauge(/*batch=*/1 << 20, /*shard_count=*/1);
+    gauge.add(4096);
+    gauge.add(1024);
+    gauge.sub(5120);
+    // fold も読み出しも挟まない batch 未満の山も add 時に記録される
+    EXPECT_EQ(gauge.value(), 0u);
+    EXPECT_EQ(gauge.peak(), 5120u);
+}
+
+TEST(ShardedGauge, ConcurrentPeakStaysWithinShardBatchBound) {
+    constexpr uint64_t kBatch = 256;
+    constexpr std::size_t kThreads = 4;
+    constexpr uint64_t kHeld = 4096;
+    ShardedGauge gauge(kBatch, kThreads);
+    std::atomic<std::size_t> holding{0};
+    tests::runConcurrently(kThreads, [&](std::size_t) {
+        for (int i = 0; i < 100; ++i) {
+            gauge.add(64);
+            gauge.sub(64);
+        }
+        // 全スレッドが同時に kHeld を保持する瞬間を作る
+        gauge.add(kHeld);
+        holding.fetch_add(1, std::memory_order_acq_rel);
+        while (holding.load(std::memory_order_acquire) != kThreads) {
+        }
+        gauge.sub(kHeld);
+    });
+    EXPECT_EQ(gauge.value(), 0u);
+    const uint64_t true_peak = kThreads * kHeld;
+    EXPECT_LE(gauge.peak(), true_peak + gauge.shardCount() * kBatch);
+    EXPECT_GE(gauge.peak() + gauge.shardCount() * kBatch, true_peak);
+}
+
+TEST(ShardedCountersBenchmark, ShardedVersusSingleAtomic) {
+    ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+    constexpr std::size_t kOps = 2'000'000;
+    const std::size_t threads = defaultShardCount();
+
+    struct alignas(64) Shared {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> bytes{0};
+    } shared;
+    const double atomic_seconds = tests::runConcurrently(threads, [&](std::size_t) {
+        for (std::size_t i = 0; i < kOps; ++i) {
+            shared.count.fetch_add(1, std::memory_order_relaxed);
+            shared.bytes.fetch_add(64, std::memory_order_relaxed);
+        }
+    });
+
+    ShardedCounters<1> counts;
+    ShardedGauge bytes;
+    const double sharded_seconds = tests::runConcurrently(threads, [&](std::size_t) {
+        for (std::size_t i = 0; i < kOps; ++i) {
+            counts.add(0, 1);
+            bytes.add(64);
+        }
+    });
+
+    EXPECT_EQ(counts.load(0), threads * kOps);
+    EXPECT_EQ(bytes.value(), shared.bytes.load());
+    std::cout << "[ShardedCounters] threads=" << threads << " shared atomic: "
+              << atomic_seconds << " s, sharded: " << sharded_seconds << " s\n";
+}
+
+}  // namespace
+}  // namespace orteaf::internal::base
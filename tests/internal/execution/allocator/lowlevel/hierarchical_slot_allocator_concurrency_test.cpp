@@ -0,0 +1,187 @@
+#include "orteaf/internal/execution/allocator/lowlevel/hierarchical_slot_allocator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/cpu/resource/cpu_heap_ops.h"
+#include "orteaf/internal/execution/execution.h"
+#include "tests/internal/testing/benchmark.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+using Execution = ::orteaf::internal::execution::Execution;
+using ::orteaf::internal::execution::cpu::resource::CpuHeapOps;
+using Allocator = policies::HierarchicalSlotAllocator<CpuHeapOps, Execution::Cpu>;
+using State = Allocator::Storage::State;
+
+constexpr std::size_t kPage = 4096;
+
+Allocator::Config makeConfig() {
+  Allocator::Config cfg{};
+  cfg.levels = {kPage * 16, kPage * 4, kPage};
+  cfg.initial_bytes = kPage * 16 * 4;
+  return cfg;
+}
+
+// 先頭と末尾にスレッド固有のタグを書き、解放前に他スレッドと重なっていないか確認する
+void stamp(const Allocator::BufferView &view, std::uint64_t tag) {
+  auto *bytes = static_cast<unsigned char *>(view.data());
+  std::memcpy(bytes, &tag, sizeof(tag));
+  std::memcpy(bytes + view.size() - sizeof(tag), &tag, sizeof(tag));
+}
+
+bool stampIntact(const Allocator::BufferView &view, std::uint64_t tag) {
+  const auto *bytes = static_cast<const unsigned char *>(view.data());
+  std::uint64_t head = 0;
+  std::uint64_t tail = 0;
+  std::memcpy(&head, bytes, sizeof(head));
+  std::memcpy(&tail, bytes + view.size() - sizeof(tail), sizeof(tail));
+  return head == tag && tail == tag;
+}
+
+TEST(HierarchicalSlotAllocatorConcurrency, StressKeepsSlotsDisjointAndMergesBack) {
+  constexpr std::size_t kThreads = 8;
+  constexpr std::size_t kIterations = 2000;
+  constexpr std::size_t kHeld = 6;
+
+  CpuHeapOps heap_ops;
+  Allocator allocator;
+  allocator.initialize(makeConfig(), &heap_ops);
+
+  std::atomic<std::size_t> corrupted{0};
+  ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t t) {
+    std::mt19937 rng(static_cast<std::uint32_t>(t + 1));
+    const std::size_t sizes[] = {kPage, kPage * 3, kPage * 16};
+    std::vector<Allocator::BufferView> held(kHeld);
+    std::vector<std::uint64_t> tags(kHeld);
+
+    for (std::size_t i = 0; i < kIterations; ++i) {
+      const std::size_t k = rng() % kHeld;
+      if (held[k]) {
+        if (!stampIntact(held[k], tags[k])) {
+          corrupted.fetch_add(1, std::memory_order_relaxed);
+        }
+        allocator.deallocate(held[k]);
+      }
+      held[k] = allocator.allocate(sizes[rng() % 3]);
+      tags[k] = (static_cast<std::uint64_t>(t) << 32) | i;
+      stamp(held[k], tags[k]);
+    }
+    for (std::size_t k = 0; k < kHeld; ++k) {
+      if (!stampIntact(held[k], tags[k])) {
+        corrupted.fetch_add(1, std::memory_order_relaxed);
+      }
+      allocator.deallocate(held[k]);
+    }
+  });
+
+  EXPECT_EQ(corrupted.load(), 0u);
+
+  // すべて解放した後は merge が最上位まで戻り、root はすべて Free になる
+  const auto snapshot = allocator.debugSnapshot();
+  for (const auto &slot : snapshot[0].slots) {
+    EXPECT_EQ(slot.state, State::Free);
+  }
+  EXPECT_EQ(snapshot[0].free_list.size(), snapshot[0].slots.size());
+  for (std::size_t layer = 1; layer < snapshot.size(); ++layer) {
+    for (const auto &slot : snapshot[layer].slots) {
+      EXPECT_NE(slot.state, State::InUse);
+    }
+  }
+}
+
+TEST(HierarchicalSlotAllocatorConcurrency, ConcurrentSplitOfSharedParentHandsOutDistinctSlots) {
+  constexpr std::size_t kThreads = 4;
+
+  CpuHeapOps heap_ops;
+  Allocator allocator;
+  allocator.initialize(makeConfig(), &heap_ops);
+
+  // 全スレッドが同じ root を split しようとする状況から同時に始める
+  std::vector<Allocator::BufferView> views(kThreads * 16);
+  ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t t) {
+    for (std::size_t i = 0; i < 16; ++i) {
+      views[t * 16 + i] = allocator.allocate(kPage);
+    }
+  });
+
+  std::vector<void *> addresses;
+  for (const auto &view : views) {
+    ASSERT_TRUE(view);
+    addresses.push_back(view.data());
+  }
+  std::sort(addresses.begin(), addresses.end());
+  EXPECT_EQ(std::adjacent_find(addresses.begin(), addresses.end()), addresses.end());
+
+  for (const auto &view : views) {
+    allocator.deallocate(view);
+  }
+}
+
+// 変更前と同じく allocate/deallocate 全体を 1 つの mutex で囲んだ場合との比較
+struct GlobalLockAllocator {
+  Allocator::BufferView allocate(std::size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    return allocator.allocate(size);
+  }
+  void deallocate(Allocator::BufferView view) {
+    std::lock_guard<std::mutex> lock(mutex);
+    allocator.deallocate(view);
+  }
+
+  Allocator allocator;
+  std::mutex mutex;
+};
+
+template <typename Target>
+double runChurn(Target &target, std::size_t threads, std::size_t iterations) {
+  constexpr std::size_t kHeld = 4;
+  return ::orteaf::tests::runConcurrently(threads, [&](std::size_t) {
+    std::vector<Allocator::BufferView> held(kHeld);
+    for (std::size_t i = 0; i < iterations; ++i) {
+      auto &slot = held[i % kHeld];
+      if (slot) {
+        target.deallocate(slot);
+      }
+      slot = target.allocate(kPage);
+    }
+    for (auto &slot : held) {
+      target.deallocate(slot);
+    }
+  });
+}
+
+TEST(HierarchicalSlotAllocatorBenchmark, ThroughputVersusGlobalLock) {
+  ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+  constexpr std::size_t kIterations = 50000;
+
+  for (std::size_t threads : {1u, 2u, 4u, 8u}) {
+    CpuHeapOps heap_ops;
+    GlobalLockAllocator global;
+    global.allocator.initialize(makeConfig(), &heap_ops);
+    Allocator fine;
+    fine.initialize(makeConfig(), &heap_ops);
+
+    const double global_seconds = runChurn(global, threads, kIterations);
+    const double fine_seconds = runChurn(fine, threads, kIterations);
+    const double ops = static_cast<double>(threads * kIterations * 2);
+
+    std::cout << "[hierarchical-slot] threads=" << threads
+              << " global_lock=" << (ops / global_seconds / 1e6) << " Mops/s"
+              << " fine_grained=" << (ops / fine_seconds / 1e6) << " Mops/s"
+              << " speedup=" << (global_seconds / fine_seconds) << "x" << std::endl;
+    EXPECT_GT(fine_seconds, 0.0);
+  }
+}
+
+} // namespace
@@ -632,6 +632,58 @@ TEST_F(HierarchicalSlotAllocatorTest,
   EXPECT_EQ(plan.end_slot, 2u); // 末尾側で連続Freeの run(=1) を選ぶ
 }
 
+TEST_F(HierarchicalSlotAllocatorTest, DeallocateDenseUnmapsContiguousRunOnce) {
+  // 連続した 2 スロットを Dense として解放すると unmap は 1 回にまとまる
+  void *base = reinterpret_cast<void *>(0x1D000);
+  EXPECT_CALL(impl_, reserve(512)).WillOnce(Return(HeapRegion{base, 512}));
+  EXPECT_CALL(impl_, map(_)).WillRepeatedly(::testing::Invoke(MapReturn));
+  EXPECT_CALL(impl_, unmap(HeapRegion{base, 512}, 512)).Times(1);
+
+  Allocator::Config cfg{};
+  cfg.levels = {256};
+  cfg.initial_bytes = 512;
+  allocator_.initialize(cfg, &heap_ops_);
+
+  auto upper = allocator_.allocate(256);
+  auto lower = allocator_.allocate(256);
+  ASSERT_EQ(lower.data(), base);
+  ASSERT_EQ(static_cast<char *>(upper.data()), static_cast<char *>(base) + 256);
+
+  allocator_.deallocateDense(lower, 512);
+
+  auto snapshot = allocator_.debugSnapshot();
+  ASSERT_EQ(snapshot[0].slots.size(), 2u);
+  EXPECT_EQ(snapshot[0].slots[0].state, Allocator::Storage::State::Free);
+  EXPECT_EQ(snapshot[0].slots[1].state, Allocator::Storage::State::Free);
+}
+
+TEST_F(HierarchicalSlotAllocatorTest, DeallocateDenseSplitsUnmapAtGaps) {
+  // 途中のスロットが見つからない場合は、その前後で unmap を分ける
+  void *base = reinterpret_cast<void *>(0x1E000);
+  char *bytes = static_cast<char *>(base);
+  EXPECT_CALL(impl_, reserve(768)).WillOnce(Return(HeapRegion{base, 768}));
+  EXPECT_CALL(impl_, map(_)).WillRepeatedly(::testing::Invoke(MapReturn));
+
+  Allocator::Config cfg{};
+  cfg.levels = {256};
+  cfg.initial_bytes = 768;
+  allocator_.initialize(cfg, &heap_ops_);
+
+  auto third = allocator_.allocate(256);
+  auto second = allocator_.allocate(256);
+  auto first = allocator_.allocate(256);
+  ASSERT_EQ(first.data(), base);
+  ASSERT_EQ(static_cast<char *>(second.data()), bytes + 256);
+  ASSERT_EQ(static_cast<char *>(third.data()), bytes + 512);
+
+  allocator_.deallocate(second);
+  ::testing::Mock::VerifyAndClearExpectations(&impl_);
+  EXPECT_CALL(impl_, unmap(HeapRegion{bytes, 256}, 256)).Times(1);
+  EXPECT_CALL(impl_, unmap(HeapRegion{bytes + 512, 256}, 256)).Times(1);
+
+  allocator_.deallocateDense(first, 768);
+}
+
 // //
 // ============================================================================
 // // Dense allocation tests
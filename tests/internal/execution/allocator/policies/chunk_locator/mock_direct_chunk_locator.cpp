@@ -1,5 +1,7 @@
 #include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
 
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -219,4 +221,89 @@ TEST(DirectChunkLocator, IsAliveReflectsState) {
   MockCpuResource::reset();
 }
 
+TEST(DirectChunkLocator, ReleasableTrackingFollowsCounters) {
+  Policy policy;
+  MockCpuResource resource;
+  Policy::Config cfg{};
+
+  NiceMock<MockCpuResourceImpl> impl;
+  MockCpuResource::set(&impl);
+  cfg.resource = &resource;
+  policy.initialize(cfg);
+
+  ON_CALL(impl, allocate(_, _))
+      .WillByDefault(Return(CpuView{reinterpret_cast<void *>(0x80), 0, 64}));
+
+  // More than 64 chunks so the bitmap spans several words.
+  constexpr std::size_t kChunks = 130;
+  std::vector<BufferViewHandle> handles;
+  for (std::size_t i = 0; i < kChunks; ++i) {
+    auto block = policy.addChunk(64, 1);
+    policy.incrementUsed(block.handle);
+    handles.push_back(block.handle);
+  }
+  EXPECT_EQ(policy.releasableCount(), 0u);
+  EXPECT_FALSE(policy.findReleasable().isValid());
+
+  policy.decrementUsed(handles[100]);
+  EXPECT_EQ(policy.findReleasable(), handles[100]);
+
+  policy.incrementPending(handles[100]);
+  EXPECT_FALSE(policy.findReleasable().isValid());
+  policy.decrementPending(handles[100]);
+
+  policy.decrementUsed(handles[3]);
+  policy.decrementUsed(handles[129]);
+  EXPECT_EQ(policy.releasableCount(), 3u);
+
+  ::orteaf::internal::base::HeapVector<BufferViewHandle> collected;
+  EXPECT_EQ(policy.collectReleasable(collected), 3u);
+  ASSERT_EQ(collected.size(), 3u);
+  EXPECT_EQ(collected[0], handles[3]);
+  EXPECT_EQ(collected[1], handles[100]);
+  EXPECT_EQ(collected[2], handles[129]);
+
+  EXPECT_TRUE(policy.releaseChunk(handles[100]));
+  EXPECT_EQ(policy.releasableCount(), 2u);
+  EXPECT_EQ(policy.findReleasable(), handles[3]);
+
+  MockCpuResource::reset();
+}
+
+TEST(DirectChunkLocator, TracksIdleEpochsAndChunkBytes) {
+  Policy policy;
+  MockCpuResource resource;
+  Policy::Config cfg{};
+
+  NiceMock<MockCpuResourceImpl> impl;
+  MockCpuResource::set(&impl);
+  cfg.resource = &resource;
+  policy.initialize(cfg);
+  ON_CALL(impl, allocate(_, _))
+      .WillByDefault(Return(CpuView{reinterpret_cast<void *>(0x80), 0, 64}));
+
+  auto a = policy.addChunk(64, 1);
+  auto b = policy.addChunk(128, 1);
+  EXPECT_EQ(policy.chunkBytes(), 192u);
+
+  policy.incrementUsed(b.handle);
+  EXPECT_EQ(policy.advanceIdleEpoch(), 1u);
+  EXPECT_EQ(policy.advanceIdleEpoch(), 2u);
+  EXPECT_EQ(policy.idleEpochsOf(a.handle), 2u);
+  // 使用中のチャンクはアイドルではない
+  EXPECT_EQ(policy.idleEpochsOf(b.handle), 0u);
+
+  // アイドルになった時点のエポックから数え直す
+  policy.decrementUsed(b.handle);
+  policy.advanceIdleEpoch();
+  EXPECT_EQ(policy.idleEpochsOf(a.handle), 3u);
+  EXPECT_EQ(policy.idleEpochsOf(b.handle), 1u);
+
+  EXPECT_TRUE(policy.releaseChunk(a.handle));
+  EXPECT_EQ(policy.chunkBytes(), 128u);
+  EXPECT_EQ(policy.idleEpochsOf(a.handle), 0u);
+
+  MockCpuResource::reset();
+}
+
 } // namespace
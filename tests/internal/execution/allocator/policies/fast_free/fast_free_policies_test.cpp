@@ -0,0 +1,59 @@
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace diag_error = ::orteaf::internal::diagnostics::error;
+using Resource =
+    ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+namespace {
+
+constexpr std::size_t kKiB = 1024;
+
+TEST(FastFreePolicy, RoundsUpToPowerOfTwo) {
+  policies::FastFreePolicy policy;
+  EXPECT_EQ(policy.get_block_size(64, 65 * kKiB), 128 * kKiB);
+  EXPECT_EQ(policy.size_class_index(128 * kKiB, 64), 11u);
+  EXPECT_EQ(policy.size_class_block_size(11, 64), 128 * kKiB);
+  EXPECT_EQ(policy.size_class_count(64, 128 * kKiB), 12u);
+}
+
+TEST(GeometricFastFreePolicy, UsesConfiguredSubClasses) {
+  policies::GeometricFastFreePolicy policy;
+  policies::GeometricFastFreePolicy::Config<Resource> config{};
+  config.sub_classes_per_octave = 8;
+  policy.initialize(config);
+
+  EXPECT_EQ(policy.sub_classes_per_octave(), 8u);
+  EXPECT_EQ(policy.get_block_size(64, 65 * kKiB), 72 * kKiB);
+  const std::size_t index = policy.size_class_index(72 * kKiB, 64);
+  EXPECT_EQ(policy.size_class_block_size(index, 64), 72 * kKiB);
+  EXPECT_EQ(policy.size_class_count(64, 128), 9u);
+}
+
+TEST(GeometricFastFreePolicy, SmallMinBlockSizeClampsSubClasses) {
+  policies::GeometricFastFreePolicy policy;
+  policies::GeometricFastFreePolicy::Config<Resource> config{};
+  config.sub_classes_per_octave = 8;
+  policy.initialize(config);
+
+  // With min_block_size=4 the first octave cannot be split eight ways.
+  EXPECT_EQ(policy.get_block_size(4, 5), 5u);
+  EXPECT_EQ(policy.size_class_count(4, 8), 5u);
+}
+
+TEST(GeometricFastFreePolicy, RejectsNonPowerOfTwoSubClasses) {
+  policies::GeometricFastFreePolicy policy;
+  policies::GeometricFastFreePolicy::Config<Resource> config{};
+  config.sub_classes_per_octave = 3;
+  ::orteaf::tests::ExpectError(diag_error::OrteafErrc::InvalidParameter,
+                               [&] { policy.initialize(config); });
+}
+
+} // namespace
@@ -0,0 +1,129 @@
+#include "orteaf/internal/execution/allocator/policies/freelist/host_bump_freelist_policy.h"
+
+#include <cstddef>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+using ::orteaf::internal::base::BufferViewHandle;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+namespace {
+
+using Policy = policies::HostBumpFreelistPolicy<HostPoolResource>;
+using BufferBlock = Policy::BufferBlock;
+using BufferView = HostPoolResource::BufferView;
+
+alignas(64) unsigned char g_chunk_a[1024];
+alignas(64) unsigned char g_chunk_b[1024];
+
+Policy makePolicy(HostPoolResource &resource, std::size_t classes = 2) {
+  Policy policy;
+  Policy::Config cfg{};
+  cfg.resource = &resource;
+  policy.initialize(cfg, classes);
+  return policy;
+}
+
+TEST(HostBumpFreelistPolicy, InitializeFailsWithNullResource) {
+  Policy policy;
+  Policy::Config cfg{};
+  ::orteaf::tests::ExpectError(
+      ::orteaf::internal::diagnostics::error::OrteafErrc::NullPointer,
+      [&] { policy.initialize(cfg); });
+}
+
+TEST(HostBumpFreelistPolicy, ExpandDoesNotMaterializeBlocks) {
+  HostPoolResource resource;
+  Policy policy = makePolicy(resource);
+
+  BufferBlock chunk{BufferViewHandle{7}, BufferView{g_chunk_a, 0, 1024}};
+  policy.expand(0, chunk, 1024, 64);
+
+  EXPECT_FALSE(policy.empty(0));
+  EXPECT_TRUE(policy.empty(1));
+  EXPECT_EQ(policy.get_total_free_blocks(), 16u);
+}
+
+TEST(HostBumpFreelistPolicy, PopCarvesSequentialBlocksFromFrontier) {
+  HostPoolResource resource;
+  Policy policy = makePolicy(resource);
+
+  BufferBlock chunk{BufferViewHandle{7}, BufferView{g_chunk_a, 0, 256}};
+  policy.expand(0, chunk, 256, 64);
+
+  for (std::size_t i = 0; i < 4; ++i) {
+    BufferBlock block = policy.pop(0);
+    ASSERT_TRUE(block.valid());
+    EXPECT_EQ(block.handle, BufferViewHandle{7});
+    EXPECT_EQ(block.view.offset(), i * 64);
+    EXPECT_EQ(block.view.size(), 64u);
+  }
+  EXPECT_FALSE(policy.pop(0).valid());
+  EXPECT_TRUE(policy.empty(0));
+}
+
+TEST(HostBumpFreelistPolicy, RecycledBlocksArePreferredOverFrontier) {
+  HostPoolResource resource;
+  Policy policy = makePolicy(resource);
+
+  BufferBlock chunk{BufferViewHandle{7}, BufferView{g_chunk_a, 0, 256}};
+  policy.expand(0, chunk, 256, 64);
+  BufferBlock first = policy.pop(0);
+  policy.push(0, first);
+
+  BufferBlock again = policy.pop(0);
+  EXPECT_EQ(again.view.offset(), first.view.offset());
+  EXPECT_EQ(policy.pop(0).view.offset(), 64u);
+}
+
+TEST(HostBumpFreelistPolicy, IgnoresTrailingBytesSmallerThanBlock) {
+  HostPoolResource resource;
+  Policy policy = makePolicy(resource);
+
+  BufferBlock chunk{BufferViewHandle{7}, BufferView{g_chunk_a, 0, 200}};
+  policy.expand(0, chunk, 200, 64);
+  EXPECT_EQ(policy.get_total_free_blocks(), 3u);
+
+  std::set<std::size_t> offsets;
+  while (true) {
+    BufferBlock block = policy.pop(0);
+    if (!block.valid()) {
+      break;
+    }
+    EXPECT_LE(block.view.offset() + block.view.size(), 200u);
+    offsets.insert(block.view.offset());
+  }
+  EXPECT_EQ(offsets.size(), 3u);
+}
+
+TEST(HostBumpFreelistPolicy, RemoveBlocksInChunkDropsFrontierAndRecycled) {
+  HostPoolResource resource;
+  Policy policy = makePolicy(resource);
+
+  BufferBlock chunk_a{BufferViewHandle{1}, BufferView{g_chunk_a, 0, 256}};
+  BufferBlock chunk_b{BufferViewHandle{2}, BufferView{g_chunk_b, 0, 256}};
+  policy.expand(0, chunk_a, 256, 64);
+  BufferBlock from_a = policy.pop(0);
+  policy.expand(0, chunk_b, 256, 64);
+  policy.push(0, from_a);
+  EXPECT_EQ(policy.get_total_free_blocks(), 8u);
+
+  policy.removeBlocksInChunk(chunk_a.handle);
+  EXPECT_EQ(policy.get_total_free_blocks(), 4u);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(policy.pop(0).handle, BufferViewHandle{2});
+  }
+  EXPECT_TRUE(policy.empty(0));
+
+  policy.expand(1, chunk_a, 256, 128);
+  const BufferViewHandle released[] = {BufferViewHandle{1}};
+  policy.removeBlocksInChunks(released);
+  EXPECT_EQ(policy.get_total_free_blocks(), 0u);
+}
+
+} // namespace
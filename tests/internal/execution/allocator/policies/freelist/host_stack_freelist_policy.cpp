@@ -1,5 +1,7 @@
 #include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
 
+#include <cstdint>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -149,4 +151,33 @@ TEST(HostStackFreelistPolicy, RemoveBlocksInChunkRemovesContainedBlocks) {
   MockCpuResource::reset();
 }
 
+TEST(HostStackFreelistPolicy, RemoveBlocksInChunksFiltersAllStacksOnce) {
+  Policy policy;
+  MockCpuResource resource;
+  Policy::Config cfg{};
+  cfg.resource = &resource;
+  policy.initialize(cfg, 3);
+
+  auto block = [](std::uint32_t handle, std::uintptr_t addr) {
+    return BufferBlock{BufferViewHandle{handle},
+                       CpuBufferView{reinterpret_cast<void *>(addr), 0, 32}};
+  };
+  policy.push(0, block(1, 0x100));
+  policy.push(0, block(2, 0x200));
+  policy.push(1, block(3, 0x300));
+  policy.push(1, block(1, 0x140));
+  policy.push(2, block(4, 0x400));
+  policy.push(2, block(2, 0x240));
+  policy.push(2, block(5, 0x500));
+
+  const BufferViewHandle released[] = {BufferViewHandle{1},
+                                       BufferViewHandle{2},
+                                       BufferViewHandle{5}};
+  policy.removeBlocksInChunks(released);
+  EXPECT_EQ(policy.get_total_free_blocks(), 2u);
+  EXPECT_TRUE(policy.empty(0));
+  EXPECT_EQ(policy.pop(1).handle, BufferViewHandle{3});
+  EXPECT_EQ(policy.pop(2).handle, BufferViewHandle{4});
+}
+
 } // namespace
@@ -0,0 +1,341 @@
+#include "orteaf/internal/execution/allocator/policies/large_alloc/caching_large_alloc.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+using Policy = policies::CachingLargeAllocPolicy<HostPoolResource>;
+using Block = HostPoolResource::BufferBlock;
+
+constexpr std::size_t kKiB = 1024;
+
+Policy makePolicy(HostPoolResource &resource,
+                  std::size_t max_cached_bytes = 1024 * kKiB) {
+  Policy policy;
+  Policy::Config cfg{};
+  cfg.resource = &resource;
+  cfg.max_cached_bytes = max_cached_bytes;
+  cfg.granularity = 4 * kKiB;
+  policy.initialize(cfg);
+  return policy;
+}
+
+std::uintptr_t addressOf(const Block &block) {
+  return reinterpret_cast<std::uintptr_t>(block.view.raw()) +
+         block.view.offset();
+}
+
+TEST(CachingLargeAlloc, ReusesFreedBlockWithoutTouchingResource) {
+  HostPoolResource::resetCounters();
+  HostPoolResource resource;
+  auto policy = makePolicy(resource);
+
+  Block first = policy.allocate(100 * kKiB, 0);
+  ASSERT_TRUE(first.valid());
+  EXPECT_TRUE(policy.isLargeAlloc(first.handle));
+  EXPECT_TRUE(policy.isAlive(first.handle));
+  const auto address = addressOf(first);
+  policy.deallocate(first.handle, 100 * kKiB, 0);
+  EXPECT_FALSE(policy.isAlive(first.handle));
+  EXPECT_EQ(policy.cachedBytes(), 100 * kKiB);
+
+  Block second = policy.allocate(98 * kKiB, 0);
+  EXPECT_EQ(addressOf(second), address);
+  EXPECT_EQ(second.view.size(), 98 * kKiB);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 1u);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 0u);
+  EXPECT_EQ(policy.cacheHits(), 1u);
+  EXPECT_EQ(policy.cacheMisses(), 1u);
+  EXPECT_EQ(policy.size(), 1u);
+
+  policy.deallocate(second.handle, 98 * kKiB, 0);
+  EXPECT_EQ(policy.releaseCached(), 100 * kKiB);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 1u);
+  EXPECT_EQ(policy.reservedBytes(), 0u);
+}
+
+TEST(CachingLargeAlloc, BestFitSplitsLargerBlocks) {
+  HostPoolResource::resetCounters();
+  HostPoolResource resource;
+  auto policy = makePolicy(resource);
+
+  Block small = policy.allocate(32 * kKiB, 0);
+  Block big = policy.allocate(64 * kKiB, 0);
+  policy.deallocate(small.handle, 32 * kKiB, 0);
+  policy.deallocate(big.handle, 64 * kKiB, 0);
+
+  // 32KiB のブロックがちょうど収まるので 64KiB は分割しない
+  Block fit = policy.allocate(30 * kKiB, 0);
+  EXPECT_EQ(addressOf(fit), addressOf(small));
+
+  // 64KiB を 16KiB + 48KiB に分割し、残りも続けて使える
+  Block head = policy.allocate(16 * kKiB, 0);
+  Block tail = policy.allocate(48 * kKiB, 0);
+  EXPECT_EQ(addressOf(head), addressOf(big));
+  EXPECT_EQ(addressOf(tail), addressOf(big) + 16 * kKiB);
+  EXPECT_EQ(policy.cachedBytes(), 0u);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 2u);
+
+  policy.deallocate(fit.handle, 30 * kKiB, 0);
+  policy.deallocate(head.handle, 16 * kKiB, 0);
+  policy.deallocate(tail.handle, 48 * kKiB, 0);
+  EXPECT_EQ(policy.releaseCached(), 96 * kKiB);
+}
+
+TEST(CachingLargeAlloc, CoalescesNeighborsBackIntoWholeSegment) {
+  HostPoolResource::resetCounters();
+  HostPoolResource resource;
+  auto policy = makePolicy(resource);
+
+  Block whole = policy.allocate(48 * kKiB, 0);
+  policy.deallocate(whole.handle, 48 * kKiB, 0);
+  Block a = policy.allocate(16 * kKiB, 0);
+  Block b = policy.allocate(16 * kKiB, 0);
+  Block c = policy.allocate(16 * kKiB, 0);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 1u);
+
+  // 分割されたままのセグメントは返せない
+  policy.deallocate(b.handle, 16 * kKiB, 0);
+  policy.deallocate(a.handle, 16 * kKiB, 0);
+  EXPECT_EQ(policy.releaseCached(), 0u);
+  EXPECT_EQ(policy.cachedBytes(), 32 * kKiB);
+
+  policy.deallocate(c.handle, 16 * kKiB, 0);
+  EXPECT_EQ(policy.cachedBytes(), 48 * kKiB);
+  Block again = policy.allocate(48 * kKiB, 0);
+  EXPECT_EQ(addressOf(again), addressOf(whole));
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 1u);
+
+  policy.deallocate(again.handle, 48 * kKiB, 0);
+  EXPECT_EQ(policy.releaseCached(), 48 * kKiB);
+}
+
+TEST(CachingLargeAlloc, ReleasesOldestIdleSegmentsOverCap) {
+  HostPoolResource::resetCounters();
+  HostPoolResource resource;
+  auto policy = makePolicy(resource, 40 * kKiB);
+
+  std::vector<Block> blocks;
+  for (int i = 0; i < 3; ++i) {
+    blocks.push_back(policy.allocate(16 * kKiB, 0));
+  }
+  for (auto &block : blocks) {
+    policy.deallocate(block.handle, 16 * kKiB, 0);
+  }
+  EXPECT_EQ(policy.cachedBytes(), 32 * kKiB);
+  EXPECT_EQ(policy.reservedBytes(), 32 * kKiB);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 1u);
+
+  // 最初に解放したセグメントが返されている
+  Block reused = policy.allocate(16 * kKiB, 0);
+  EXPECT_NE(addressOf(reused), addressOf(blocks[0]));
+  policy.deallocate(reused.handle, 16 * kKiB, 0);
+  policy.releaseCached();
+}
+
+TEST(CachingLargeAlloc, ZeroCapReturnsEveryBlockImmediately) {
+  HostPoolResource::resetCounters();
+  HostPoolResource resource;
+  auto policy = makePolicy(resource, 0);
+
+  for (int i = 0; i < 3; ++i) {
+    Block block = policy.allocate(20 * kKiB, 0);
+    policy.deallocate(block.handle, 20 * kKiB, 0);
+  }
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 3u);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 3u);
+  EXPECT_EQ(policy.cachedBytes(), 0u);
+}
+
+TEST(CachingLargeAlloc, HonorsAlignmentAboveGranularity) {
+  HostPoolResource::resetCounters();
+  HostPoolResource resource;
+  auto policy = makePolicy(resource);
+
+  Block plain = policy.allocate(64 * kKiB, 0);
+  policy.deallocate(plain.handle, 64 * kKiB, 0);
+
+  constexpr std::size_t kAlign = 64 * kKiB;
+  Block aligned = policy.allocate(32 * kKiB, kAlign);
+  EXPECT_EQ(addressOf(aligned) % kAlign, 0u);
+  // 4KiB 境界のセグメントは 64KiB 境界を保証できないので新しく確保する
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 2u);
+
+  policy.deallocate(aligned.handle, 32 * kKiB, kAlign);
+  Block again = policy.allocate(16 * kKiB, kAlign);
+  EXPECT_EQ(addressOf(again), addressOf(aligned));
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 2u);
+
+  policy.deallocate(again.handle, 16 * kKiB, kAlign);
+  policy.releaseCached();
+}
+
+TEST(CachingLargeAlloc, RejectsNonPowerOfTwoGranularity) {
+  HostPoolResource resource;
+  Policy policy;
+  Policy::Config cfg{};
+  cfg.resource = &resource;
+  cfg.granularity = 3000;
+  ::orteaf::tests::ExpectError(OrteafErrc::InvalidParameter,
+                               [&] { policy.initialize(cfg); });
+}
+
+TEST(CachingLargeAlloc, SegregatePoolServesRepeatedLargeAllocationsFromCache) {
+  using Pool = pool_ns::SegregatePool<
+      HostPoolResource, policies::FastFreePolicy,
+      policies::LockingThreadingPolicy, Policy,
+      policies::DirectChunkLocatorPolicy<HostPoolResource>,
+      policies::DeferredReusePolicy<HostPoolResource>,
+      policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+  HostPoolResource::resetCounters();
+  Pool pool;
+  Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 4096;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+
+  Pool::LaunchParams params{};
+  for (int step = 0; step < 8; ++step) {
+    auto activation = pool.allocate(256 * kKiB, 0, params);
+    auto gradient = pool.allocate(128 * kKiB, 0, params);
+    ASSERT_TRUE(activation.valid());
+    ASSERT_TRUE(gradient.valid());
+    pool.deallocate(std::move(gradient), 128 * kKiB, 0, params);
+    pool.deallocate(std::move(activation), 256 * kKiB, 0, params);
+  }
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 2u);
+  EXPECT_EQ(pool.large_alloc_policy().cacheHits(), 14u);
+
+  pool.releaseChunk(params);
+  EXPECT_EQ(pool.large_alloc_policy().reservedBytes(), 0u);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 2u);
+}
+
+// 未返却の合計が上限を超える確保で std::bad_alloc を投げるリソース
+// （CpuResource と同じく失敗を空のビューでは返さない）。
+struct LimitedHostResource : HostPoolResource {
+  static BufferView allocate(std::size_t size, std::size_t alignment) {
+    if (outstanding() + size > limit()) {
+      throw std::bad_alloc();
+    }
+    outstanding() += size;
+    return HostPoolResource::allocate(size, alignment);
+  }
+
+  static void deallocate(BufferView view, std::size_t size,
+                         std::size_t alignment) {
+    outstanding() -= size;
+    HostPoolResource::deallocate(view, size, alignment);
+  }
+
+  static std::size_t &outstanding() {
+    static std::size_t bytes = 0;
+    return bytes;
+  }
+  static std::size_t &limit() {
+    static std::size_t bytes = 0;
+    return bytes;
+  }
+};
+
+TEST(CachingLargeAlloc, ReleasesCacheAndRetriesWhenResourceThrows) {
+  HostPoolResource::resetCounters();
+  LimitedHostResource::outstanding() = 0;
+  LimitedHostResource::limit() = 200 * kKiB;
+  LimitedHostResource resource;
+  policies::CachingLargeAllocPolicy<LimitedHostResource> policy;
+  policies::CachingLargeAllocPolicy<LimitedHostResource>::Config cfg{};
+  cfg.resource = &resource;
+  cfg.max_cached_bytes = 1024 * kKiB;
+  cfg.granularity = 4 * kKiB;
+  policy.initialize(cfg);
+
+  Block first = policy.allocate(120 * kKiB, 0);
+  ASSERT_TRUE(first.valid());
+  policy.deallocate(first.handle, 120 * kKiB, 0);
+  EXPECT_EQ(policy.cachedBytes(), 120 * kKiB);
+
+  // キャッシュでは賄えず、新規確保は上限超過で例外になる。
+  // キャッシュを返してから再試行するので成功する。
+  Block second = policy.allocate(160 * kKiB, 0);
+  ASSERT_TRUE(second.valid());
+  EXPECT_EQ(policy.cachedBytes(), 0u);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 1u);
+
+  policy.deallocate(second.handle, 160 * kKiB, 0);
+  EXPECT_EQ(policy.releaseCached(), 160 * kKiB);
+  EXPECT_EQ(LimitedHostResource::outstanding(), 0u);
+}
+
+TEST(CachingLargeAlloc, PropagatesResourceFailureWhenNothingIsCached) {
+  HostPoolResource::resetCounters();
+  LimitedHostResource::outstanding() = 0;
+  LimitedHostResource::limit() = 64 * kKiB;
+  LimitedHostResource resource;
+  policies::CachingLargeAllocPolicy<LimitedHostResource> policy;
+  policies::CachingLargeAllocPolicy<LimitedHostResource>::Config cfg{};
+  cfg.resource = &resource;
+  cfg.granularity = 4 * kKiB;
+  policy.initialize(cfg);
+
+  EXPECT_THROW(policy.allocate(128 * kKiB, 0), std::bad_alloc);
+}
+
+TEST(CachingLargeAlloc, CapSkipsSegmentsThatAreStillInUse) {
+  HostPoolResource::resetCounters();
+  HostPoolResource resource;
+  auto policy = makePolicy(resource, 96 * kKiB);
+
+  // 1 つ目のセグメントの前半だけを使用中にする。
+  Block whole = policy.allocate(96 * kKiB, 0);
+  ASSERT_TRUE(whole.valid());
+  policy.deallocate(whole.handle, 96 * kKiB, 0);
+  Block head = policy.allocate(48 * kKiB, 0);
+  ASSERT_TRUE(head.valid());
+  EXPECT_EQ(policy.cachedBytes(), 48 * kKiB);
+
+  // 残りに収まらないので 2 つ目のセグメントを確保する。
+  Block other = policy.allocate(64 * kKiB, 0);
+  ASSERT_TRUE(other.valid());
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 2u);
+
+  // 上限超過時は全体が空いた 2 つ目だけが返され、使用中ブロックを含む
+  // 1 つ目の空き部分は残る。
+  policy.deallocate(other.handle, 64 * kKiB, 0);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 1u);
+  EXPECT_EQ(policy.cachedBytes(), 48 * kKiB);
+
+  policy.deallocate(head.handle, 48 * kKiB, 0);
+  EXPECT_EQ(policy.cachedBytes(), 96 * kKiB);
+  EXPECT_EQ(policy.releaseCached(), 96 * kKiB);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 2u);
+}
+
+} // namespace
@@ -151,4 +151,39 @@ TEST(DeferredReusePolicy, FlushPendingWaitsUntilComplete) {
   EXPECT_FALSE(policy.hasPending());
 }
 
+TEST(DeferredReusePolicy, RemoveBlocksInChunksFiltersOnceAndKeepsOrder) {
+  FakeResource resource;
+  Policy policy;
+  Policy::Config cfg{};
+  cfg.resource = &resource;
+  policy.initialize(cfg);
+
+  resource.next_result.store(true);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{1}), 0);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{2}), 1);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{3}), 2);
+  EXPECT_EQ(policy.processPending(), 3u);
+
+  resource.next_result.store(false);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{1}), 3);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{4}), 4);
+
+  const BufferViewHandle released[] = {BufferViewHandle{1},
+                                       BufferViewHandle{3}};
+  policy.removeBlocksInChunks(released);
+  EXPECT_EQ(policy.getPendingReuseCount(), 2u);
+
+  CpuBufferBlock out_block{};
+  std::size_t out_index = 0;
+  ASSERT_TRUE(policy.getReadyItem(out_index, out_block));
+  EXPECT_EQ(out_block.handle, BufferViewHandle{2});
+  EXPECT_EQ(out_index, 1u);
+  EXPECT_FALSE(policy.getReadyItem(out_index, out_block));
+
+  resource.next_result.store(true);
+  EXPECT_EQ(policy.processPending(), 1u);
+  ASSERT_TRUE(policy.getReadyItem(out_index, out_block));
+  EXPECT_EQ(out_block.handle, BufferViewHandle{4});
+}
+
 } // namespace
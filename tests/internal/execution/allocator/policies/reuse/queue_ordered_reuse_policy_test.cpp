@@ -0,0 +1,283 @@
+#include "orteaf/internal/execution/allocator/policies/reuse/queue_ordered_reuse_policy.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/base/handle.h"
+#include "orteaf/internal/execution/allocator/buffer.h"
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
+#include "orteaf/internal/execution/execution.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace allocator = ::orteaf::internal::execution::allocator;
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+using Execution = ::orteaf::internal::execution::Execution;
+using BufferViewHandle = ::orteaf::internal::base::BufferViewHandle;
+using CpuView = ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+namespace {
+using CpuBufferBlock = allocator::ExecutionBufferBlock<Execution::Cpu>;
+
+// Token submitted on `queue` as the `sequence`-th piece of work.
+// A negative queue means the token cannot be ordered.
+struct FakeToken {
+  int queue{0};
+  std::size_t sequence{0};
+};
+
+struct FakeBuffer {
+  using BufferView = CpuView;
+  using BufferViewHandle = ::orteaf::internal::base::BufferViewHandle;
+  using ReuseToken = FakeToken;
+
+  BufferViewHandle handle{};
+  BufferView view{};
+  ReuseToken reuse_token{};
+};
+
+// Each queue completes its work in order up to a watermark.
+struct FakeResource {
+  using BufferResource = FakeBuffer;
+  using ReuseToken = FakeToken;
+
+  static constexpr Execution execution_type_static() noexcept {
+    return Execution::Cpu;
+  }
+
+  std::optional<std::uint64_t> reuseQueueKey(const ReuseToken &token) const {
+    if (token.queue < 0) {
+      return std::nullopt;
+    }
+    return static_cast<std::uint64_t>(token.queue);
+  }
+
+  bool isCompleted(ReuseToken &token) {
+    ++calls;
+    if (token.queue < 0) {
+      return unordered_completed;
+    }
+    return token.sequence < completed_through[token.queue];
+  }
+
+  std::size_t completed_through[4]{};
+  bool unordered_completed{false};
+  std::size_t calls{0};
+};
+
+using Policy = policies::QueueOrderedReusePolicy<FakeResource>;
+
+FakeBuffer makeBlock(BufferViewHandle id, int queue, std::size_t sequence) {
+  return FakeBuffer{id, CpuView{reinterpret_cast<void *>(0x10), 0, 64},
+                    FakeToken{queue, sequence}};
+}
+
+void initializePolicy(Policy &policy, FakeResource &resource) {
+  Policy::Config cfg{};
+  cfg.resource = &resource;
+  policy.initialize(cfg);
+}
+
+TEST(QueueOrderedReusePolicy, InitializeFailsWithNullResource) {
+  Policy policy;
+  Policy::Config cfg{};
+
+  orteaf::tests::ExpectError(
+      ::orteaf::internal::diagnostics::error::OrteafErrc::NullPointer,
+      [&] { policy.initialize(cfg); });
+}
+
+TEST(QueueOrderedReusePolicy, ReleasesWholeQueueWhenNewestCompleted) {
+  FakeResource resource;
+  Policy policy;
+  initializePolicy(policy, resource);
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    policy.scheduleForReuse(
+        makeBlock(BufferViewHandle{static_cast<std::uint32_t>(i)}, 0, i), i);
+  }
+  EXPECT_EQ(policy.orderedQueueCount(), 1u);
+
+  resource.completed_through[0] = 100;
+  EXPECT_EQ(policy.processPending(), 100u);
+  EXPECT_EQ(resource.calls, 1u);
+  EXPECT_FALSE(policy.hasPending());
+  EXPECT_EQ(policy.getPendingReuseCount(), 100u);
+}
+
+TEST(QueueOrderedReusePolicy, ReleasesCompletedPrefixWithLogarithmicChecks) {
+  FakeResource resource;
+  Policy policy;
+  initializePolicy(policy, resource);
+
+  for (std::size_t i = 0; i < 100; ++i) {
+    policy.scheduleForReuse(
+        makeBlock(BufferViewHandle{static_cast<std::uint32_t>(i)}, 0, i), i);
+  }
+
+  resource.completed_through[0] = 37;
+  EXPECT_EQ(policy.processPending(), 37u);
+  EXPECT_LE(resource.calls, 2u + 7u);
+  EXPECT_EQ(policy.getPendingReuseCount(), 100u);
+
+  std::vector<std::size_t> indices;
+  CpuBufferBlock out_block{};
+  std::size_t out_index = 0;
+  while (policy.getReadyItem(out_index, out_block)) {
+    indices.push_back(out_index);
+  }
+  ASSERT_EQ(indices.size(), 37u);
+  for (std::size_t index : indices) {
+    EXPECT_LT(index, 37u);
+  }
+  EXPECT_EQ(policy.getPendingReuseCount(), 63u);
+}
+
+TEST(QueueOrderedReusePolicy, IncompleteHeadStopsAfterTwoChecks) {
+  FakeResource resource;
+  Policy policy;
+  initializePolicy(policy, resource);
+
+  for (std::size_t i = 0; i < 1000; ++i) {
+    policy.scheduleForReuse(
+        makeBlock(BufferViewHandle{static_cast<std::uint32_t>(i)}, 0, i), 0);
+  }
+
+  EXPECT_EQ(policy.processPending(), 0u);
+  EXPECT_EQ(resource.calls, 2u);
+  EXPECT_EQ(policy.getPendingReuseCount(), 1000u);
+}
+
+TEST(QueueOrderedReusePolicy, QueuesCompleteIndependently) {
+  FakeResource resource;
+  Policy policy;
+  initializePolicy(policy, resource);
+
+  for (std::size_t i = 0; i < 4; ++i) {
+    policy.scheduleForReuse(
+        makeBlock(BufferViewHandle{static_cast<std::uint32_t>(i)}, 0, i), 0);
+    policy.scheduleForReuse(
+        makeBlock(BufferViewHandle{static_cast<std::uint32_t>(10 + i)}, 1, i),
+        1);
+  }
+  EXPECT_EQ(policy.orderedQueueCount(), 2u);
+
+  resource.completed_through[1] = 4;
+  EXPECT_EQ(policy.processPending(), 4u);
+
+  CpuBufferBlock out_block{};
+  std::size_t out_index = 0;
+  while (policy.getReadyItem(out_index, out_block)) {
+    EXPECT_EQ(out_index, 1u);
+  }
+  EXPECT_EQ(policy.getPendingReuseCount(), 4u);
+
+  resource.completed_through[0] = 4;
+  EXPECT_EQ(policy.processPending(), 4u);
+  EXPECT_FALSE(policy.hasPending());
+}
+
+TEST(QueueOrderedReusePolicy, UnorderedTokensAreCheckedIndividually) {
+  FakeResource resource;
+  Policy policy;
+  initializePolicy(policy, resource);
+
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{1}, -1, 0), 2);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{2}, -1, 0), 2);
+  EXPECT_EQ(policy.orderedQueueCount(), 0u);
+
+  EXPECT_EQ(policy.processPending(), 0u);
+  EXPECT_EQ(resource.calls, 2u);
+
+  resource.unordered_completed = true;
+  EXPECT_EQ(policy.processPending(), 2u);
+  EXPECT_FALSE(policy.hasPending());
+}
+
+TEST(QueueOrderedReusePolicy, RemoveBlocksInChunksFiltersEveryQueue) {
+  FakeResource resource;
+  Policy policy;
+  initializePolicy(policy, resource);
+
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{1}, 0, 0), 0);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{2}, 0, 1), 1);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{3}, 0, 2), 2);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{1}, 1, 0), 3);
+  policy.scheduleForReuse(makeBlock(BufferViewHandle{3}, -1, 0), 4);
+  resource.completed_through[0] = 1;
+  EXPECT_EQ(policy.processPending(), 1u);
+
+  const BufferViewHandle released[] = {BufferViewHandle{1},
+                                       BufferViewHandle{3}};
+  policy.removeBlocksInChunks(released);
+  EXPECT_EQ(policy.getPendingReuseCount(), 1u);
+
+  CpuBufferBlock out_block{};
+  std::size_t out_index = 0;
+  EXPECT_FALSE(policy.getReadyItem(out_index, out_block));
+
+  resource.completed_through[0] = 3;
+  EXPECT_EQ(policy.processPending(), 1u);
+  ASSERT_TRUE(policy.getReadyItem(out_index, out_block));
+  EXPECT_EQ(out_block.handle, BufferViewHandle{2});
+  EXPECT_EQ(out_index, 1u);
+}
+
+TEST(QueueOrderedReusePolicy, ChecksStayBoundedWithThousandsInFlight) {
+  constexpr std::size_t kQueues = 4;
+  constexpr std::size_t kPerQueue = 1024;
+  FakeResource resource;
+  Policy policy;
+  initializePolicy(policy, resource);
+
+  for (std::size_t i = 0; i < kPerQueue; ++i) {
+    for (std::size_t q = 0; q < kQueues; ++q) {
+      policy.scheduleForReuse(
+          makeBlock(BufferViewHandle{static_cast<std::uint32_t>(
+                        q * kPerQueue + i)},
+                    static_cast<int>(q), i),
+          q);
+    }
+  }
+
+  // Advance completion in small steps; every pass stays O(log n) per queue.
+  std::size_t released = 0;
+  for (std::size_t done = 0; done <= kPerQueue; done += 16) {
+    for (std::size_t q = 0; q < kQueues; ++q) {
+      resource.completed_through[q] = done;
+    }
+    resource.calls = 0;
+    released += policy.processPending();
+    EXPECT_LE(resource.calls, kQueues * (2u + 10u));
+  }
+  EXPECT_EQ(released, kQueues * kPerQueue);
+  EXPECT_FALSE(policy.hasPending());
+}
+
+TEST(QueueOrderedReusePolicy, CpuResourceUsesSingleOrderedQueue) {
+  using CpuResource = ::orteaf::internal::execution::cpu::CpuResource;
+  using CpuPolicy = policies::QueueOrderedReusePolicy<CpuResource>;
+  static_assert(policies::OrderedReuseQueueResource<CpuResource>);
+
+  CpuResource resource;
+  CpuPolicy policy;
+  CpuPolicy::Config cfg{};
+  cfg.resource = &resource;
+  policy.initialize(cfg);
+
+  for (std::size_t i = 0; i < 8; ++i) {
+    policy.scheduleForReuse(
+        CpuResource::BufferResource{
+            BufferViewHandle{static_cast<std::uint32_t>(i)},
+            CpuView{reinterpret_cast<void *>(0x10), 0, 64}},
+        i);
+  }
+  EXPECT_EQ(policy.orderedQueueCount(), 1u);
+  EXPECT_EQ(policy.processPending(), 8u);
+  EXPECT_FALSE(policy.hasPending());
+}
+
+} // namespace
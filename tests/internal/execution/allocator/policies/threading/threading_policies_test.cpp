@@ -0,0 +1,64 @@
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+
+namespace {
+
+static_assert(policies::SizeClassShardedThreading<
+              policies::SizeClassShardedThreadingPolicy>);
+static_assert(!policies::SizeClassShardedThreading<
+              policies::LockingThreadingPolicy>);
+static_assert(!policies::SizeClassShardedThreading<
+              policies::NoLockThreadingPolicy>);
+
+TEST(SizeClassShardedThreadingPolicy, ConfiguresOneShardPerSizeClass) {
+  policies::SizeClassShardedThreadingPolicy policy;
+  EXPECT_EQ(policy.size_class_count(), 0u);
+  policy.configureSizeClasses(5);
+  EXPECT_EQ(policy.size_class_count(), 5u);
+}
+
+TEST(SizeClassShardedThreadingPolicy, DifferentSizeClassesDoNotBlock) {
+  policies::SizeClassShardedThreadingPolicy policy;
+  policy.configureSizeClasses(4);
+
+  policy.lockSizeClass(0);
+  std::atomic<bool> acquired{false};
+  std::thread other([&] {
+    policy.lockSizeClass(3);
+    policy.lockLarge();
+    acquired = true;
+    policy.unlockLarge();
+    policy.unlockSizeClass(3);
+  });
+  other.join();
+  policy.unlockSizeClass(0);
+
+  EXPECT_TRUE(acquired.load());
+}
+
+TEST(SizeClassShardedThreadingPolicy, ExclusiveLockWaitsForSizeClassHolders) {
+  policies::SizeClassShardedThreadingPolicy policy;
+  policy.configureSizeClasses(3);
+
+  policy.lockSizeClass(1);
+  std::atomic<bool> exclusive_acquired{false};
+  std::thread other([&] {
+    std::lock_guard<policies::SizeClassShardedThreadingPolicy> lock(policy);
+    exclusive_acquired = true;
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(exclusive_acquired.load());
+  policy.unlockSizeClass(1);
+  other.join();
+  EXPECT_TRUE(exclusive_acquired.load());
+}
+
+} // namespace
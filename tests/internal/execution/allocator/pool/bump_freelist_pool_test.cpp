@@ -0,0 +1,116 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_bump_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/benchmark.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+template <template <typename> class FreeList>
+using PoolWith = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, policies::NoLockThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    FreeList<HostPoolResource>>;
+using BumpPool = PoolWith<policies::HostBumpFreelistPolicy>;
+
+template <typename Pool>
+void initializePool(Pool &pool, std::size_t chunk_size) {
+  typename Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = chunk_size;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+TEST(BumpFreelistPool, CarvesChunkLazily) {
+  HostPoolResource::resetCounters();
+  BumpPool pool;
+  initializePool(pool, 4096);
+
+  BumpPool::LaunchParams params{};
+  std::vector<BumpPool::BufferResource> blocks;
+  for (int i = 0; i < 64; ++i) {
+    blocks.push_back(pool.allocate(64, 0, params));
+    ASSERT_TRUE(blocks.back().valid());
+    EXPECT_EQ(blocks.back().view.offset(), static_cast<std::size_t>(i) * 64);
+  }
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 1u);
+  EXPECT_EQ(pool.free_list_policy().get_total_free_blocks(), 0u);
+
+  for (auto &block : blocks) {
+    pool.deallocate(std::move(block), 64, 0, params);
+  }
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 1u);
+}
+
+TEST(BumpFreelistPool, ReleasesPartiallyCarvedChunk) {
+  HostPoolResource::resetCounters();
+  BumpPool pool;
+  initializePool(pool, 64 * 1024);
+
+  BumpPool::LaunchParams params{};
+  auto block = pool.allocate(128, 0, params);
+  ASSERT_TRUE(block.valid());
+  pool.deallocate(std::move(block), 128, 0, params);
+
+  EXPECT_EQ(pool.releaseIdleChunks(params), 1u);
+  EXPECT_EQ(pool.free_list_policy().get_total_free_blocks(), 0u);
+
+  auto again = pool.allocate(128, 0, params);
+  ASSERT_TRUE(again.valid());
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 2u);
+  pool.deallocate(std::move(again), 128, 0, params);
+}
+
+template <typename Pool> double firstAllocationMicros() {
+  Pool pool;
+  initializePool(pool, 16 * 1024 * 1024);
+  typename Pool::LaunchParams params{};
+  const auto start = std::chrono::steady_clock::now();
+  auto block = pool.allocate(64, 0, params);
+  const auto end = std::chrono::steady_clock::now();
+  pool.deallocate(std::move(block), 64, 0, params);
+  pool.releaseChunk(params);
+  return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+TEST(BumpFreelistPoolBenchmark, ExpansionLatencyVersusStack) {
+  ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+  HostPoolResource::resetCounters();
+
+  const double stack =
+      firstAllocationMicros<PoolWith<policies::HostStackFreelistPolicy>>();
+  const double bump = firstAllocationMicros<BumpPool>();
+  std::cout << "[expansion] 16 MiB chunk / 64 B blocks:"
+            << " HostStackFreelistPolicy=" << stack << " us"
+            << " HostBumpFreelistPolicy=" << bump << " us" << std::endl;
+  EXPECT_LT(bump, stack);
+}
+
+} // namespace
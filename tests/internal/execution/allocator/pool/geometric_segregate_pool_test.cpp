@@ -0,0 +1,106 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/thread_caching_pool.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+using GeometricPool = pool_ns::SegregatePool<
+    HostPoolResource, policies::GeometricFastFreePolicy,
+    policies::LockingThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+constexpr std::size_t kKiB = 1024;
+
+void initializePool(GeometricPool &pool, std::size_t sub_classes) {
+  GeometricPool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.fast_free.sub_classes_per_octave = sub_classes;
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 1024 * kKiB;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 1024 * kKiB;
+  pool.initialize(cfg);
+}
+
+TEST(GeometricSegregatePool, HandsOutSubPowerOfTwoBlocks) {
+  HostPoolResource::resetCounters();
+  GeometricPool pool;
+  initializePool(pool, 4);
+  EXPECT_EQ(pool.size_class_count(), 4u * 14u + 1u);
+
+  GeometricPool::LaunchParams params{};
+  auto block = pool.allocate(65 * kKiB, 0, params);
+  ASSERT_TRUE(block.valid());
+  EXPECT_EQ(block.view.size(), 80 * kKiB);
+  pool.deallocate(std::move(block), 65 * kKiB, 0, params);
+}
+
+TEST(GeometricSegregatePool, ReusesBlockWithinSameSubClass) {
+  HostPoolResource::resetCounters();
+  GeometricPool pool;
+  initializePool(pool, 4);
+
+  GeometricPool::LaunchParams params{};
+  auto first = pool.allocate(70 * kKiB, 0, params);
+  ASSERT_TRUE(first.valid());
+  void *first_ptr = first.view.data();
+  pool.deallocate(std::move(first), 70 * kKiB, 0, params);
+
+  auto same_class = pool.allocate(79 * kKiB, 0, params);
+  ASSERT_TRUE(same_class.valid());
+  EXPECT_EQ(same_class.view.data(), first_ptr);
+
+  auto next_class = pool.allocate(81 * kKiB, 0, params);
+  ASSERT_TRUE(next_class.valid());
+  EXPECT_EQ(next_class.view.size(), 96 * kKiB);
+
+  pool.deallocate(std::move(same_class), 79 * kKiB, 0, params);
+  pool.deallocate(std::move(next_class), 81 * kKiB, 0, params);
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(GeometricSegregatePool, ThreadCachingPoolRefillsGeometricClass) {
+  HostPoolResource::resetCounters();
+  GeometricPool pool;
+  initializePool(pool, 8);
+  {
+    pool_ns::ThreadCachingPool<GeometricPool> cache(pool, {8, 4});
+    GeometricPool::LaunchParams params{};
+    auto block = cache.allocate(65 * kKiB, 0, params);
+    ASSERT_TRUE(block.valid());
+    EXPECT_EQ(block.view.size(), 72 * kKiB);
+    EXPECT_EQ(cache.cachedBlockCount(), 3u);
+    cache.deallocate(std::move(block), 65 * kKiB, 0, params);
+  }
+  GeometricPool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+} // namespace
@@ -0,0 +1,258 @@
+#include "orteaf/internal/execution/allocator/pool/idle_chunk_trimmer.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+using namespace std::chrono_literals;
+
+template <typename ThreadingPolicy>
+using TrimPool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, ThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+using Pool = TrimPool<policies::LockingThreadingPolicy>;
+using ShardedPool = TrimPool<policies::SizeClassShardedThreadingPolicy>;
+using Trimmer = pool_ns::IdleChunkTrimmer<Pool>;
+
+constexpr std::size_t kChunk = 4096;
+
+template <typename P> void initializePool(P &pool) {
+  typename P::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = kChunk;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = kChunk;
+  pool.initialize(cfg);
+}
+
+// チャンクサイズのブロックを count 個確保して返し、count 個のアイドルチャンクを作る
+template <typename P> void makeIdleChunks(P &pool, std::size_t count) {
+  typename P::LaunchParams params{};
+  std::vector<typename P::BufferResource> blocks;
+  for (std::size_t i = 0; i < count; ++i) {
+    blocks.push_back(pool.allocate(kChunk, 0, params));
+  }
+  for (auto &block : blocks) {
+    pool.deallocate(std::move(block), kChunk, 0, params);
+  }
+}
+
+template <typename P> std::size_t chunkCount(P &pool) {
+  return pool.chunk_locator_policy().usage().chunk_count;
+}
+
+// 別スレッドでロックを保持している間に body を実行する
+// （所有スレッドからの try_lock は未定義動作なので同じスレッドでは試せない）
+void whileLockedElsewhere(const std::function<void()> &lock,
+                          const std::function<void()> &unlock,
+                          const std::function<void()> &body) {
+  std::atomic<bool> locked{false};
+  std::atomic<bool> done{false};
+  std::thread holder([&] {
+    lock();
+    locked.store(true);
+    while (!done.load()) {
+      std::this_thread::yield();
+    }
+    unlock();
+  });
+  while (!locked.load()) {
+    std::this_thread::yield();
+  }
+  body();
+  done.store(true);
+  holder.join();
+}
+
+Trimmer::Config makeConfig() {
+  Trimmer::Config cfg{};
+  cfg.interval = 10ms;
+  cfg.idle_threshold = 20ms;
+  return cfg;
+}
+
+TEST(IdleChunkTrimmer, ReleasesChunksOnceIdlePastThreshold) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  makeIdleChunks(pool, 3);
+  ASSERT_EQ(chunkCount(pool), 3u);
+
+  Trimmer trimmer(pool, makeConfig());
+  // 20ms / 10ms = 2 エポックに、途中でアイドルになった分の 1 エポックを足す
+  EXPECT_EQ(trimmer.minIdleEpochs(), 3u);
+
+  // 最初のパスで再利用待ちのブロックが戻り、そこからアイドル時間を数える
+  for (int pass = 0; pass < 3; ++pass) {
+    EXPECT_EQ(trimmer.runOnce().released_chunks, 0u);
+  }
+  EXPECT_EQ(chunkCount(pool), 3u);
+
+  const auto result = trimmer.runOnce();
+  EXPECT_TRUE(result.acquired);
+  EXPECT_EQ(result.released_chunks, 3u);
+  EXPECT_EQ(result.released_bytes, 3 * kChunk);
+  EXPECT_EQ(chunkCount(pool), 0u);
+  EXPECT_EQ(trimmer.releasedChunks(), 3u);
+  EXPECT_EQ(trimmer.passes(), 4u);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(IdleChunkTrimmer, ReusedChunkRestartsIdleClock) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  makeIdleChunks(pool, 1);
+
+  Trimmer trimmer(pool, makeConfig());
+  trimmer.runOnce();
+  trimmer.runOnce();
+  trimmer.runOnce();
+
+  // 解放直前に再利用されたチャンクはアイドル時間が 0 に戻る
+  makeIdleChunks(pool, 1);
+  EXPECT_EQ(trimmer.runOnce().released_chunks, 0u);
+  EXPECT_EQ(chunkCount(pool), 1u);
+
+  for (int pass = 0; pass < 3; ++pass) {
+    trimmer.runOnce();
+  }
+  EXPECT_EQ(chunkCount(pool), 0u);
+}
+
+TEST(IdleChunkTrimmer, TrimsDownToBudgetRegardlessOfIdleTime) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  Pool::LaunchParams params{};
+  auto busy = pool.allocate(kChunk, 0, params);
+  makeIdleChunks(pool, 3);
+  ASSERT_EQ(chunkCount(pool), 4u);
+
+  auto cfg = makeConfig();
+  cfg.idle_threshold = std::chrono::hours(1);
+  cfg.budget_bytes = 2 * kChunk;
+  Trimmer trimmer(pool, cfg);
+
+  const auto result = trimmer.runOnce();
+  EXPECT_EQ(result.released_chunks, 2u);
+  EXPECT_EQ(chunkCount(pool), 2u);
+  // 予算内に収まった後は何も解放しない
+  EXPECT_EQ(trimmer.runOnce().released_chunks, 0u);
+
+  pool.deallocate(std::move(busy), kChunk, 0, params);
+  pool.releaseChunk(params);
+}
+
+TEST(IdleChunkTrimmer, CapsChunksReleasedPerPass) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  makeIdleChunks(pool, 5);
+
+  auto cfg = makeConfig();
+  cfg.idle_threshold = 0ms;
+  cfg.max_chunks_per_pass = 2;
+  Trimmer trimmer(pool, cfg);
+
+  EXPECT_EQ(trimmer.runOnce().released_chunks, 2u);
+  EXPECT_EQ(trimmer.runOnce().released_chunks, 2u);
+  EXPECT_EQ(trimmer.runOnce().released_chunks, 1u);
+  EXPECT_EQ(chunkCount(pool), 0u);
+}
+
+TEST(IdleChunkTrimmer, SkipsPassWhenPoolLockIsHeld) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  makeIdleChunks(pool, 2);
+
+  auto cfg = makeConfig();
+  cfg.idle_threshold = 0ms;
+  Trimmer trimmer(pool, cfg);
+
+  pool_ns::ChunkTrimResult skipped{};
+  whileLockedElsewhere([&] { pool.threading_policy().lock(); },
+                       [&] { pool.threading_policy().unlock(); },
+                       [&] { skipped = trimmer.runOnce(); });
+  EXPECT_FALSE(skipped.acquired);
+  EXPECT_EQ(trimmer.contendedPasses(), 1u);
+  EXPECT_EQ(chunkCount(pool), 2u);
+
+  EXPECT_EQ(trimmer.runOnce().released_chunks, 2u);
+}
+
+TEST(IdleChunkTrimmer, ShardedPoolCanBeTrimmed) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool);
+  makeIdleChunks(pool, 2);
+
+  pool_ns::IdleChunkTrimmer<ShardedPool>::Config cfg{};
+  cfg.interval = 10ms;
+  cfg.idle_threshold = 0ms;
+  pool_ns::IdleChunkTrimmer<ShardedPool> trimmer(pool, cfg);
+
+  // サイズクラス 1 つのロックが取られているだけでも待たずに諦める
+  whileLockedElsewhere([&] { pool.threading_policy().lockSizeClass(3); },
+                       [&] { pool.threading_policy().unlockSizeClass(3); },
+                       [&] { EXPECT_FALSE(trimmer.runOnce().acquired); });
+
+  EXPECT_EQ(trimmer.runOnce().released_chunks, 2u);
+  EXPECT_EQ(chunkCount(pool), 0u);
+}
+
+TEST(IdleChunkTrimmer, BackgroundThreadReturnsIdleChunks) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  makeIdleChunks(pool, 2);
+
+  Trimmer::Config cfg{};
+  cfg.interval = 1ms;
+  cfg.idle_threshold = 2ms;
+  Trimmer trimmer(pool, cfg);
+  trimmer.start();
+  EXPECT_TRUE(trimmer.running());
+
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (trimmer.releasedChunks() < 2 &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(1ms);
+  }
+  trimmer.stop();
+  EXPECT_FALSE(trimmer.running());
+  EXPECT_EQ(trimmer.releasedChunks(), 2u);
+  EXPECT_EQ(chunkCount(pool), 0u);
+}
+
+} // namespace
@@ -0,0 +1,118 @@
+#include "orteaf/internal/execution/allocator/pool/numa_pool_set.h"
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_numa_resource.h"
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+namespace numa = ::orteaf::internal::execution::cpu::platform::wrapper;
+using ::orteaf::internal::execution::cpu::CpuNumaResource;
+
+using Pool = pool_ns::SegregatePool<
+    CpuNumaResource, policies::FastFreePolicy, policies::LockingThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<CpuNumaResource>,
+    policies::DirectChunkLocatorPolicy<CpuNumaResource>,
+    policies::DeferredReusePolicy<CpuNumaResource>,
+    policies::HostStackFreelistPolicy<CpuNumaResource>>;
+using PoolSet = pool_ns::NumaPoolSet<Pool>;
+
+PoolSet::Config makeConfig() {
+  PoolSet::Config cfg{};
+  cfg.chunk_size = 64 * 1024;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  return cfg;
+}
+
+TEST(NumaPoolSet, DefaultsToDetectedNodeCount) {
+  PoolSet set;
+  EXPECT_EQ(set.node_count(), numa::numaNodeCount());
+  EXPECT_LT(set.currentNode(), set.node_count());
+}
+
+TEST(NumaPoolSet, EachPoolOwnsItsNodeResource) {
+  PoolSet set(2);
+  set.initialize(makeConfig());
+  ASSERT_EQ(set.node_count(), 2u);
+  for (std::size_t index = 0; index < set.node_count(); ++index) {
+    const std::size_t expected = index < numa::numaNodeCount()
+                                     ? numa::numaNodeId(index)
+                                     : numa::numaNodeId(0);
+    EXPECT_EQ(set.nodeId(index), expected);
+    EXPECT_EQ(set.pool(index).resource()->node(), expected);
+  }
+}
+
+TEST(NumaPoolSet, PoolsAllocateIndependently) {
+  PoolSet set(2);
+  set.initialize(makeConfig());
+
+  Pool::LaunchParams params{};
+  auto first = set.pool(0).allocate(256, 0, params);
+  auto second = set.pool(1).allocate(256, 0, params);
+  ASSERT_TRUE(first.valid());
+  ASSERT_TRUE(second.valid());
+  EXPECT_NE(first.view.raw(), second.view.raw());
+  std::memset(first.view.data(), 1, 256);
+  std::memset(second.view.data(), 2, 256);
+
+  set.pool(0).deallocate(std::move(first), 256, 0, params);
+  set.pool(1).deallocate(std::move(second), 256, 0, params);
+  EXPECT_EQ(set.pool(0).releaseIdleChunks(params), 1u);
+  EXPECT_EQ(set.pool(1).releaseIdleChunks(params), 1u);
+}
+
+TEST(NumaPoolSet, LocalPoolServesCallingThread) {
+  PoolSet set;
+  set.initialize(makeConfig());
+
+  Pool &local = set.localPool();
+  Pool::LaunchParams params{};
+  auto block = local.allocate(1024, 0, params);
+  ASSERT_TRUE(block.valid());
+  local.deallocate(std::move(block), 1024, 0, params);
+}
+
+TEST(NumaPoolSet, BlocksAbovePageSizeUseAlignedChunks) {
+  // チャンクはブロックサイズ境界でアラインして確保されるため、
+  // ページサイズを超えるクラスでも NUMA リソースが確保できること
+  PoolSet set(1);
+  auto cfg = makeConfig();
+  cfg.chunk_size = 2 * 1024 * 1024;
+  cfg.max_block_size = 1024 * 1024;
+  set.initialize(cfg);
+
+  Pool::LaunchParams params{};
+  for (std::size_t size : {std::size_t{8192}, std::size_t{64 * 1024},
+                           std::size_t{1024 * 1024}}) {
+    auto block = set.pool(0).allocate(size, 0, params);
+    ASSERT_TRUE(block.valid()) << size;
+    std::memset(block.view.data(), 3, size);
+    set.pool(0).deallocate(std::move(block), size, 0, params);
+  }
+}
+
+TEST(NumaPoolSet, RejectsOutOfRangeNode) {
+  PoolSet set(1);
+  ::orteaf::tests::ExpectError(
+      ::orteaf::internal::diagnostics::error::OrteafErrc::OutOfRange,
+      [&] { set.pool(1); });
+}
+
+} // namespace
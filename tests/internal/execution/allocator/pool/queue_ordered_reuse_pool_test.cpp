@@ -0,0 +1,68 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/queue_ordered_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+using Pool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, policies::NoLockThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::QueueOrderedReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+void initializePool(Pool &pool) {
+  Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 4096;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+TEST(QueueOrderedReusePool, PendingBlockIsReusedAfterCompletion) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+
+  Pool::LaunchParams params{};
+  auto block = pool.allocate(4096, 0, params);
+  ASSERT_TRUE(block.valid());
+  void *data = block.view.data();
+
+  HostPoolResource::completed().store(false);
+  pool.deallocate(std::move(block), 4096, 0, params);
+  EXPECT_EQ(pool.reuse_policy().getPendingReuseCount(), 1u);
+
+  HostPoolResource::completed().store(true);
+  auto reused = pool.allocate(4096, 0, params);
+  ASSERT_TRUE(reused.valid());
+  EXPECT_EQ(reused.view.data(), data);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 1u);
+
+  pool.deallocate(std::move(reused), 4096, 0, params);
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+} // namespace
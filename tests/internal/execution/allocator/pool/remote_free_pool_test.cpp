@@ -0,0 +1,248 @@
+#include "orteaf/internal/execution/allocator/pool/remote_free_pool.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/policy_config.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+// Mutex-backed threading policy that counts how often the pool lock is taken.
+class CountingThreadingPolicy {
+public:
+  template <typename Resource>
+  using Config = policies::PolicyConfig<Resource>;
+
+  template <typename Resource> void initialize(const Config<Resource> &) {}
+
+  void lock() {
+    mutex_.lock();
+    lock_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void unlock() { mutex_.unlock(); }
+
+  std::size_t lockCount() const {
+    return lock_count_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::mutex mutex_;
+  std::atomic<std::size_t> lock_count_{0};
+};
+
+using Pool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, CountingThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+using RemotePool = pool_ns::RemoteFreePool<Pool>;
+
+void initializePool(Pool &pool) {
+  Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 64 * 1024;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+std::vector<Pool::BufferResource> allocateBlocks(RemotePool &remote,
+                                                 std::size_t count,
+                                                 std::size_t size) {
+  Pool::LaunchParams params{};
+  std::vector<Pool::BufferResource> blocks;
+  for (std::size_t i = 0; i < count; ++i) {
+    blocks.push_back(remote.allocate(size, 0, params));
+  }
+  return blocks;
+}
+
+void freeOnOtherThread(RemotePool &remote,
+                       std::vector<Pool::BufferResource> &blocks,
+                       std::size_t size) {
+  std::thread consumer([&] {
+    Pool::LaunchParams params{};
+    for (auto &block : blocks) {
+      remote.deallocate(std::move(block), size, 0, params);
+    }
+  });
+  consumer.join();
+}
+
+TEST(RemoteFreePool, RemoteFreesSkipPoolLockUntilOwnerAllocates) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  RemotePool remote(pool);
+
+  auto blocks = allocateBlocks(remote, 10, 256);
+  const std::size_t locks_before = pool.threading_policy().lockCount();
+  freeOnOtherThread(remote, blocks, 256);
+
+  EXPECT_EQ(pool.threading_policy().lockCount(), locks_before);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 10u);
+  EXPECT_EQ(pool.statsSnapshot().total_deallocations, 0u);
+
+  // 所有スレッドの次の確保で 1 回のバッチ返却として回収される
+  const std::size_t locks_before_drain = pool.threading_policy().lockCount();
+  Pool::LaunchParams params{};
+  auto block = remote.allocate(256, 0, params);
+  ASSERT_TRUE(block.valid());
+  EXPECT_EQ(pool.threading_policy().lockCount(), locks_before_drain + 2);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 0u);
+  EXPECT_EQ(pool.statsSnapshot().total_deallocations, 10u);
+  EXPECT_EQ(pool.statsSnapshot().pool_expansions, 1u);
+
+  remote.deallocate(std::move(block), 256, 0, params);
+}
+
+TEST(RemoteFreePool, OwnerDrainsOnlyTheRequestedSizeClass) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  RemotePool remote(pool);
+
+  auto small = allocateBlocks(remote, 4, 128);
+  auto wide = allocateBlocks(remote, 3, 1024);
+  freeOnOtherThread(remote, small, 128);
+  freeOnOtherThread(remote, wide, 1024);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 7u);
+
+  Pool::LaunchParams params{};
+  auto block = remote.allocate(100, 0, params);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 3u);
+
+  EXPECT_EQ(remote.drainRemoteFrees(params), 3u);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 0u);
+  remote.deallocate(std::move(block), 100, 0, params);
+  EXPECT_EQ(pool.statsSnapshot().active_allocations, 0u);
+}
+
+TEST(RemoteFreePool, OwnerAndLargeFreesGoStraightToPool) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  RemotePool remote(pool);
+  Pool::LaunchParams params{};
+
+  auto owned = remote.allocate(256, 0, params);
+  remote.deallocate(std::move(owned), 256, 0, params);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 0u);
+  EXPECT_EQ(pool.statsSnapshot().total_deallocations, 1u);
+
+  std::vector<Pool::BufferResource> large;
+  large.push_back(remote.allocate(8192, 0, params));
+  freeOnOtherThread(remote, large, 8192);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 0u);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 1u);
+}
+
+TEST(RemoteFreePool, FullQueueFallsBackToLockedFree) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  RemotePool remote(pool, RemotePool::Config{2});
+
+  auto blocks = allocateBlocks(remote, 5, 512);
+  freeOnOtherThread(remote, blocks, 512);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 2u);
+  EXPECT_EQ(remote.fallbackFrees(), 3u);
+  EXPECT_EQ(pool.statsSnapshot().total_deallocations, 3u);
+}
+
+TEST(RemoteFreePool, RebindingOwnerMovesDrainingToNewThread) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  RemotePool remote(pool);
+  EXPECT_TRUE(remote.isOwnerThread());
+
+  auto blocks = allocateBlocks(remote, 2, 256);
+  std::thread worker([&] {
+    remote.bindOwnerThread();
+    Pool::LaunchParams params{};
+    // 新しい所有スレッドの解放はプールへ直接返る
+    remote.deallocate(std::move(blocks[0]), 256, 0, params);
+  });
+  worker.join();
+  EXPECT_FALSE(remote.isOwnerThread());
+  EXPECT_EQ(pool.statsSnapshot().total_deallocations, 1u);
+
+  Pool::LaunchParams params{};
+  remote.deallocate(std::move(blocks[1]), 256, 0, params);
+  EXPECT_EQ(remote.pendingRemoteFrees(), 1u);
+}
+
+TEST(RemoteFreePool, ProducerConsumerPipelineReturnsEveryBlock) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  RemotePool remote(pool, RemotePool::Config{64});
+
+  constexpr int kConsumers = 3;
+  constexpr int kBlocksPerConsumer = 3000;
+  std::vector<std::vector<Pool::BufferResource>> handoff(kConsumers);
+  std::vector<std::mutex> handoff_mutex(kConsumers);
+
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < kConsumers; ++c) {
+    consumers.emplace_back([&, c] {
+      Pool::LaunchParams params{};
+      int freed = 0;
+      while (freed < kBlocksPerConsumer) {
+        std::vector<Pool::BufferResource> batch;
+        {
+          std::lock_guard<std::mutex> lock(handoff_mutex[c]);
+          batch.swap(handoff[c]);
+        }
+        for (auto &block : batch) {
+          remote.deallocate(std::move(block), 192, 0, params);
+          ++freed;
+        }
+        if (batch.empty()) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  Pool::LaunchParams params{};
+  for (int i = 0; i < kConsumers * kBlocksPerConsumer; ++i) {
+    auto block = remote.allocate(192, 0, params);
+    ASSERT_TRUE(block.valid());
+    std::lock_guard<std::mutex> lock(handoff_mutex[i % kConsumers]);
+    handoff[i % kConsumers].push_back(std::move(block));
+  }
+  for (auto &consumer : consumers) {
+    consumer.join();
+  }
+  remote.drainRemoteFrees(params);
+
+  const auto stats = pool.statsSnapshot();
+  EXPECT_EQ(stats.total_allocations, stats.total_deallocations);
+  EXPECT_EQ(stats.active_allocations, 0u);
+}
+
+} // namespace
@@ -0,0 +1,230 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/thread_caching_pool.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+template <typename FastFree, typename Threading>
+using AlignedPool = pool_ns::SegregatePool<
+    HostPoolResource, FastFree, Threading,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+using Pool =
+    AlignedPool<policies::FastFreePolicy, policies::LockingThreadingPolicy>;
+using ShardedPool = AlignedPool<policies::FastFreePolicy,
+                                policies::SizeClassShardedThreadingPolicy>;
+using GeometricPool = AlignedPool<policies::GeometricFastFreePolicy,
+                                  policies::LockingThreadingPolicy>;
+
+constexpr std::size_t kKiB = 1024;
+constexpr std::size_t kMiB = 1024 * kKiB;
+
+template <typename P>
+void initializePool(P &pool, std::size_t chunk_size,
+                    std::size_t max_block_size) {
+  typename P::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = chunk_size;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = max_block_size;
+  pool.initialize(cfg);
+}
+
+template <typename Block> std::uintptr_t addressOf(const Block &block) {
+  return reinterpret_cast<std::uintptr_t>(block.view.raw()) +
+         block.view.offset();
+}
+
+// min(block_size, alignment) の境界に乗っているか
+template <typename Block>
+::testing::AssertionResult isAligned(const Block &block,
+                                     std::size_t alignment) {
+  const std::size_t expected = std::min(block.view.size(), alignment);
+  if (addressOf(block) % expected == 0) {
+    return ::testing::AssertionSuccess();
+  }
+  return ::testing::AssertionFailure()
+         << "block of " << block.view.size() << " bytes at offset "
+         << block.view.offset() << " is not aligned to " << expected;
+}
+
+template <typename P>
+void expectAlignedAcrossSizes(P &pool, std::size_t alignment,
+                              std::size_t max_size) {
+  typename P::LaunchParams params{};
+  std::vector<std::pair<typename P::BufferResource, std::size_t>> blocks;
+  for (std::size_t size = 1; size <= max_size; size = size * 3 / 2 + 1) {
+    for (int i = 0; i < 5; ++i) {
+      auto block = pool.allocate(size, alignment, params);
+      ASSERT_TRUE(block.valid());
+      EXPECT_TRUE(isAligned(block, alignment)) << "size=" << size;
+      blocks.emplace_back(std::move(block), size);
+    }
+  }
+  for (auto &[block, size] : blocks) {
+    pool.deallocate(std::move(block), size, alignment, params);
+  }
+}
+
+TEST(SegregatePoolAlignment, CacheLineAlignmentForEveryClass) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 64 * kKiB, 16 * kKiB);
+  expectAlignedAcrossSizes(pool, 64, 16 * kKiB);
+}
+
+TEST(SegregatePoolAlignment, PageAlignmentWithoutPadding) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 64 * kKiB, 16 * kKiB);
+  expectAlignedAcrossSizes(pool, 4 * kKiB, 16 * kKiB);
+
+  // 4KiB 境界の要求でもブロックはサイズクラスのまま（パディングなし）
+  Pool::LaunchParams params{};
+  auto page = pool.allocate(4 * kKiB, 4 * kKiB, params);
+  auto small = pool.allocate(200, 4 * kKiB, params);
+  EXPECT_EQ(page.view.size(), 4 * kKiB);
+  EXPECT_EQ(small.view.size(), 256u);
+  EXPECT_EQ(addressOf(page) % (4 * kKiB), 0u);
+  EXPECT_EQ(addressOf(small) % 256, 0u);
+  pool.deallocate(std::move(page), 4 * kKiB, 4 * kKiB, params);
+  pool.deallocate(std::move(small), 200, 4 * kKiB, params);
+}
+
+TEST(SegregatePoolAlignment, HugePageAlignmentForSmallAndLargeBlocks) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 4 * kMiB, 2 * kMiB);
+  Pool::LaunchParams params{};
+
+  std::vector<Pool::BufferResource> huge;
+  for (int i = 0; i < 3; ++i) {
+    huge.push_back(pool.allocate(2 * kMiB, 2 * kMiB, params));
+    ASSERT_TRUE(huge.back().valid());
+    EXPECT_EQ(addressOf(huge.back()) % (2 * kMiB), 0u);
+  }
+  auto half = pool.allocate(kMiB, 2 * kMiB, params);
+  EXPECT_TRUE(isAligned(half, 2 * kMiB));
+
+  // max_block_size を超える要求は large ポリシーにアラインメントを渡す
+  auto large = pool.allocate(3 * kMiB, 2 * kMiB, params);
+  ASSERT_TRUE(large.valid());
+  EXPECT_EQ(addressOf(large) % (2 * kMiB), 0u);
+
+  for (auto &block : huge) {
+    pool.deallocate(std::move(block), 2 * kMiB, 2 * kMiB, params);
+  }
+  pool.deallocate(std::move(half), kMiB, 2 * kMiB, params);
+  pool.deallocate(std::move(large), 3 * kMiB, 2 * kMiB, params);
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(SegregatePoolAlignment, ShardedPoolHonorsAlignment) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool, 64 * kKiB, 16 * kKiB);
+  expectAlignedAcrossSizes(pool, 64, 16 * kKiB);
+  expectAlignedAcrossSizes(pool, 4 * kKiB, 16 * kKiB);
+}
+
+TEST(SegregatePoolAlignment, GeometricClassesRoundUpToAlignedClass) {
+  HostPoolResource::resetCounters();
+  GeometricPool pool;
+  GeometricPool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.fast_free.sub_classes_per_octave = 4;
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 64 * kKiB;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 3 * kKiB;
+  pool.initialize(cfg);
+  GeometricPool::LaunchParams params{};
+
+  // アラインメント指定がなければ 80B クラスを使う
+  auto plain = pool.allocate(80, 0, params);
+  EXPECT_EQ(plain.view.size(), 80u);
+  // 80B / 96B / 112B クラスは 64B 境界を保証できないので 128B まで繰り上げる
+  auto aligned = pool.allocate(80, 64, params);
+  EXPECT_EQ(aligned.view.size(), 128u);
+  EXPECT_EQ(addressOf(aligned) % 64, 0u);
+  EXPECT_EQ(pool.sizeClassIndexFor(80, 64), pool.sizeClassIndexFor(128));
+
+  // 同じ size / alignment で返すと繰り上げたクラスへ戻る
+  pool.deallocate(std::move(aligned), 80, 64, params);
+  auto again = pool.allocate(100, 64, params);
+  EXPECT_EQ(again.view.size(), 128u);
+  EXPECT_EQ(pool.statsSnapshot().pool_expansions, 2u);
+
+  // 最大クラス (3KiB) は 1KiB 境界までしか保証できないので large へ回す
+  EXPECT_EQ(pool.sizeClassIndexFor(3 * kKiB, 2 * kKiB),
+            pool.size_class_count());
+  auto large = pool.allocate(3 * kKiB, 2 * kKiB, params);
+  EXPECT_EQ(addressOf(large) % (2 * kKiB), 0u);
+  EXPECT_EQ(pool.statsSnapshot().large_allocations, 1u);
+
+  expectAlignedAcrossSizes(pool, 64, 3 * kKiB);
+
+  pool.deallocate(std::move(plain), 80, 0, params);
+  pool.deallocate(std::move(again), 100, 64, params);
+  pool.deallocate(std::move(large), 3 * kKiB, 2 * kKiB, params);
+}
+
+TEST(SegregatePoolAlignment, ThreadCachingPoolKeepsAlignedClasses) {
+  HostPoolResource::resetCounters();
+  GeometricPool pool;
+  GeometricPool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.fast_free.sub_classes_per_octave = 4;
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 64 * kKiB;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4 * kKiB;
+  pool.initialize(cfg);
+
+  pool_ns::ThreadCachingPool<GeometricPool> cache(pool);
+  GeometricPool::LaunchParams params{};
+  auto block = cache.allocate(80, 64, params);
+  EXPECT_EQ(block.view.size(), 128u);
+  EXPECT_EQ(addressOf(block) % 64, 0u);
+  cache.deallocate(std::move(block), 80, 64, params);
+  cache.flushAll(params);
+  EXPECT_EQ(pool.statsSnapshot().active_allocations, 0u);
+}
+
+} // namespace
@@ -0,0 +1,92 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/benchmark.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+template <typename ThreadingPolicy>
+using BenchPool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, ThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+constexpr std::size_t kThreads = 16;
+constexpr std::size_t kIterations = 200000;
+constexpr std::size_t kHeld = 4;
+
+// Each thread churns its own size class, so any contention comes from the
+// threading policy rather than from sharing blocks.
+template <typename ThreadingPolicy> double runChurn() {
+  using Pool = BenchPool<ThreadingPolicy>;
+  Pool pool;
+  typename Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 1024 * 1024;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = std::size_t{64} << (kThreads - 1);
+  pool.initialize(cfg);
+
+  const double seconds =
+      ::orteaf::tests::runConcurrently(kThreads, [&](std::size_t t) {
+        typename Pool::LaunchParams params{};
+        const std::size_t size = std::size_t{64} << t;
+        std::vector<typename Pool::BufferResource> held(kHeld);
+        for (std::size_t i = 0; i < kIterations; ++i) {
+          auto &slot = held[i % kHeld];
+          if (slot.valid()) {
+            pool.deallocate(std::move(slot), size, 0, params);
+          }
+          slot = pool.allocate(size, 0, params);
+        }
+        for (auto &slot : held) {
+          if (slot.valid()) {
+            pool.deallocate(std::move(slot), size, 0, params);
+          }
+        }
+      });
+
+  typename Pool::LaunchParams params{};
+  pool.releaseChunk(params);
+  return seconds;
+}
+
+TEST(SegregatePoolContentionBenchmark, ShardedVersusGlobalLock) {
+  ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+  HostPoolResource::resetCounters();
+
+  const double global = runChurn<policies::LockingThreadingPolicy>();
+  const double sharded = runChurn<policies::SizeClassShardedThreadingPolicy>();
+  const double ops = static_cast<double>(kThreads * kIterations * 2);
+
+  std::cout << "[contention] threads=" << kThreads
+            << " LockingThreadingPolicy=" << (global * 1e9 / ops) << " ns/op"
+            << " SizeClassShardedThreadingPolicy=" << (sharded * 1e9 / ops)
+            << " ns/op speedup=" << (global / sharded) << "x" << std::endl;
+  EXPECT_GT(sharded, 0.0);
+}
+
+} // namespace
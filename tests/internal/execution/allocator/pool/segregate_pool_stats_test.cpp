@@ -0,0 +1,172 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+template <typename ThreadingPolicy>
+using StatsPool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, ThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+using Pool = StatsPool<policies::NoLockThreadingPolicy>;
+using ShardedPool = StatsPool<policies::SizeClassShardedThreadingPolicy>;
+
+template <typename P> void initializePool(P &pool) {
+  typename P::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 4096;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+TEST(SegregatePoolStats, SnapshotReportsPerSizeClassCounters) {
+  if constexpr (!Pool::Stats::kSizeClassStatsEnabled) {
+    GTEST_SKIP() << "size class stats are disabled at this stats level";
+  }
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  Pool::LaunchParams params{};
+
+  std::vector<Pool::BufferResource> blocks;
+  for (int i = 0; i < 3; ++i) {
+    blocks.push_back(pool.allocate(100, 0, params));
+  }
+  auto small = pool.allocate(64, 0, params);
+  pool.deallocate(std::move(blocks.back()), 100, 0, params);
+  blocks.pop_back();
+
+  const auto snapshot = pool.statsSnapshot();
+  ASSERT_EQ(snapshot.size_classes.size(), pool.size_class_count());
+
+  const auto &c64 = snapshot.size_classes[pool.sizeClassIndexFor(64)];
+  EXPECT_EQ(c64.block_size, 64u);
+  EXPECT_EQ(c64.allocations, 1u);
+  EXPECT_EQ(c64.live_blocks, 1u);
+  EXPECT_EQ(c64.wasted_bytes, 0u);
+  EXPECT_EQ(c64.free_blocks, 4096u / 64u - 1u);
+
+  const auto &c128 = snapshot.size_classes[pool.sizeClassIndexFor(100)];
+  EXPECT_EQ(c128.block_size, 128u);
+  EXPECT_EQ(c128.allocations, 3u);
+  EXPECT_EQ(c128.deallocations, 1u);
+  EXPECT_EQ(c128.live_blocks, 2u);
+  EXPECT_EQ(c128.wasted_bytes, 2u * (128u - 100u));
+  // 解放したブロックは再利用待ちで、freelist にはまだ戻っていない
+  EXPECT_EQ(c128.free_blocks, 4096u / 128u - 3u);
+  EXPECT_EQ(snapshot.pending_reuse_blocks, 1u);
+
+  EXPECT_EQ(snapshot.chunk_count, 2u);
+  EXPECT_EQ(snapshot.chunk_bytes, 2u * 4096u);
+  EXPECT_EQ(snapshot.chunk_used_bytes, 64u + 2u * 128u);
+  EXPECT_DOUBLE_EQ(snapshot.chunkOccupancy(), (64.0 + 256.0) / 8192.0);
+  EXPECT_EQ(snapshot.totalWastedBytes(), 56u);
+
+  pool.deallocate(std::move(small), 64, 0, params);
+  for (auto &block : blocks) {
+    pool.deallocate(std::move(block), 100, 0, params);
+  }
+  pool.releaseChunk(params);
+
+  const auto drained = pool.statsSnapshot();
+  EXPECT_EQ(drained.chunk_count, 0u);
+  EXPECT_EQ(drained.totalWastedBytes(), 0u);
+  EXPECT_DOUBLE_EQ(drained.chunkOccupancy(), 0.0);
+}
+
+TEST(SegregatePoolStats, LargeAllocationsAreNotCountedPerSizeClass) {
+  if constexpr (!Pool::Stats::kSizeClassStatsEnabled) {
+    GTEST_SKIP() << "size class stats are disabled at this stats level";
+  }
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  Pool::LaunchParams params{};
+
+  auto large = pool.allocate(8192, 0, params);
+  ASSERT_TRUE(large.valid());
+
+  const auto snapshot = pool.statsSnapshot();
+  EXPECT_EQ(snapshot.large_allocations, 1u);
+  for (const auto &size_class : snapshot.size_classes) {
+    EXPECT_EQ(size_class.allocations, 0u);
+  }
+  EXPECT_EQ(snapshot.chunk_count, 0u);
+
+  pool.deallocate(std::move(large), 8192, 0, params);
+}
+
+TEST(SegregatePoolStats, ShardedPoolRecordsPerSizeClassCounters) {
+  if constexpr (!ShardedPool::Stats::kSizeClassStatsEnabled) {
+    GTEST_SKIP() << "size class stats are disabled at this stats level";
+  }
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool);
+  ShardedPool::LaunchParams params{};
+
+  auto a = pool.allocate(300, 0, params);
+  auto b = pool.allocate(1000, 0, params);
+  pool.deallocate(std::move(a), 300, 0, params);
+
+  const auto snapshot = pool.statsSnapshot();
+  const auto &c512 = snapshot.size_classes[pool.sizeClassIndexFor(300)];
+  EXPECT_EQ(c512.allocations, 1u);
+  EXPECT_EQ(c512.deallocations, 1u);
+  EXPECT_EQ(c512.wasted_bytes, 0u);
+  const auto &c1024 = snapshot.size_classes[pool.sizeClassIndexFor(1000)];
+  EXPECT_EQ(c1024.live_blocks, 1u);
+  EXPECT_EQ(c1024.wasted_bytes, 24u);
+
+  pool.deallocate(std::move(b), 1000, 0, params);
+  pool.releaseChunk(params);
+}
+
+TEST(SegregatePoolStats, SnapshotExportsJson) {
+  pool_ns::SegregatePoolStatsSnapshot snapshot{};
+  snapshot.total_allocations = 5;
+  snapshot.chunk_bytes = 4096;
+  snapshot.chunk_used_bytes = 1024;
+  snapshot.size_classes.push_back({0, 64, 3, 1, 2, 10, 20});
+  snapshot.size_classes.push_back({1, 128, 2, 2, 0, 4, 0});
+
+  const std::string json = snapshot.toJson();
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+  EXPECT_NE(json.find("\"total_allocations\":5"), std::string::npos);
+  EXPECT_NE(json.find("\"chunk_occupancy\":0.25"), std::string::npos);
+  EXPECT_NE(json.find("\"size_classes\":[{\"index\":0,\"block_size\":64,"
+                      "\"allocations\":3,\"deallocations\":1,"
+                      "\"live_blocks\":2,\"free_blocks\":10,"
+                      "\"wasted_bytes\":20,\"peak_live_blocks\":0},"
+                      "{\"index\":1"),
+            std::string::npos);
+}
+
+} // namespace
@@ -142,7 +142,7 @@ TEST(SegregatePool, AllocatesFromChunkWhenBelowMaxSize) {
   // block_size.
   void *base = reinterpret_cast<void *>(0x1000);
   const std::size_t block_size = 128; // ceil(max(64, 80))
-  EXPECT_CALL(impl, allocate(256, 0))
+  EXPECT_CALL(impl, allocate(256, 128))
       .WillOnce(Return(CpuBufferView{base, 0, 256}));
 
   Pool::LaunchParams params{};
@@ -212,7 +212,7 @@ TEST(SegregatePool, DeallocateReturnsBlockToFreelist) {
   pool.initialize(cfg);
 
   void *base = reinterpret_cast<void *>(0x3000);
-  EXPECT_CALL(impl, allocate(256, 0))
+  EXPECT_CALL(impl, allocate(256, 128))
       .WillOnce(Return(CpuBufferView{base, 0, 256}));
 
   Pool::LaunchParams params{};
@@ -283,10 +283,10 @@ TEST(SegregatePool, ReleaseChunkFreesBackingAndForcesNewChunkOnNextAlloc) {
 
   void *base = reinterpret_cast<void *>(0x5000);
   void *base2 = reinterpret_cast<void *>(0x6000);
-  EXPECT_CALL(impl, allocate(256, 0))
+  EXPECT_CALL(impl, allocate(256, 128))
       .WillOnce(Return(CpuBufferView{base, 0, 256}))
       .WillOnce(Return(CpuBufferView{base2, 0, 256}));
-  EXPECT_CALL(impl, deallocate(testing::_, 256, 0)).Times(1);
+  EXPECT_CALL(impl, deallocate(testing::_, 256, 128)).Times(1);
 
   Pool::LaunchParams params{};
   CpuBufferType block = pool.allocate(80, 64, params);
@@ -331,7 +331,7 @@ TEST(SegregatePool, StatsTracking) {
 
   // Mock allocation for expansion
   void *base = reinterpret_cast<void *>(0x7000);
-  EXPECT_CALL(impl, allocate(256, 0))
+  EXPECT_CALL(impl, allocate(256, 64))
       .WillOnce(Return(CpuBufferView{base, 0, 256}));
 
   Pool::LaunchParams params{};
@@ -0,0 +1,115 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+using Pool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, policies::NoLockThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+void initializePool(Pool &pool, std::size_t chunk_size) {
+  Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = chunk_size;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+TEST(SegregatePoolTrim, ReleasesEveryIdleChunkInOnePass) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  // One block per chunk, so every allocation creates a chunk.
+  initializePool(pool, 256);
+
+  Pool::LaunchParams params{};
+  constexpr std::size_t kChunks = 300;
+  std::vector<Pool::BufferResource> blocks;
+  for (std::size_t i = 0; i < kChunks; ++i) {
+    blocks.push_back(pool.allocate(256, 0, params));
+    ASSERT_TRUE(blocks.back().valid());
+  }
+  EXPECT_EQ(pool.chunk_locator_policy().releasableCount(), 0u);
+
+  for (std::size_t i = 0; i < kChunks; i += 2) {
+    pool.deallocate(std::move(blocks[i]), 256, 0, params);
+  }
+
+  EXPECT_EQ(pool.releaseIdleChunks(params), kChunks / 2);
+  EXPECT_EQ(pool.free_list_policy().get_total_free_blocks(), 0u);
+  EXPECT_EQ(pool.reuse_policy().getPendingReuseCount(), 0u);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), kChunks / 2);
+
+  for (std::size_t i = 1; i < kChunks; i += 2) {
+    pool.deallocate(std::move(blocks[i]), 256, 0, params);
+  }
+  EXPECT_EQ(pool.releaseIdleChunks(params), kChunks / 2);
+  EXPECT_EQ(pool.releaseIdleChunks(params), 0u);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(SegregatePoolTrim, KeepsChunksWithPendingReuse) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 256);
+
+  Pool::LaunchParams params{};
+  auto done = pool.allocate(256, 0, params);
+  auto in_flight = pool.allocate(256, 0, params);
+  pool.deallocate(std::move(done), 256, 0, params);
+
+  HostPoolResource::completed().store(false);
+  pool.deallocate(std::move(in_flight), 256, 0, params);
+  // HostPoolResource's completion flag is global, so both frees stay pending
+  // and neither chunk may be released.
+  EXPECT_EQ(pool.releaseIdleChunks(params), 0u);
+  EXPECT_EQ(pool.reuse_policy().getPendingReuseCount(), 2u);
+
+  HostPoolResource::completed().store(true);
+  EXPECT_EQ(pool.releaseIdleChunks(params), 2u);
+  EXPECT_EQ(pool.reuse_policy().getPendingReuseCount(), 0u);
+}
+
+TEST(SegregatePoolTrim, ReusedBlockKeepsChunkAlive) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 1024);
+
+  Pool::LaunchParams params{};
+  auto a = pool.allocate(256, 0, params);
+  auto b = pool.allocate(256, 0, params);
+  pool.deallocate(std::move(a), 256, 0, params);
+  auto c = pool.allocate(256, 0, params);
+
+  EXPECT_EQ(pool.releaseIdleChunks(params), 0u);
+  pool.deallocate(std::move(b), 256, 0, params);
+  pool.deallocate(std::move(c), 256, 0, params);
+  EXPECT_EQ(pool.releaseIdleChunks(params), 1u);
+}
+
+} // namespace
@@ -0,0 +1,246 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool_warmup.h"
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::diagnostics::error::OrteafErrc;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+using Pool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy,
+    policies::LockingThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+constexpr std::size_t kChunk = 4096;
+
+Pool::Config makeConfig(Pool &pool) {
+  Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = kChunk;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = kChunk;
+  return cfg;
+}
+
+std::size_t freeBlocks(Pool &pool, std::size_t block_size) {
+  for (const auto &size_class : pool.statsSnapshot().size_classes) {
+    if (size_class.block_size == block_size) {
+      return static_cast<std::size_t>(size_class.free_blocks);
+    }
+  }
+  return 0;
+}
+
+TEST(SegregatePoolWarmup, ConfiguredProfileCarvesChunksAtInitialize) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  auto cfg = makeConfig(pool);
+  // 64B x 100 は 2 チャンク、1024B x 4 と 4096B x 2 はそれぞれ 1 / 2 チャンク
+  cfg.warmup = {{64, 100}, {1024, 4}, {kChunk, 2}};
+  pool.initialize(cfg);
+
+  EXPECT_EQ(pool.chunk_locator_policy().usage().chunk_count, 5u);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 5);
+  EXPECT_EQ(freeBlocks(pool, 64), 128u);
+  EXPECT_EQ(freeBlocks(pool, 1024), 4u);
+  EXPECT_EQ(freeBlocks(pool, kChunk), 2u);
+
+  // ウォームアップ済みのサイズクラスは最初の確保でもチャンクを増やさない
+  Pool::LaunchParams params{};
+  std::vector<Pool::BufferResource> blocks;
+  for (int i = 0; i < 100; ++i) {
+    blocks.push_back(pool.allocate(48, 0, params));
+  }
+  auto large_class = pool.allocate(1000, 0, params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 5);
+  EXPECT_EQ(pool.statsSnapshot().pool_expansions, 5u);
+
+  for (auto &block : blocks) {
+    pool.deallocate(std::move(block), 48, 0, params);
+  }
+  pool.deallocate(std::move(large_class), 1000, 0, params);
+}
+
+TEST(SegregatePoolWarmup, WarmupTopsUpExistingFreeBlocks) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  pool.initialize(makeConfig(pool));
+  Pool::LaunchParams params{};
+
+  const pool_ns::SegregatePoolWarmupProfile profile = {{256, 16}};
+  EXPECT_EQ(pool.warmup(profile, params), 1u);
+  EXPECT_EQ(freeBlocks(pool, 256), 16u);
+
+  // すでに足りているので何もしない
+  EXPECT_EQ(pool.warmup(profile, params), 0u);
+  EXPECT_EQ(pool.warmup({{256, 17}}, params), 1u);
+  EXPECT_EQ(freeBlocks(pool, 256), 32u);
+}
+
+TEST(SegregatePoolWarmup, RoundsSizesAndIgnoresLargeEntries) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  pool.initialize(makeConfig(pool));
+  Pool::LaunchParams params{};
+
+  // 100B は 128B クラスに丸め、max_block_size 超と空エントリは無視する
+  EXPECT_EQ(pool.warmup({{100, 1}, {kChunk * 2, 8}, {0, 4}, {512, 0}}, params),
+            1u);
+  EXPECT_EQ(freeBlocks(pool, 128), kChunk / 128);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 1);
+}
+
+TEST(SegregatePoolWarmup, ProfileFromPreviousRunStatsReproducesPeak) {
+  HostPoolResource::resetCounters();
+  pool_ns::SegregatePoolWarmupProfile profile;
+  {
+    Pool pool;
+    pool.initialize(makeConfig(pool));
+    Pool::LaunchParams params{};
+    std::vector<Pool::BufferResource> blocks;
+    for (int i = 0; i < 70; ++i) {
+      blocks.push_back(pool.allocate(64, 0, params));
+    }
+    auto wide = pool.allocate(2048, 0, params);
+    for (auto &block : blocks) {
+      pool.deallocate(std::move(block), 64, 0, params);
+    }
+    pool.deallocate(std::move(wide), 2048, 0, params);
+    // 全て返却済みでも最大生存数が残る
+    profile = pool_ns::makeWarmupProfile(pool.statsSnapshot());
+    pool.releaseChunk(params);
+  }
+  const pool_ns::SegregatePoolWarmupProfile expected = {{64, 70}, {2048, 1}};
+  EXPECT_EQ(profile, expected);
+
+  HostPoolResource::resetCounters();
+  Pool pool;
+  auto cfg = makeConfig(pool);
+  cfg.warmup = pool_ns::parseWarmupProfile(
+      pool_ns::formatWarmupProfile(profile));
+  pool.initialize(cfg);
+  EXPECT_EQ(pool.chunk_locator_policy().usage().chunk_count, 3u);
+  EXPECT_GE(freeBlocks(pool, 64), 70u);
+  EXPECT_GE(freeBlocks(pool, 2048), 1u);
+}
+
+TEST(SegregatePoolWarmup, FormatAndParseRoundTrip) {
+  const pool_ns::SegregatePoolWarmupProfile profile = {{64, 12}, {4096, 3}};
+  const std::string text = pool_ns::formatWarmupProfile(profile);
+  EXPECT_EQ(text, "64 12\n4096 3\n");
+  EXPECT_EQ(pool_ns::parseWarmupProfile("# block_size blocks\n\n" + text),
+            profile);
+}
+
+TEST(SegregatePoolWarmup, ParseRejectsMalformedLines) {
+  ::orteaf::tests::ExpectError(OrteafErrc::InvalidArgument, [] {
+    pool_ns::parseWarmupProfile("64\n");
+  });
+  ::orteaf::tests::ExpectError(OrteafErrc::InvalidArgument, [] {
+    pool_ns::parseWarmupProfile("64 12 extra\n");
+  });
+  ::orteaf::tests::ExpectError(OrteafErrc::InvalidArgument, [] {
+    pool_ns::parseWarmupProfile("sixty-four 12\n");
+  });
+}
+
+// LaunchParams を既定構築できないリソース
+struct ExplicitLaunchResource : HostPoolResource {
+  struct LaunchParams {
+    explicit LaunchParams(int) {}
+  };
+};
+
+using ExplicitLaunchPool = pool_ns::SegregatePool<
+    ExplicitLaunchResource, policies::FastFreePolicy,
+    policies::LockingThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<ExplicitLaunchResource>,
+    policies::DirectChunkLocatorPolicy<ExplicitLaunchResource>,
+    policies::DeferredReusePolicy<ExplicitLaunchResource>,
+    policies::HostStackFreelistPolicy<ExplicitLaunchResource>>;
+
+// initialize はウォームアップ用の LaunchParams を作れないので、
+// Config::warmup への代入はコンパイル時に拒否される
+static_assert(std::is_assignable_v<decltype((std::declval<Pool::Config &>().warmup)),
+                                   const pool_ns::SegregatePoolWarmupProfile &>);
+static_assert(!std::is_assignable_v<
+              decltype((std::declval<ExplicitLaunchPool::Config &>().warmup)),
+              const pool_ns::SegregatePoolWarmupProfile &>);
+
+TEST(SegregatePoolWarmup, WarmChunksSurviveBudgetTrimUntilThreshold) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  auto cfg = makeConfig(pool);
+  cfg.warmup = {{1024, 4}};
+  pool.initialize(cfg);
+  Pool::LaunchParams params{};
+
+  // 通常のチャンクを 1 つ使って返す
+  auto block = pool.allocate(64, 0, params);
+  pool.deallocate(std::move(block), 64, 0, params);
+  ASSERT_EQ(pool.chunk_locator_policy().usage().chunk_count, 2u);
+
+  pool_ns::ChunkTrimOptions options{};
+  options.min_idle_epochs = 2;
+  options.budget_bytes = 1;
+
+  // 予算超過でも解放されるのはウォームアップ分以外だけ
+  auto result = pool.trimIdleChunks(options, params);
+  EXPECT_EQ(result.released_chunks, 1u);
+  EXPECT_EQ(pool.chunk_locator_policy().usage().chunk_count, 1u);
+
+  pool.advanceIdleEpoch();
+  EXPECT_EQ(pool.trimIdleChunks(options, params).released_chunks, 0u);
+
+  // min_idle_epochs を経過すれば通常どおり解放される
+  pool.advanceIdleEpoch();
+  EXPECT_EQ(pool.trimIdleChunks(options, params).released_chunks, 1u);
+  EXPECT_EQ(pool.chunk_locator_policy().usage().chunk_count, 0u);
+}
+
+TEST(SegregatePoolWarmup, UsedWarmChunkFollowsBudgetAgain) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  auto cfg = makeConfig(pool);
+  cfg.warmup = {{1024, 4}};
+  pool.initialize(cfg);
+  Pool::LaunchParams params{};
+
+  auto block = pool.allocate(1024, 0, params);
+  pool.deallocate(std::move(block), 1024, 0, params);
+
+  pool_ns::ChunkTrimOptions options{};
+  options.min_idle_epochs = 2;
+  options.budget_bytes = 1;
+  EXPECT_EQ(pool.trimIdleChunks(options, params).released_chunks, 1u);
+  EXPECT_EQ(pool.chunk_locator_policy().usage().chunk_count, 0u);
+}
+
+} // namespace
@@ -0,0 +1,258 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+using ShardedPool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy,
+    policies::SizeClassShardedThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+static_assert(ShardedPool::kShardedLocking);
+
+void initializePool(ShardedPool &pool, std::size_t chunk_size = 64 * 1024) {
+  ShardedPool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = chunk_size;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+TEST(ShardedSegregatePool, ConfiguresShardPerSizeClass) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool);
+  EXPECT_EQ(pool.threading_policy().size_class_count(),
+            pool.size_class_count());
+}
+
+TEST(ShardedSegregatePool, ReusesFreedBlockOfSameSizeClass) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool);
+
+  ShardedPool::LaunchParams params{};
+  auto first = pool.allocate(100, 0, params);
+  ASSERT_TRUE(first.valid());
+  EXPECT_EQ(first.view.size(), 128u);
+  void *first_ptr = first.view.data();
+  pool.deallocate(std::move(first), 100, 0, params);
+
+  auto second = pool.allocate(120, 0, params);
+  ASSERT_TRUE(second.valid());
+  EXPECT_EQ(second.view.data(), first_ptr);
+  EXPECT_EQ(pool.stats().poolExpansions(), 1u);
+  pool.deallocate(std::move(second), 120, 0, params);
+}
+
+TEST(ShardedSegregatePool, IncompleteBlocksAreNotReused) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool, 128);
+
+  ShardedPool::LaunchParams params{};
+  auto first = pool.allocate(128, 0, params);
+  ASSERT_TRUE(first.valid());
+  void *first_ptr = first.view.data();
+
+  HostPoolResource::completed().store(false);
+  pool.deallocate(std::move(first), 128, 0, params);
+  auto second = pool.allocate(128, 0, params);
+  ASSERT_TRUE(second.valid());
+  EXPECT_NE(second.view.data(), first_ptr);
+  HostPoolResource::completed().store(true);
+
+  pool.deallocate(std::move(second), 128, 0, params);
+}
+
+TEST(ShardedSegregatePool, LargeAllocationsBypassSizeClasses) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool);
+
+  ShardedPool::LaunchParams params{};
+  auto block = pool.allocate(16384, 64, params);
+  ASSERT_TRUE(block.valid());
+  EXPECT_EQ(pool.stats().largeAllocations(), 1u);
+  pool.deallocate(std::move(block), 16384, 64, params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(ShardedSegregatePool, ReleaseChunkDrainsEveryShard) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool, 4096);
+
+  ShardedPool::LaunchParams params{};
+  std::vector<ShardedPool::BufferResource> blocks;
+  for (std::size_t size = 64; size <= 4096; size <<= 1) {
+    blocks.push_back(pool.allocate(size, 0, params));
+    ASSERT_TRUE(blocks.back().valid());
+  }
+  for (auto &block : blocks) {
+    const std::size_t size = block.view.size();
+    pool.deallocate(std::move(block), size, 0, params);
+  }
+
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(ShardedSegregatePool, ExpansionDoesNotWaitForOtherSizeClasses) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool);
+  const std::size_t held_class = pool.sizeClassIndexFor(4096);
+
+  // 他クラスのロックを保持し続け、拡張が全体ロックを待つなら期限切れで諦める
+  std::atomic<bool> locked{false};
+  std::atomic<bool> done{false};
+  std::atomic<bool> timed_out{false};
+  std::thread holder([&] {
+    pool.threading_policy().lockSizeClass(held_class);
+    locked.store(true);
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!done.load()) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        timed_out.store(true);
+        break;
+      }
+      std::this_thread::yield();
+    }
+    pool.threading_policy().unlockSizeClass(held_class);
+  });
+  while (!locked.load()) {
+    std::this_thread::yield();
+  }
+
+  ShardedPool::LaunchParams params{};
+  auto block = pool.allocate(64, 0, params);
+  done.store(true);
+  holder.join();
+
+  ASSERT_TRUE(block.valid());
+  EXPECT_FALSE(timed_out.load());
+  pool.deallocate(std::move(block), 64, 0, params);
+}
+
+TEST(ShardedSegregatePool, ManyChunksSurviveConcurrentExpansion) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  // 1 チャンク 1 ブロックにして、チャンク表のセグメントを何度も伸ばす
+  initializePool(pool, 4096);
+
+  constexpr int kThreads = 4;
+  constexpr int kBlocksPerThread = 100;
+  std::atomic<bool> failed{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      ShardedPool::LaunchParams params{};
+      const std::size_t size = std::size_t{512} << (t % 4);
+      std::vector<ShardedPool::BufferResource> held;
+      for (int i = 0; i < kBlocksPerThread; ++i) {
+        held.push_back(pool.allocate(size, 0, params));
+        if (!held.back().valid()) {
+          failed = true;
+          return;
+        }
+      }
+      for (auto &h : held) {
+        pool.deallocate(std::move(h), size, 0, params);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(failed.load());
+
+  ShardedPool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(ShardedSegregatePool, ConcurrentMixedSizesGetDistinctBlocks) {
+  HostPoolResource::resetCounters();
+  ShardedPool pool;
+  initializePool(pool, 16 * 1024);
+
+  constexpr int kThreads = 8;
+  constexpr int kIterations = 2000;
+  std::atomic<bool> failed{false};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      ShardedPool::LaunchParams params{};
+      std::vector<ShardedPool::BufferResource> held;
+      for (int i = 0; i < kIterations; ++i) {
+        auto block = pool.allocate(std::size_t{64} << ((t + i) % 7), 0, params);
+        if (!block.valid()) {
+          failed = true;
+          return;
+        }
+        static_cast<unsigned char *>(block.view.data())[0] =
+            static_cast<unsigned char>(t);
+        held.push_back(std::move(block));
+        if (held.size() > 8) {
+          for (auto &h : held) {
+            if (static_cast<unsigned char *>(h.view.data())[0] !=
+                static_cast<unsigned char>(t)) {
+              failed = true;
+            }
+            const std::size_t size = h.view.size();
+            pool.deallocate(std::move(h), size, 0, params);
+          }
+          held.clear();
+        }
+      }
+      for (auto &h : held) {
+        const std::size_t size = h.view.size();
+        pool.deallocate(std::move(h), size, 0, params);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_FALSE(failed.load());
+
+  ShardedPool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+} // namespace
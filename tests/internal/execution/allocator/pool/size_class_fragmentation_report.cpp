@@ -0,0 +1,124 @@
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/benchmark.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+template <typename FastFree>
+using ReportPool = pool_ns::SegregatePool<
+    HostPoolResource, FastFree, policies::NoLockThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+
+constexpr std::size_t kKiB = 1024;
+constexpr std::size_t kMiB = 1024 * kKiB;
+
+struct FragmentationReport {
+  std::size_t requested_bytes{0};
+  std::size_t resident_bytes{0};
+  std::size_t chunk_bytes{0};
+};
+
+// Log-uniform request sizes between 1 KiB and 4 MiB, roughly matching the
+// spread of activation / workspace buffers.
+std::vector<std::size_t> makeRequestSizes() {
+  std::mt19937_64 rng(42);
+  std::uniform_real_distribution<double> exponent(10.0, 22.0);
+  std::vector<std::size_t> sizes;
+  sizes.reserve(4000);
+  for (int i = 0; i < 4000; ++i) {
+    sizes.push_back(static_cast<std::size_t>(std::exp2(exponent(rng))));
+  }
+  return sizes;
+}
+
+template <typename FastFree, typename ConfigureFastFree>
+FragmentationReport measure(const std::vector<std::size_t> &sizes,
+                            ConfigureFastFree &&configure) {
+  using Pool = ReportPool<FastFree>;
+  HostPoolResource::resetCounters();
+  Pool pool;
+  typename Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  configure(cfg.fast_free);
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 16 * kMiB;
+  cfg.min_block_size = 256;
+  cfg.max_block_size = 4 * kMiB;
+  pool.initialize(cfg);
+
+  FragmentationReport report{};
+  typename Pool::LaunchParams params{};
+  std::vector<typename Pool::BufferResource> live;
+  live.reserve(sizes.size());
+  for (std::size_t size : sizes) {
+    live.push_back(pool.allocate(size, 0, params));
+    report.requested_bytes += size;
+    report.resident_bytes += live.back().view.size();
+  }
+  report.chunk_bytes = HostPoolResource::allocated_bytes().load();
+
+  for (std::size_t i = 0; i < live.size(); ++i) {
+    pool.deallocate(std::move(live[i]), sizes[i], 0, params);
+  }
+  pool.releaseChunk(params);
+  return report;
+}
+
+void printRow(const char *name, const FragmentationReport &report) {
+  const double requested = static_cast<double>(report.requested_bytes);
+  std::cout << "[fragmentation] " << std::left << std::setw(14) << name
+            << " requested=" << report.requested_bytes / kKiB << " KiB"
+            << " resident=" << report.resident_bytes / kKiB << " KiB ("
+            << std::fixed << std::setprecision(3)
+            << report.resident_bytes / requested << "x)"
+            << " chunks=" << report.chunk_bytes / kKiB << " KiB ("
+            << report.chunk_bytes / requested << "x)" << std::endl;
+}
+
+TEST(SizeClassFragmentationBenchmark, ResidentVersusRequestedBytes) {
+  ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+  const auto sizes = makeRequestSizes();
+
+  const auto pow2 =
+      measure<policies::FastFreePolicy>(sizes, [](auto &) {});
+  const auto geo4 = measure<policies::GeometricFastFreePolicy>(
+      sizes, [](auto &cfg) { cfg.sub_classes_per_octave = 4; });
+  const auto geo8 = measure<policies::GeometricFastFreePolicy>(
+      sizes, [](auto &cfg) { cfg.sub_classes_per_octave = 8; });
+
+  printRow("power-of-two", pow2);
+  printRow("geometric/4", geo4);
+  printRow("geometric/8", geo8);
+
+  EXPECT_EQ(pow2.requested_bytes, geo4.requested_bytes);
+  EXPECT_LT(geo4.resident_bytes, pow2.resident_bytes);
+  EXPECT_LE(geo8.resident_bytes, geo4.resident_bytes);
+}
+
+} // namespace
@@ -0,0 +1,336 @@
+#include "orteaf/internal/execution/allocator/pool/thread_caching_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/policy_config.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+
+// Mutex-backed threading policy that counts how often the pool lock is taken.
+class CountingThreadingPolicy {
+public:
+  template <typename Resource>
+  using Config = policies::PolicyConfig<Resource>;
+
+  template <typename Resource> void initialize(const Config<Resource> &) {}
+
+  void lock() {
+    mutex_.lock();
+    lock_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+  void unlock() { mutex_.unlock(); }
+
+  std::size_t lockCount() const {
+    return lock_count_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::mutex mutex_;
+  std::atomic<std::size_t> lock_count_{0};
+};
+
+using Pool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, CountingThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+using CachingPool = pool_ns::ThreadCachingPool<Pool>;
+
+void initializePool(Pool &pool, std::size_t chunk_size = 64 * 1024) {
+  Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = chunk_size;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+TEST(ThreadCachingPool, RefillsMagazineInOneBatch) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  CachingPool cache(pool, CachingPool::Config{16, 8});
+
+  Pool::LaunchParams params{};
+  auto block = cache.allocate(100, 0, params);
+  ASSERT_TRUE(block.valid());
+  EXPECT_EQ(block.view.size(), 128u);
+  EXPECT_EQ(pool.threading_policy().lockCount(), 1u);
+  EXPECT_EQ(cache.cachedBlockCount(), 7u);
+
+  cache.deallocate(std::move(block), 100, 0, params);
+}
+
+TEST(ThreadCachingPool, SteadyStateAllocFreeSkipsPoolLock) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  CachingPool cache(pool, CachingPool::Config{16, 8});
+
+  Pool::LaunchParams params{};
+  auto warm = cache.allocate(256, 0, params);
+  cache.deallocate(std::move(warm), 256, 0, params);
+  const std::size_t locks_before = pool.threading_policy().lockCount();
+
+  for (int i = 0; i < 1000; ++i) {
+    auto block = cache.allocate(256, 0, params);
+    ASSERT_TRUE(block.valid());
+    cache.deallocate(std::move(block), 256, 0, params);
+  }
+
+  EXPECT_EQ(pool.threading_policy().lockCount(), locks_before);
+}
+
+TEST(ThreadCachingPool, FlushesBatchWhenMagazineIsFull) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  CachingPool cache(pool, CachingPool::Config{4, 2});
+
+  Pool::LaunchParams params{};
+  std::vector<Pool::BufferResource> blocks;
+  for (int i = 0; i < 6; ++i) {
+    blocks.push_back(cache.allocate(64, 0, params));
+    ASSERT_TRUE(blocks.back().valid());
+  }
+  for (auto &block : blocks) {
+    cache.deallocate(std::move(block), 64, 0, params);
+  }
+
+  EXPECT_LE(cache.cachedBlockCount(), 4u);
+  EXPECT_EQ(pool.reuse_policy().getPendingReuseCount(), 2u);
+}
+
+TEST(ThreadCachingPool, IncompleteReuseTokenBypassesCache) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  CachingPool cache(pool, CachingPool::Config{8, 4});
+
+  Pool::LaunchParams params{};
+  auto block = cache.allocate(64, 0, params);
+  ASSERT_TRUE(block.valid());
+  const std::size_t cached_before = cache.cachedBlockCount();
+
+  HostPoolResource::completed().store(false);
+  cache.deallocate(std::move(block), 64, 0, params);
+  EXPECT_EQ(cache.cachedBlockCount(), cached_before);
+  EXPECT_EQ(pool.reuse_policy().getPendingReuseCount(), 1u);
+  HostPoolResource::completed().store(true);
+}
+
+TEST(ThreadCachingPool, LargeRequestsGoStraightToPool) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  CachingPool cache(pool);
+
+  Pool::LaunchParams params{};
+  auto block = cache.allocate(8192, 64, params);
+  ASSERT_TRUE(block.valid());
+  EXPECT_EQ(cache.cachedBlockCount(), 0u);
+  cache.deallocate(std::move(block), 8192, 64, params);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 1u);
+}
+
+TEST(ThreadCachingPool, DeallocateBatchReturnsLargeBlocksToResource) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+
+  Pool::LaunchParams params{};
+  Pool::BufferResource blocks[3];
+  for (auto &block : blocks) {
+    block = pool.allocate(8192, 64, params);
+    ASSERT_TRUE(block.valid());
+  }
+  // large サイズでも黙って捨てずに LargeAllocPolicy へ返す
+  pool.deallocateBatch(blocks, 3, 8192, 64, params);
+  for (const auto &block : blocks) {
+    EXPECT_FALSE(block.valid());
+  }
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 3u);
+}
+
+TEST(ThreadCachingPool, FlushAllReturnsEveryBlockAndAllowsChunkRelease) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 4096);
+  {
+    CachingPool cache(pool, CachingPool::Config{16, 8});
+    Pool::LaunchParams params{};
+    auto block = cache.allocate(512, 0, params);
+    cache.deallocate(std::move(block), 512, 0, params);
+    cache.flushAll(params);
+    EXPECT_EQ(cache.cachedBlockCount(), 0u);
+  }
+
+  Pool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(ThreadCachingPool, ExitingThreadReturnsItsMagazines) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 4096);
+  CachingPool cache(pool, CachingPool::Config{16, 8});
+
+  std::thread worker([&] {
+    Pool::LaunchParams params{};
+    auto block = cache.allocate(512, 0, params);
+    ASSERT_TRUE(block.valid());
+    cache.deallocate(std::move(block), 512, 0, params);
+    EXPECT_GT(cache.cachedBlockCount(), 0u);
+  });
+  worker.join();
+
+  // flushAll を呼ばなくても終了したスレッドの magazine はプールへ戻っている
+  Pool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_GT(HostPoolResource::allocate_calls().load(), 0u);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(ThreadCachingPool, ThreadOutlivingInstanceDoesNotTouchIt) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool, 4096);
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool used = false;
+  bool destroyed = false;
+  auto cache = std::make_unique<CachingPool>(pool, CachingPool::Config{16, 8});
+
+  std::thread worker([&] {
+    Pool::LaunchParams params{};
+    auto block = cache->allocate(256, 0, params);
+    cache->deallocate(std::move(block), 256, 0, params);
+    std::unique_lock<std::mutex> lock(mutex);
+    used = true;
+    cv.notify_all();
+    cv.wait(lock, [&] { return destroyed; });
+  });
+
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&] { return used; });
+  }
+  cache.reset();
+  const std::size_t deallocs = HostPoolResource::deallocate_calls().load();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    destroyed = true;
+  }
+  cv.notify_all();
+  worker.join();
+
+  // 破棄時に flush 済みなので、スレッド終了でプールへの返却は起きない
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), deallocs);
+  Pool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(ThreadCachingPool, DestroyedInstancesLeaveNoCacheBehind) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  Pool::LaunchParams params{};
+  for (int i = 0; i < 100; ++i) {
+    CachingPool cache(pool, CachingPool::Config{4, 2});
+    auto block = cache.allocate(64, 0, params);
+    cache.deallocate(std::move(block), 64, 0, params);
+  }
+  CachingPool cache(pool, CachingPool::Config{4, 2});
+  EXPECT_EQ(cache.cachedBlockCount(), 0u);
+  auto block = cache.allocate(64, 0, params);
+  EXPECT_EQ(cache.cachedBlockCount(), 1u);
+  cache.deallocate(std::move(block), 64, 0, params);
+}
+
+TEST(ThreadCachingPool, ConcurrentThreadsGetDistinctBlocks) {
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  {
+    CachingPool cache(pool, CachingPool::Config{32, 16});
+
+    constexpr int kThreads = 8;
+    constexpr int kIterations = 2000;
+    std::atomic<bool> overlap{false};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&, t] {
+        Pool::LaunchParams params{};
+        std::vector<Pool::BufferResource> held;
+        for (int i = 0; i < kIterations; ++i) {
+          auto block = cache.allocate(64 << (i % 4), 0, params);
+          if (!block.valid()) {
+            overlap = true;
+            return;
+          }
+          auto *bytes = static_cast<unsigned char *>(block.view.data());
+          bytes[0] = static_cast<unsigned char>(t);
+          held.push_back(std::move(block));
+          if (held.size() > 8) {
+            for (auto &h : held) {
+              if (static_cast<unsigned char *>(h.view.data())[0] !=
+                  static_cast<unsigned char>(t)) {
+                overlap = true;
+              }
+              const std::size_t size = h.view.size();
+              cache.deallocate(std::move(h), size, 0, params);
+            }
+            held.clear();
+          }
+        }
+        for (auto &h : held) {
+          const std::size_t size = h.view.size();
+          cache.deallocate(std::move(h), size, 0, params);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    EXPECT_FALSE(overlap.load());
+  }
+
+  Pool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+} // namespace
@@ -0,0 +1,171 @@
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_huge_page_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
+#include "tests/internal/testing/benchmark.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace orteaf::tests {
+using orteaf::internal::execution::cpu::CpuHugePageResource;
+using orteaf::internal::execution::cpu::CpuResource;
+namespace diag_error = ::orteaf::internal::diagnostics::error;
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+
+namespace {
+
+bool isHugePageAligned(const void* ptr) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % CpuHugePageResource::kHugePageSize == 0;
+}
+
+}  // namespace
+
+TEST(CpuHugePageResourceTest, AllocateZeroThrows) {
+    ExpectErrorMessage(diag_error::OrteafErrc::InvalidParameter, {"size", "CpuHugePageResource"}, [] {
+        CpuHugePageResource::allocate(0, 64);
+    });
+}
+
+TEST(CpuHugePageResourceTest, AllocationIsHugePageAlignedAndWritable) {
+    CpuHugePageResource::initialize();
+    constexpr std::size_t kSize = 3 * 1024 * 1024;
+    auto view = CpuHugePageResource::allocate(kSize, 64);
+    ASSERT_TRUE(view);
+    EXPECT_TRUE(isHugePageAligned(view.data()));
+    EXPECT_EQ(view.size(), kSize);
+    EXPECT_EQ(CpuHugePageResource::mappedSize(kSize), 4u * 1024 * 1024);
+
+    std::memset(view.data(), 0xab, kSize);
+    EXPECT_EQ(static_cast<unsigned char*>(view.data())[kSize - 1], 0xab);
+    CpuHugePageResource::deallocate(view, kSize, 64);
+}
+
+TEST(CpuHugePageResourceTest, HonorsAlignmentAboveHugePageSize) {
+    CpuHugePageResource::initialize();
+    constexpr std::size_t kAlign = 8 * 1024 * 1024;
+    auto view = CpuHugePageResource::allocate(4096, kAlign);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.data()) % kAlign, 0u);
+    CpuHugePageResource::deallocate(view, 4096, kAlign);
+}
+
+TEST(CpuHugePageResourceTest, RejectsNonPowerOfTwoAlignment) {
+    ExpectError(diag_error::OrteafErrc::InvalidParameter,
+                [] { CpuHugePageResource::allocate(4096, 3 * CpuHugePageResource::kHugePageSize); });
+}
+
+TEST(CpuHugePageResourceTest, HugeTlbFallsBackWhenPoolIsEmpty) {
+    // Succeeds whether or not the host has hugetlbfs pages reserved.
+    CpuHugePageResource::initialize(CpuHugePageResource::Config{true});
+    constexpr std::size_t kSize = CpuHugePageResource::kHugePageSize;
+    auto view = CpuHugePageResource::allocate(kSize, 0);
+    ASSERT_TRUE(view);
+    EXPECT_TRUE(isHugePageAligned(view.data()));
+    static_cast<char*>(view.data())[0] = 1;
+    CpuHugePageResource::deallocate(view, kSize, 0);
+    CpuHugePageResource::initialize();
+}
+
+TEST(CpuHugePageResourceTest, DeallocateOnEmptyIsNoOp) {
+    CpuHugePageResource::deallocate({}, 0, 0);
+    SUCCEED();
+}
+
+TEST(CpuHugePageResourceTest, BacksSegregatePoolChunks) {
+    using Pool = pool_ns::SegregatePool<
+        CpuHugePageResource, policies::FastFreePolicy, policies::NoLockThreadingPolicy,
+        policies::DirectResourceLargeAllocPolicy<CpuHugePageResource>,
+        policies::DirectChunkLocatorPolicy<CpuHugePageResource>, policies::DeferredReusePolicy<CpuHugePageResource>,
+        policies::HostStackFreelistPolicy<CpuHugePageResource>>;
+
+    CpuHugePageResource::initialize();
+    Pool pool;
+    Pool::Config cfg{};
+    cfg.fast_free.resource = pool.resource();
+    cfg.threading.resource = pool.resource();
+    cfg.large_alloc.resource = pool.resource();
+    cfg.chunk_locator.resource = pool.resource();
+    cfg.reuse.resource = pool.resource();
+    cfg.freelist.resource = pool.resource();
+    cfg.chunk_size = CpuHugePageResource::kHugePageSize;
+    cfg.min_block_size = 64;
+    cfg.max_block_size = 64 * 1024;
+    pool.initialize(cfg);
+
+    Pool::LaunchParams params{};
+    auto block = pool.allocate(4096, 0, params);
+    ASSERT_TRUE(block.valid());
+    EXPECT_TRUE(isHugePageAligned(block.view.raw()));
+    std::memset(block.view.data(), 0, 4096);
+    pool.deallocate(std::move(block), 4096, 0, params);
+    pool.releaseChunk(params);
+}
+
+namespace {
+
+// Reads one word per 4 KiB page in random order, so almost every access
+// needs a fresh TLB entry when the buffer is backed by base pages.
+double randomPageWalkNanos(void* data, std::size_t size) {
+    constexpr std::size_t kPage = 4096;
+    const std::size_t pages = size / kPage;
+    auto* bytes = static_cast<unsigned char*>(data);
+    for (std::size_t i = 0; i < pages; ++i) {
+        bytes[i * kPage] = static_cast<unsigned char>(i);
+    }
+
+    std::vector<std::size_t> order(pages);
+    for (std::size_t i = 0; i < pages; ++i) {
+        order[i] = i * kPage;
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937_64{42});
+
+    constexpr int kRounds = 8;
+    std::size_t sum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; ++round) {
+        for (std::size_t offset : order) {
+            sum += bytes[offset];
+        }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    EXPECT_NE(sum, 0u);
+    return std::chrono::duration<double, std::nano>(end - start).count() / (kRounds * pages);
+}
+
+}  // namespace
+
+TEST(CpuHugePageResourceBenchmark, RandomPageWalkVersusCpuResource) {
+    ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED();
+    constexpr std::size_t kSize = 512 * 1024 * 1024;
+
+    auto base_view = CpuResource::allocate(kSize, 64);
+    const double base_ns = randomPageWalkNanos(base_view.data(), kSize);
+    CpuResource::deallocate(base_view, kSize, 64);
+
+    CpuHugePageResource::initialize();
+    auto huge_view = CpuHugePageResource::allocate(kSize, 0);
+    const double huge_ns = randomPageWalkNanos(huge_view.data(), kSize);
+    CpuHugePageResource::deallocate(huge_view, kSize, 0);
+
+    std::cout << "[tlb] 512 MiB random page walk:"
+              << " CpuResource=" << base_ns << " ns/access"
+              << " CpuHugePageResource=" << huge_ns << " ns/access" << std::endl;
+}
+
+}  // namespace orteaf::tests
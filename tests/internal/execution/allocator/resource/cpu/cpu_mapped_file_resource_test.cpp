@@ -0,0 +1,160 @@
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_mapped_file_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "tests/internal/testing/error_assert.h"
+
+namespace orteaf::tests {
+using orteaf::internal::execution::cpu::CpuMappedFileResource;
+namespace diag_error = ::orteaf::internal::diagnostics::error;
+
+namespace {
+
+// Writes a file under the gtest temp dir and removes it on destruction.
+class TempFile {
+public:
+    TempFile(const std::string& name, const std::vector<std::uint8_t>& bytes)
+        : path_(::testing::TempDir() + "orteaf_mapped_" + name) {
+        std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    }
+    ~TempFile() { std::remove(path_.c_str()); }
+
+    const std::string& path() const { return path_; }
+
+private:
+    std::string path_;
+};
+
+std::vector<std::uint8_t> patternBytes(std::size_t size) {
+    std::vector<std::uint8_t> bytes(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<std::uint8_t>((i * 131u + 7u) & 0xff);
+    }
+    return bytes;
+}
+
+}  // namespace
+
+TEST(CpuMappedFileResourceTest, MapsFileContentsWithoutCopying) {
+    const auto bytes = patternBytes(10000);
+    TempFile file("contents.bin", bytes);
+
+    CpuMappedFileResource::Config config{};
+    config.access = CpuMappedFileResource::Access::Sequential;
+    config.prefetch = true;
+    CpuMappedFileResource mapped(file.path(), config);
+    ASSERT_TRUE(mapped.isOpen());
+    EXPECT_EQ(mapped.size(), bytes.size());
+    EXPECT_EQ(std::memcmp(mapped.data(), bytes.data(), bytes.size()), 0);
+
+    // サブビューはマッピングを直接指す
+    const auto tensor = mapped.view(4096, 1000);
+    EXPECT_EQ(tensor.raw(), mapped.data());
+    EXPECT_EQ(tensor.offset(), 4096u);
+    EXPECT_EQ(tensor.size(), 1000u);
+    EXPECT_EQ(std::memcmp(tensor.data(), bytes.data() + 4096, 1000), 0);
+
+    const auto whole = mapped.view();
+    EXPECT_EQ(whole.size(), bytes.size());
+    const auto rebased = CpuMappedFileResource::makeView(whole, 16, 32);
+    EXPECT_EQ(rebased.data(), static_cast<const char*>(mapped.data()) + 16);
+}
+
+TEST(CpuMappedFileResourceTest, ViewsAliasThePageCache) {
+    TempFile file("alias.bin", patternBytes(8192));
+    CpuMappedFileResource mapped(file.path());
+
+    // 別経路でファイルを書き換えると共有マッピング越しに見える
+    {
+        std::fstream out(file.path(), std::ios::binary | std::ios::in | std::ios::out);
+        out.seekp(100);
+        const char marker[] = "orteaf";
+        out.write(marker, sizeof(marker));
+    }
+    EXPECT_STREQ(static_cast<const char*>(mapped.view(100, 7).data()), "orteaf");
+}
+
+TEST(CpuMappedFileResourceTest, LargeFilesAreHugePageAligned) {
+    const std::size_t size = CpuMappedFileResource::kHugePageSize * 2 + 12345;
+    const auto bytes = patternBytes(size);
+    TempFile file("huge.bin", bytes);
+
+    CpuMappedFileResource mapped(file.path());
+    EXPECT_TRUE(mapped.hugePageAligned());
+    const auto second = mapped.view(CpuMappedFileResource::kHugePageSize, 4096);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second.data()) % CpuMappedFileResource::kHugePageSize, 0u);
+    EXPECT_EQ(std::memcmp(mapped.data(), bytes.data(), size), 0);
+
+    CpuMappedFileResource::Config config{};
+    config.huge_page_align = false;
+    CpuMappedFileResource unaligned(file.path(), config);
+    EXPECT_EQ(std::memcmp(unaligned.data(), bytes.data(), size), 0);
+}
+
+TEST(CpuMappedFileResourceTest, PrefetchAndEvictKeepContentsReadable) {
+    const auto bytes = patternBytes(3 * 4096 + 17);
+    TempFile file("advice.bin", bytes);
+    CpuMappedFileResource mapped(file.path());
+
+    mapped.prefetch(10, 5000);
+    mapped.evict(0, mapped.size());
+    // 追い出したページはファイルから読み直される
+    EXPECT_EQ(std::memcmp(mapped.data(), bytes.data(), bytes.size()), 0);
+    mapped.prefetch(mapped.size(), 0);
+
+    ExpectError(diag_error::OrteafErrc::OutOfRange, [&] { mapped.prefetch(4096, bytes.size()); });
+}
+
+TEST(CpuMappedFileResourceTest, ViewPastEndThrows) {
+    TempFile file("range.bin", patternBytes(100));
+    CpuMappedFileResource mapped(file.path());
+    EXPECT_EQ(mapped.view(100, 0).size(), 0u);
+    ExpectError(diag_error::OrteafErrc::OutOfRange, [&] { (void)mapped.view(50, 51); });
+    ExpectError(diag_error::OrteafErrc::OutOfRange, [&] { (void)mapped.view(101, 0); });
+}
+
+TEST(CpuMappedFileResourceTest, MissingFileThrows) {
+    ExpectErrorMessage(diag_error::OrteafErrc::OperationFailed, {"CpuMappedFileResource", "no_such_file"}, [] {
+        CpuMappedFileResource mapped(::testing::TempDir() + "orteaf_no_such_file.bin");
+    });
+}
+
+TEST(CpuMappedFileResourceTest, EmptyFileMapsToEmptyView) {
+    TempFile file("empty.bin", {});
+    CpuMappedFileResource mapped(file.path());
+    EXPECT_TRUE(mapped.isOpen());
+    EXPECT_EQ(mapped.size(), 0u);
+    EXPECT_TRUE(mapped.view().empty());
+}
+
+TEST(CpuMappedFileResourceTest, MoveTransfersMappingOwnership) {
+    const auto bytes = patternBytes(5000);
+    TempFile file("move.bin", bytes);
+    CpuMappedFileResource first(file.path());
+    const void* data = first.data();
+
+    CpuMappedFileResource second(std::move(first));
+    EXPECT_FALSE(first.isOpen());
+    EXPECT_EQ(first.data(), nullptr);
+    EXPECT_EQ(second.data(), data);
+
+    CpuMappedFileResource third;
+    third = std::move(second);
+    EXPECT_EQ(third.data(), data);
+    EXPECT_EQ(std::memcmp(third.data(), bytes.data(), bytes.size()), 0);
+
+    third.close();
+    EXPECT_FALSE(third.isOpen());
+    EXPECT_EQ(third.size(), 0u);
+}
+
+}  // namespace orteaf::tests
@@ -0,0 +1,64 @@
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_numa_resource.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace orteaf::tests {
+using orteaf::internal::execution::cpu::CpuNumaResource;
+namespace diag_error = ::orteaf::internal::diagnostics::error;
+namespace numa = ::orteaf::internal::execution::cpu::platform::wrapper;
+
+TEST(CpuNumaResourceTest, AllocateZeroThrows) {
+    CpuNumaResource resource{0};
+    ExpectErrorMessage(diag_error::OrteafErrc::InvalidParameter, {"size", "CpuNumaResource"}, [&] {
+        resource.allocate(0, 64);
+    });
+}
+
+TEST(CpuNumaResourceTest, HonorsAlignmentAbovePageSize) {
+    CpuNumaResource resource{0};
+    constexpr std::size_t kAlignment = 1 << 21;
+    auto view = resource.allocate(4096, kAlignment);
+    ASSERT_TRUE(view);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(view.data()) % kAlignment, 0u);
+    std::memset(view.data(), 0x5a, 4096);
+    resource.deallocate(view, 4096, kAlignment);
+}
+
+TEST(CpuNumaResourceTest, RejectsNonPowerOfTwoAlignmentAbovePageSize) {
+    CpuNumaResource resource{0};
+    ExpectError(diag_error::OrteafErrc::InvalidParameter, [&] { resource.allocate(4096, 3 << 20); });
+}
+
+TEST(CpuNumaResourceTest, OfflineNodeFallsBackToFirstOnlineNode) {
+    CpuNumaResource resource{1023};
+    EXPECT_EQ(resource.node(), numa::numaNodeId(0));
+}
+
+TEST(CpuNumaResourceTest, AllocationOnEveryNodeIsWritable) {
+    constexpr std::size_t kSize = 64 * 1024 + 100;
+    for (std::size_t index = 0; index < numa::numaNodeCount(); ++index) {
+        const std::size_t node = numa::numaNodeId(index);
+        CpuNumaResource resource{node};
+        EXPECT_EQ(resource.node(), node);
+        auto view = resource.allocate(kSize, 64);
+        ASSERT_TRUE(view);
+        EXPECT_EQ(view.size(), kSize);
+        std::memset(view.data(), 0x5a, kSize);
+        EXPECT_EQ(static_cast<unsigned char*>(view.data())[kSize - 1], 0x5a);
+        resource.deallocate(view, kSize, 64);
+    }
+}
+
+TEST(CpuNumaResourceTest, DeallocateOnEmptyIsNoOp) {
+    CpuNumaResource resource{};
+    resource.deallocate({}, 0, 0);
+    SUCCEED();
+}
+
+}  // namespace orteaf::tests
@@ -0,0 +1,58 @@
+#include "orteaf/internal/execution/allocator/size_class_utils.h"
+
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+namespace allocator = ::orteaf::internal::execution::allocator;
+
+namespace {
+
+TEST(SizeClassUtils, PowerOfTwoRoundTrip) {
+  EXPECT_EQ(allocator::sizeClassIndex(64, 64), 0u);
+  EXPECT_EQ(allocator::sizeClassIndex(65, 64), 1u);
+  EXPECT_EQ(allocator::sizeClassIndex(1024, 64), 4u);
+  EXPECT_EQ(allocator::sizeClassToBlockSize(4, 64), 1024u);
+  EXPECT_EQ(allocator::sizeClassCount(64, 1024), 5u);
+}
+
+TEST(SizeClassUtils, GeometricClassesSplitEachOctave) {
+  constexpr std::size_t kExpected[] = {64,  80,  96,  112, 128,
+                                       160, 192, 224, 256};
+  for (std::size_t i = 0; i < std::size(kExpected); ++i) {
+    EXPECT_EQ(allocator::geometricSizeClassToBlockSize(i, 64, 4),
+              kExpected[i]);
+    EXPECT_EQ(allocator::geometricSizeClassIndex(kExpected[i], 64, 4), i);
+  }
+  EXPECT_EQ(allocator::geometricSizeClassCount(64, 256, 4), 9u);
+}
+
+TEST(SizeClassUtils, GeometricIndexRoundsUpBetweenClasses) {
+  EXPECT_EQ(allocator::geometricSizeClassIndex(1, 64, 4), 0u);
+  EXPECT_EQ(allocator::geometricSizeClassIndex(65, 64, 4), 1u);
+  EXPECT_EQ(allocator::geometricSizeClassIndex(81, 64, 4), 2u);
+  EXPECT_EQ(allocator::geometricSizeClassIndex(129, 64, 4), 5u);
+  EXPECT_EQ(allocator::geometricBlockSize(129, 64, 4), 160u);
+}
+
+TEST(SizeClassUtils, GeometricWithOneSubClassMatchesPowerOfTwo) {
+  for (std::size_t size = 1; size <= 1 << 16; size = size * 3 / 2 + 1) {
+    EXPECT_EQ(allocator::geometricSizeClassIndex(size, 64, 1),
+              allocator::sizeClassIndex(size, 64));
+  }
+  EXPECT_EQ(allocator::geometricSizeClassCount(64, 1 << 20, 1),
+            allocator::sizeClassCount(64, 1 << 20));
+}
+
+TEST(SizeClassUtils, GeometricBoundsInternalFragmentation) {
+  constexpr std::size_t kKiB = 1024;
+  EXPECT_EQ(allocator::geometricBlockSize(65 * kKiB, 64, 4), 80 * kKiB);
+  EXPECT_EQ(allocator::geometricBlockSize(65 * kKiB, 64, 8), 72 * kKiB);
+  for (std::size_t size = 65; size <= (1 << 20); size += 977) {
+    const std::size_t block = allocator::geometricBlockSize(size, 64, 4);
+    EXPECT_GE(block, size);
+    EXPECT_LE((block - size) * 4, block);
+  }
+}
+
+} // namespace
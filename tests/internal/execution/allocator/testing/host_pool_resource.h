@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+#include "orteaf/internal/execution/allocator/buffer.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_buffer_view.h"
+#include "orteaf/internal/execution/execution.h"
+
+namespace orteaf::internal::execution::allocator::testing {
+
+// ============================================================================
+// HostPoolResource - real host memory resource for SegregatePool tests
+// ============================================================================
+// Unlike MockCpuResource this hands out real, writable memory and counts
+// allocate/deallocate calls with atomics, so it can be used from multiple
+// threads without gMock expectations.
+struct HostPoolResource {
+  using BufferView =
+      ::orteaf::internal::execution::cpu::resource::CpuBufferView;
+  using BufferResource =
+      ::orteaf::internal::execution::allocator::ExecutionBuffer<
+          ::orteaf::internal::execution::Execution::Cpu>;
+  using BufferBlock =
+      ::orteaf::internal::execution::allocator::ExecutionBufferBlock<
+          ::orteaf::internal::execution::Execution::Cpu>;
+  using ReuseToken = typename BufferResource::ReuseToken;
+  struct LaunchParams {};
+
+  static constexpr ::orteaf::internal::execution::Execution
+  execution_type_static() noexcept {
+    return ::orteaf::internal::execution::Execution::Cpu;
+  }
+  constexpr ::orteaf::internal::execution::Execution
+  execution_type() const noexcept {
+    return execution_type_static();
+  }
+
+  static BufferView allocate(std::size_t size, std::size_t alignment) {
+    const std::size_t align = std::max<std::size_t>(alignment, 64);
+    void *base = ::operator new(size, std::align_val_t{align});
+    allocate_calls().fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes().fetch_add(size, std::memory_order_relaxed);
+    return BufferView{base, 0, size};
+  }
+
+  static void deallocate(BufferView view, std::size_t /*size*/,
+                         std::size_t alignment) {
+    if (!view) {
+      return;
+    }
+    const std::size_t align = std::max<std::size_t>(alignment, 64);
+    ::operator delete(view.raw(), std::align_val_t{align});
+    deallocate_calls().fetch_add(1, std::memory_order_relaxed);
+  }
+
+  static BufferView makeView(BufferView base, std::size_t offset,
+                             std::size_t size) {
+    return BufferView{base.raw(), offset, size};
+  }
+
+  static bool isCompleted(ReuseToken &) {
+    return completed().load(std::memory_order_relaxed);
+  }
+
+  static void resetCounters() {
+    allocate_calls().store(0, std::memory_order_relaxed);
+    deallocate_calls().store(0, std::memory_order_relaxed);
+    allocated_bytes().store(0, std::memory_order_relaxed);
+    completed().store(true, std::memory_order_relaxed);
+  }
+
+  static std::atomic<std::size_t> &allocate_calls() {
+    static std::atomic<std::size_t> calls{0};
+    return calls;
+  }
+  static std::atomic<std::size_t> &deallocate_calls() {
+    static std::atomic<std::size_t> calls{0};
+    return calls;
+  }
+  // Total bytes requested through allocate() since the last reset.
+  static std::atomic<std::size_t> &allocated_bytes() {
+    static std::atomic<std::size_t> bytes{0};
+    return bytes;
+  }
+  static std::atomic<bool> &completed() {
+    static std::atomic<bool> flag{true};
+    return flag;
+  }
+};
+
+} // namespace orteaf::internal::execution::allocator::testing
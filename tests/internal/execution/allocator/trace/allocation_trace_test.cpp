@@ -0,0 +1,260 @@
+#include "orteaf/internal/execution/allocator/trace/allocation_trace.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "orteaf/internal/execution/allocator/lowlevel/hierarchical_slot_allocator.h"
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "orteaf/internal/execution/allocator/trace/allocation_trace_replay.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_heap_ops.h"
+#include "orteaf/internal/execution/execution.h"
+#include "tests/internal/execution/allocator/testing/host_pool_resource.h"
+#include "tests/internal/testing/error_assert.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+namespace trace = ::orteaf::internal::execution::allocator::trace;
+using ::orteaf::internal::execution::allocator::testing::HostPoolResource;
+using ::orteaf::internal::execution::cpu::resource::CpuHeapOps;
+using Execution = ::orteaf::internal::execution::Execution;
+using Op = trace::AllocationTraceOp;
+
+using Pool = pool_ns::SegregatePool<
+    HostPoolResource, policies::FastFreePolicy, policies::NoLockThreadingPolicy,
+    policies::DirectResourceLargeAllocPolicy<HostPoolResource>,
+    policies::DirectChunkLocatorPolicy<HostPoolResource>,
+    policies::DeferredReusePolicy<HostPoolResource>,
+    policies::HostStackFreelistPolicy<HostPoolResource>>;
+using SlotAllocator =
+    policies::HierarchicalSlotAllocator<CpuHeapOps, Execution::Cpu>;
+
+constexpr std::size_t kPage = 4096;
+
+void initializePool(Pool &pool) {
+  Pool::Config cfg{};
+  cfg.fast_free.resource = pool.resource();
+  cfg.threading.resource = pool.resource();
+  cfg.large_alloc.resource = pool.resource();
+  cfg.chunk_locator.resource = pool.resource();
+  cfg.reuse.resource = pool.resource();
+  cfg.freelist.resource = pool.resource();
+  cfg.chunk_size = 4096;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 4096;
+  pool.initialize(cfg);
+}
+
+trace::AllocationTrace recordWorkload() {
+  trace::AllocationTraceRecorder recorder;
+  Pool pool;
+  initializePool(pool);
+  pool.setTraceRecorder(&recorder);
+  Pool::LaunchParams params{};
+
+  auto a = pool.allocate(100, 0, params);
+  auto b = pool.allocate(3000, 64, params);
+  auto large = pool.allocate(10000, 0, params);
+  pool.deallocate(std::move(a), 100, 0, params);
+  Pool::BufferResource batch[3];
+  EXPECT_EQ(pool.allocateBatch(64, 0, batch, 3, params), 3u);
+  pool.deallocate(std::move(large), 10000, 0, params);
+  pool.deallocateBatch(batch, 3, 64, 0, params);
+  // b は生存したまま記録を終える
+
+  pool.setTraceRecorder(nullptr);
+  pool.deallocate(std::move(b), 3000, 64, params);
+  pool.releaseChunk(params);
+  return recorder.snapshot();
+}
+
+TEST(AllocationTrace, RecorderPairsDeallocationsWithAllocations) {
+  trace::AllocationTraceRecorder recorder;
+  const trace::AllocationTraceKey x{1, 0};
+  const trace::AllocationTraceKey y{1, 64};
+
+  EXPECT_EQ(recorder.recordAllocate(x, 32, 0), 0u);
+  EXPECT_EQ(recorder.recordAllocate(y, 48, 16), 1u);
+  EXPECT_TRUE(recorder.recordDeallocate(x, 32, 0));
+  // 記録開始前に確保されたブロックの解放は捨てる
+  EXPECT_FALSE(recorder.recordDeallocate(trace::AllocationTraceKey{2, 0}, 8, 0));
+  // 同じキーが再利用されても新しい id が振られる
+  EXPECT_EQ(recorder.recordAllocate(x, 16, 0), 2u);
+
+  const auto recorded = recorder.snapshot();
+  ASSERT_EQ(recorded.events.size(), 4u);
+  EXPECT_EQ(recorded.id_count, 3u);
+  EXPECT_EQ(recorded.thread_count, 1u);
+  EXPECT_EQ(recorded.events[2].op, Op::Deallocate);
+  EXPECT_EQ(recorded.events[2].id, 0u);
+  EXPECT_EQ(recorded.events[1].alignment, 16u);
+  for (std::size_t i = 1; i < recorded.events.size(); ++i) {
+    EXPECT_GE(recorded.events[i].timestamp_ns,
+              recorded.events[i - 1].timestamp_ns);
+  }
+
+  recorder.clear();
+  EXPECT_EQ(recorder.eventCount(), 0u);
+  EXPECT_EQ(recorder.recordAllocate(x, 32, 0), 0u);
+}
+
+TEST(AllocationTrace, RecorderNumbersThreadsInOrderOfAppearance) {
+  trace::AllocationTraceRecorder recorder;
+  recorder.recordAllocate(trace::AllocationTraceKey{0, 0}, 8, 0);
+  std::thread worker([&] {
+    recorder.recordAllocate(trace::AllocationTraceKey{0, 64}, 8, 0);
+  });
+  worker.join();
+
+  const auto recorded = recorder.snapshot();
+  EXPECT_EQ(recorded.thread_count, 2u);
+  EXPECT_EQ(recorded.events[0].thread, 0u);
+  EXPECT_EQ(recorded.events[1].thread, 1u);
+}
+
+TEST(AllocationTrace, SegregatePoolRecordsSingleAndBatchCalls) {
+  HostPoolResource::resetCounters();
+  const auto recorded = recordWorkload();
+
+  ASSERT_EQ(recorded.events.size(), 11u);
+  EXPECT_EQ(recorded.id_count, 6u);
+
+  std::size_t allocs = 0;
+  std::size_t deallocs = 0;
+  for (const auto &event : recorded.events) {
+    (event.op == Op::Allocate ? allocs : deallocs) += 1;
+  }
+  EXPECT_EQ(allocs, 6u);
+  EXPECT_EQ(deallocs, 5u);
+
+  EXPECT_EQ(recorded.events[1].size, 3000u);
+  EXPECT_EQ(recorded.events[1].alignment, 64u);
+  EXPECT_EQ(recorded.events[3].op, Op::Deallocate);
+  EXPECT_EQ(recorded.events[3].id, recorded.events[0].id);
+  EXPECT_EQ(recorded.events[7].op, Op::Deallocate);
+  EXPECT_EQ(recorded.events[7].size, 10000u);
+  EXPECT_EQ(recorded.events[7].id, recorded.events[2].id);
+}
+
+TEST(AllocationTrace, EncodeDecodeRoundTrip) {
+  HostPoolResource::resetCounters();
+  const auto recorded = recordWorkload();
+
+  const std::string bytes = trace::encodeAllocationTrace(recorded);
+  // 可変長エンコードにより 1 イベントあたり固定長構造体より十分小さい
+  EXPECT_LT(bytes.size(),
+            16 + recorded.events.size() * sizeof(trace::AllocationTraceEvent) / 2);
+
+  const auto decoded = trace::decodeAllocationTrace(bytes);
+  EXPECT_EQ(decoded.events, recorded.events);
+  EXPECT_EQ(decoded.id_count, recorded.id_count);
+  EXPECT_EQ(decoded.thread_count, recorded.thread_count);
+
+  const auto path = std::filesystem::temp_directory_path() /
+                    "orteaf_allocation_trace_test.oatr";
+  trace::writeAllocationTrace(path.string(), recorded);
+  const auto loaded = trace::readAllocationTrace(path.string());
+  std::filesystem::remove(path);
+  EXPECT_EQ(loaded.events, recorded.events);
+}
+
+TEST(AllocationTrace, DecodeRejectsCorruptInput) {
+  using ::orteaf::internal::diagnostics::error::OrteafErrc;
+  HostPoolResource::resetCounters();
+  const std::string bytes =
+      trace::encodeAllocationTrace(recordWorkload());
+
+  ::orteaf::tests::ExpectError(OrteafErrc::InvalidArgument, [&] {
+    trace::decodeAllocationTrace("not a trace");
+  });
+  ::orteaf::tests::ExpectError(OrteafErrc::InvalidArgument, [&] {
+    trace::decodeAllocationTrace(bytes.substr(0, bytes.size() - 1));
+  });
+  ::orteaf::tests::ExpectError(OrteafErrc::InvalidArgument, [&] {
+    trace::decodeAllocationTrace(bytes + '\0');
+  });
+  ::orteaf::tests::ExpectError(OrteafErrc::OperationFailed, [&] {
+    trace::readAllocationTrace("/nonexistent/orteaf/trace.oatr");
+  });
+}
+
+TEST(AllocationTrace, ReplayDrivesSegregatePool) {
+  HostPoolResource::resetCounters();
+  const auto recorded = recordWorkload();
+
+  HostPoolResource::resetCounters();
+  Pool pool;
+  initializePool(pool);
+  trace::SegregatePoolReplayTarget<Pool> target(pool);
+  const auto report = trace::replayAllocationTrace(recorded, target, {1});
+
+  EXPECT_EQ(report.allocations, 6u);
+  EXPECT_EQ(report.deallocations, 5u);
+  EXPECT_EQ(report.failed_allocations, 0u);
+  EXPECT_GT(report.seconds, 0.0);
+  EXPECT_GT(report.opsPerSecond(), 0.0);
+  // b と large と batch の 3 ブロックが同時に生存するのが最大
+  EXPECT_EQ(report.peak_live_bytes, 3000u + 10000u + 3u * 64u);
+  // 128 / 4096 / 64 のチャンク 3 つと large 10000 バイト。
+  // resident が最大になるのは batch の 1 つ目を確保した時点
+  EXPECT_EQ(report.peak_resident_bytes, 3u * 4096u + 10000u);
+  EXPECT_EQ(report.live_bytes_at_peak_resident, 3000u + 10000u + 64u);
+  EXPECT_NEAR(report.fragmentation(), 1.0 - 13064.0 / 22288.0, 1e-9);
+
+  // 残っていた b も replay の最後に解放されている
+  EXPECT_EQ(pool.chunk_locator_policy().usage().chunk_count, 3u);
+  Pool::LaunchParams params{};
+  pool.releaseChunk(params);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+
+  const std::string json = report.toJson();
+  EXPECT_NE(json.find("\"allocations\":6"), std::string::npos);
+  EXPECT_NE(json.find("\"peak_resident_bytes\":22288"), std::string::npos);
+}
+
+TEST(AllocationTrace, ReplayDrivesHierarchicalSlotAllocator) {
+  trace::AllocationTrace recorded{};
+  recorded.id_count = 3;
+  recorded.events = {
+      {Op::Allocate, 0, 0, kPage, 0, 0},
+      {Op::Allocate, 0, 1, 3 * kPage, 0, 10},
+      {Op::Deallocate, 0, 0, kPage, 0, 20},
+      {Op::Allocate, 0, 2, 100, 0, 30},
+      {Op::Deallocate, 0, 1, 3 * kPage, 0, 40},
+      {Op::Deallocate, 0, 2, 100, 0, 50},
+  };
+
+  CpuHeapOps heap_ops;
+  SlotAllocator allocator;
+  SlotAllocator::Config cfg{};
+  cfg.levels = {kPage * 4, kPage};
+  cfg.initial_bytes = kPage * 8;
+  allocator.initialize(cfg, &heap_ops);
+
+  trace::HierarchicalSlotReplayTarget<SlotAllocator> target(allocator);
+  const auto report = trace::replayAllocationTrace(recorded, target, {1});
+
+  EXPECT_EQ(report.allocations, 3u);
+  EXPECT_EQ(report.deallocations, 3u);
+  EXPECT_EQ(report.peak_live_bytes, 4 * kPage);
+  // 3 ページの要求は 4 ページのスロットに入る
+  EXPECT_EQ(report.peak_resident_bytes, 5 * kPage);
+  EXPECT_NEAR(report.fragmentation(), 1.0 / 5.0, 1e-9);
+  EXPECT_EQ(target.residentBytes(), 0u);
+}
+
+} // namespace
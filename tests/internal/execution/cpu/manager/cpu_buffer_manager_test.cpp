@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include <orteaf/internal/diagnostics/error/error.h>
+#include <orteaf/internal/execution/cpu/manager/cpu_buffer_manager.h>
+#include <tests/internal/execution/allocator/testing/host_pool_resource.h>
+#include <tests/internal/testing/error_assert.h>
+
+namespace diag_error = orteaf::internal::diagnostics::error;
+namespace cpu_rt = orteaf::internal::execution::cpu::manager;
+
+using orteaf::internal::execution::allocator::testing::HostPoolResource;
+using orteaf::tests::ExpectError;
+
+namespace {
+
+template <typename Manager>
+typename Manager::Config makeConfig(std::size_t capacity = 4) {
+  typename Manager::Config cfg{};
+  cfg.chunk_size = 64 * 1024;
+  cfg.min_block_size = 64;
+  cfg.max_block_size = 16 * 1024;
+  cfg.pool.payload_capacity = capacity;
+  cfg.pool.control_block_capacity = capacity;
+  cfg.pool.payload_block_size = 1;
+  cfg.pool.control_block_block_size = 1;
+  return cfg;
+}
+
+// =============================================================================
+// Default CpuResource-backed manager
+// =============================================================================
+
+class CpuBufferManagerTest : public ::testing::Test {
+protected:
+  using Manager = cpu_rt::CpuBufferManager;
+
+  void TearDown() override { manager_.shutdown(); }
+
+  Manager manager_{};
+};
+
+TEST_F(CpuBufferManagerTest, ShutdownWithoutConfigureIsNoOp) {
+  EXPECT_NO_THROW(manager_.shutdown());
+  EXPECT_NO_THROW(manager_.shutdown());
+  EXPECT_FALSE(manager_.isConfiguredForTest());
+}
+
+TEST_F(CpuBufferManagerTest, AcquireBeforeConfigureThrows) {
+  ExpectError(diag_error::OrteafErrc::InvalidState,
+              [&] { (void)manager_.acquire(1024, 16); });
+}
+
+TEST_F(CpuBufferManagerTest, AcquireReturnsWritableBuffer) {
+  manager_.configure(makeConfig<Manager>());
+
+  auto lease = manager_.acquire(1000, 64);
+  ASSERT_TRUE(lease);
+  auto *buffer = lease.payloadPtr();
+  ASSERT_NE(buffer, nullptr);
+  ASSERT_TRUE(buffer->valid());
+  EXPECT_GE(buffer->view.size(), 1000u);
+  std::memset(buffer->view.data(), 0x7f, 1000);
+  EXPECT_TRUE(manager_.isAliveForTest(lease.payloadHandle()));
+}
+
+TEST_F(CpuBufferManagerTest, AcquireZeroReturnsEmptyLease) {
+  manager_.configure(makeConfig<Manager>());
+  auto lease = manager_.acquire(0, 64);
+  EXPECT_FALSE(lease);
+}
+
+TEST_F(CpuBufferManagerTest, LargeRequestBypassesSizeClasses) {
+  manager_.configure(makeConfig<Manager>());
+  auto lease = manager_.acquire(1 << 20, 64);
+  ASSERT_TRUE(lease);
+  EXPECT_EQ(lease.payloadPtr()->view.size(), 1u << 20);
+}
+
+TEST_F(CpuBufferManagerTest, ReleaseMakesPayloadDead) {
+  manager_.configure(makeConfig<Manager>());
+  auto lease = manager_.acquire(256, 64);
+  const auto handle = lease.payloadHandle();
+  EXPECT_TRUE(manager_.isAliveForTest(handle));
+
+  auto copy = lease;
+  lease.release();
+  EXPECT_TRUE(manager_.isAliveForTest(handle));
+  copy.release();
+  EXPECT_FALSE(manager_.isAliveForTest(handle));
+}
+
+TEST_F(CpuBufferManagerTest, ShutdownWithLiveLeaseThrows) {
+  manager_.configure(makeConfig<Manager>());
+  auto lease = manager_.acquire(256, 64);
+  EXPECT_ANY_THROW(manager_.shutdown());
+  lease.release();
+}
+
+// =============================================================================
+// Allocation counting through HostPoolResource
+// =============================================================================
+
+using CountingManager = cpu_rt::CpuBufferManagerT<HostPoolResource>;
+
+TEST(CpuBufferManagerPooling, ReleasedBlockReturnsToSegregatePool) {
+  HostPoolResource::resetCounters();
+  CountingManager manager;
+  manager.configure(makeConfig<CountingManager>());
+
+  auto first = manager.acquire(512, 64);
+  void *data = first.payloadPtr()->view.data();
+  first.release();
+
+  auto second = manager.acquire(512, 64);
+  EXPECT_EQ(second.payloadPtr()->view.data(), data);
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), 1u);
+  second.release();
+
+  manager.shutdown();
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(),
+            HostPoolResource::deallocate_calls().load());
+}
+
+TEST(CpuBufferManagerPooling, SlotReuseHonorsNewRequestSize) {
+  HostPoolResource::resetCounters();
+  CountingManager manager;
+  manager.configure(makeConfig<CountingManager>(1));
+
+  auto small = manager.acquire(64, 0);
+  small.release();
+  auto large = manager.acquire(4096, 0);
+  EXPECT_GE(large.payloadPtr()->view.size(), 4096u);
+  large.release();
+  manager.shutdown();
+}
+
+TEST(CpuBufferManagerPooling, SteadyStateLoopDoesNoSystemAllocations) {
+  HostPoolResource::resetCounters();
+  CountingManager manager;
+  manager.configure(makeConfig<CountingManager>());
+
+  const std::size_t sizes[] = {256, 1024, 4096, 16 * 1024};
+  auto iteration = [&] {
+    std::vector<CountingManager::StrongBufferLease> leases;
+    for (std::size_t size : sizes) {
+      leases.push_back(manager.acquire(size, 64));
+      ASSERT_TRUE(leases.back());
+    }
+  };
+
+  iteration();
+  const std::size_t warm_allocations = HostPoolResource::allocate_calls().load();
+  const std::size_t warm_slots = manager.payloadPoolCapacityForTest();
+  for (int i = 0; i < 100; ++i) {
+    iteration();
+  }
+  EXPECT_EQ(HostPoolResource::allocate_calls().load(), warm_allocations);
+  EXPECT_EQ(HostPoolResource::deallocate_calls().load(), 0u);
+  EXPECT_EQ(manager.payloadPoolCapacityForTest(), warm_slots);
+
+  manager.shutdown();
+}
+
+// Records the size/alignment every deallocate reaches the resource with.
+struct RecordingHostResource : HostPoolResource {
+  static void deallocate(BufferView view, std::size_t size,
+                         std::size_t alignment) {
+    last_deallocate_size() = size;
+    last_deallocate_alignment() = alignment;
+    HostPoolResource::deallocate(view, size, alignment);
+  }
+
+  static std::size_t &last_deallocate_size() {
+    static std::size_t size{0};
+    return size;
+  }
+  static std::size_t &last_deallocate_alignment() {
+    static std::size_t alignment{0};
+    return alignment;
+  }
+};
+
+TEST(CpuBufferManagerPooling, ReleaseReturnsRequestedSizeAndAlignment) {
+  HostPoolResource::resetCounters();
+  cpu_rt::CpuBufferManagerT<RecordingHostResource> manager;
+  manager.configure(
+      makeConfig<cpu_rt::CpuBufferManagerT<RecordingHostResource>>());
+
+  // large ブロックは確保時と同じ size / alignment で resource に返る
+  constexpr std::size_t kLargeSize = (1 << 20) + 100;
+  auto lease = manager.acquire(kLargeSize, 256);
+  ASSERT_TRUE(lease);
+  lease.release();
+  EXPECT_EQ(RecordingHostResource::last_deallocate_size(), kLargeSize);
+  EXPECT_EQ(RecordingHostResource::last_deallocate_alignment(), 256u);
+  manager.shutdown();
+}
+
+} // namespace
@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+
+#include <unistd.h>
+
 namespace orteaf::tests {
 using orteaf::internal::execution::cpu::resource::CpuHeapOps;
 
@@ -22,6 +26,7 @@ TEST(CpuHeapOpsTest, ReserveMapUnmapRoundTrip) {
 
     // Should not throw
     CpuHeapOps::unmap(region, kSize);
+    CpuHeapOps::release(region);
 }
 
 TEST(CpuHeapOpsTest, MapUnmapOnEmptyIsNoOp) {
@@ -30,4 +35,49 @@ TEST(CpuHeapOpsTest, MapUnmapOnEmptyIsNoOp) {
     SUCCEED();
 }
 
+TEST(CpuHeapOpsTest, UnmapKeepsReservationForRemap) {
+    const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    auto region = CpuHeapOps::reserve(page);
+    ASSERT_TRUE(region);
+
+    auto mapped = CpuHeapOps::map(region);
+    ASSERT_TRUE(mapped);
+    std::memset(mapped.data(), 0xAB, page);
+
+    CpuHeapOps::unmap(region, page);
+
+    // The VA is still ours: mapping it again succeeds at the same address and
+    // the decommitted pages come back zero-filled.
+    auto remapped = CpuHeapOps::map(region);
+    ASSERT_TRUE(remapped);
+    EXPECT_EQ(remapped.data(), region.data());
+    EXPECT_EQ(static_cast<unsigned char*>(remapped.data())[0], 0u);
+    EXPECT_EQ(static_cast<unsigned char*>(remapped.data())[page - 1], 0u);
+
+    CpuHeapOps::unmap(region, page);
+    CpuHeapOps::release(region);
+}
+
+TEST(CpuHeapOpsTest, MapsAndUnmapsContiguousRangeInOneCall) {
+    const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+    constexpr std::size_t kSlots = 4;
+    auto region = CpuHeapOps::reserve(page * kSlots);
+    ASSERT_TRUE(region);
+
+    // Slots 1..2 as a single range.
+    CpuHeapOps::HeapRegion range{static_cast<char*>(region.data()) + page, page * 2};
+    auto mapped = CpuHeapOps::map(range);
+    ASSERT_TRUE(mapped);
+    EXPECT_EQ(mapped.size(), page * 2);
+    std::memset(mapped.data(), 0x5A, page * 2);
+
+    CpuHeapOps::unmap(range, range.size());
+    CpuHeapOps::release(region);
+}
+
+TEST(CpuHeapOpsTest, ReleaseOnEmptyIsNoOp) {
+    CpuHeapOps::release({});    // no-throw
+    SUCCEED();
+}
+
 }  // namespace orteaf::tests
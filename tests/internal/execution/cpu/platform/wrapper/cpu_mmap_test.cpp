@@ -0,0 +1,63 @@
+/**
+ * @file cpu_mmap_test.cpp
+ * @brief Tests for aligned anonymous mappings.
+ */
+
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_mmap.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/mman.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "tests/internal/testing/error_assert.h"
+
+namespace cpu = orteaf::internal::execution::cpu::platform::wrapper;
+namespace diag_error = ::orteaf::internal::diagnostics::error;
+
+/**
+ * @brief Test that read-write mappings start on the requested boundary and are writable.
+ */
+TEST(CpuMmap, MapAlignedHonorsAlignment) {
+    constexpr std::size_t kSize = 64 * 1024;
+    for (std::size_t alignment : {std::size_t{4096}, std::size_t{1} << 16, std::size_t{1} << 21}) {
+        void* base = cpu::mapAligned(kSize, alignment);
+        ASSERT_NE(base, nullptr);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(base) % alignment, 0u);
+        std::memset(base, 0x5a, kSize);
+        EXPECT_EQ(munmap(base, kSize), 0);
+    }
+}
+
+/**
+ * @brief Test that a reservation can be replaced by a fixed mapping.
+ */
+TEST(CpuMmap, ReserveCanBeMappedFixed) {
+    constexpr std::size_t kSize = 2 * 1024 * 1024;
+    void* reserved = cpu::mapAligned(kSize, kSize, cpu::MapAccess::Reserve);
+    ASSERT_NE(reserved, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(reserved) % kSize, 0u);
+    void* base = mmap(reserved, kSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON | MAP_FIXED, -1, 0);
+    ASSERT_EQ(base, reserved);
+    static_cast<char*>(base)[kSize - 1] = 1;
+    EXPECT_EQ(munmap(base, kSize), 0);
+}
+
+/**
+ * @brief Test that non-power-of-two alignments are rejected.
+ */
+TEST(CpuMmap, MapAlignedRejectsNonPowerOfTwoAlignment) {
+    orteaf::tests::ExpectError(diag_error::OrteafErrc::InvalidParameter,
+                               [] { cpu::mapAligned(4096, 3 << 20); });
+    orteaf::tests::ExpectError(diag_error::OrteafErrc::InvalidParameter, [] { cpu::mapAligned(4096, 0); });
+}
+
+/**
+ * @brief Test that empty and overflowing requests fail without mapping anything.
+ */
+TEST(CpuMmap, MapAlignedReturnsNullForImpossibleSizes) {
+    EXPECT_EQ(cpu::mapAligned(0, 4096), nullptr);
+    EXPECT_EQ(cpu::mapAligned(SIZE_MAX - 100, 4096), nullptr);
+}
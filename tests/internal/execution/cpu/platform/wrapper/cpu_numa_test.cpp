@@ -0,0 +1,85 @@
+/**
+ * @file cpu_numa_test.cpp
+ * @brief Tests for NUMA topology queries and placement.
+ */
+
+#include "orteaf/internal/execution/cpu/platform/wrapper/cpu_numa.h"
+
+#include <gtest/gtest.h>
+
+#include <sys/mman.h>
+
+#include <vector>
+
+namespace cpu = orteaf::internal::execution::cpu::platform::wrapper;
+
+/**
+ * @brief Test that at least one node is always reported.
+ */
+TEST(CpuNuma, NodeCountIsAtLeastOne) {
+    EXPECT_GE(cpu::numaNodeCount(), 1u);
+}
+
+/**
+ * @brief Test that the current node is an online node ID.
+ */
+TEST(CpuNuma, CurrentNodeIsOnline) {
+    EXPECT_LT(cpu::numaNodeIndex(cpu::currentNumaNode()), cpu::numaNodeCount());
+}
+
+/**
+ * @brief Test that node IDs and dense indices map onto each other.
+ */
+TEST(CpuNuma, NodeIdAndIndexRoundTrip) {
+    for (std::size_t index = 0; index < cpu::numaNodeCount(); ++index) {
+        EXPECT_EQ(cpu::numaNodeIndex(cpu::numaNodeId(index)), index);
+    }
+    EXPECT_EQ(cpu::numaNodeId(cpu::numaNodeCount()), cpu::numaNodeId(0));
+    EXPECT_EQ(cpu::numaNodeIndex(1023), cpu::numaNodeCount());
+}
+
+/**
+ * @brief Test that sparse kernel node lists keep their real IDs.
+ */
+TEST(CpuNuma, ParsesSparseNodeList) {
+    EXPECT_EQ(cpu::parseNumaNodeList("0\n"), (std::vector<std::size_t>{0}));
+    EXPECT_EQ(cpu::parseNumaNodeList("0,2"), (std::vector<std::size_t>{0, 2}));
+    EXPECT_EQ(cpu::parseNumaNodeList("0-1,4,6-7\n"), (std::vector<std::size_t>{0, 1, 4, 6, 7}));
+}
+
+/**
+ * @brief Test that malformed node lists are rejected.
+ */
+TEST(CpuNuma, RejectsMalformedNodeList) {
+    EXPECT_TRUE(cpu::parseNumaNodeList("").empty());
+    EXPECT_TRUE(cpu::parseNumaNodeList("a").empty());
+    EXPECT_TRUE(cpu::parseNumaNodeList("3-1").empty());
+    EXPECT_TRUE(cpu::parseNumaNodeList("0,").empty());
+    EXPECT_TRUE(cpu::parseNumaNodeList("0-99999").empty());
+}
+
+/**
+ * @brief Test that invalid ranges are rejected without touching the kernel.
+ */
+TEST(CpuNuma, BindRejectsEmptyRange) {
+    EXPECT_FALSE(cpu::bindToNumaNode(nullptr, 4096, 0));
+    int dummy = 0;
+    EXPECT_FALSE(cpu::bindToNumaNode(&dummy, 0, 0));
+}
+
+/**
+ * @brief Test that binding succeeds on multi-node hosts and is a no-op otherwise.
+ */
+TEST(CpuNuma, BindFollowsNodeCount) {
+    constexpr std::size_t kSize = 1 << 20;
+    void* base = mmap(nullptr, kSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+    ASSERT_NE(base, MAP_FAILED);
+    const bool bound = cpu::bindToNumaNode(base, kSize, 0);
+    if (cpu::numaNodeCount() == 1) {
+        EXPECT_FALSE(bound);
+    } else {
+        EXPECT_TRUE(bound);
+    }
+    static_cast<char*>(base)[0] = 1;
+    munmap(base, kSize);
+}
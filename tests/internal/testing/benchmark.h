@@ -0,0 +1,73 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace orteaf::tests {
+
+/**
+ * @brief Benchmarks are opt-in so the regular test run stays fast.
+ *
+ * Set ORTEAF_RUN_BENCHMARKS=1 to run them, e.g.
+ *   ORTEAF_RUN_BENCHMARKS=1 ./orteaf_tests --gtest_filter='*Benchmark*'
+ */
+inline bool benchmarksEnabled() {
+    const char* env = std::getenv("ORTEAF_RUN_BENCHMARKS");
+    return env != nullptr && *env != '\0' && std::string_view(env) != "0";
+}
+
+#define ORTEAF_SKIP_UNLESS_BENCHMARKS_ENABLED()                                   \
+    do {                                                                          \
+        if (!::orteaf::tests::benchmarksEnabled()) {                              \
+            GTEST_SKIP() << "Set ORTEAF_RUN_BENCHMARKS=1 to run this benchmark."; \
+        }                                                                         \
+    } while (false)
+
+/**
+ * @brief Keeps the compiler from optimizing away the computation of @p value.
+ */
+template <typename T>
+inline void doNotOptimize(T& value) {
+    asm volatile("" : "+m"(value) : : "memory");
+}
+
+/**
+ * @brief Runs fn(thread_index) on thread_count threads released at the same time.
+ *
+ * @return Wall-clock seconds from release until every thread has finished.
+ */
+template <typename Fn>
+double runConcurrently(std::size_t thread_count, Fn&& fn) {
+    std::atomic<std::size_t> ready{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    threads.reserve(thread_count);
+    for (std::size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t] {
+            ready.fetch_add(1, std::memory_order_acq_rel);
+            while (!go.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            fn(t);
+        });
+    }
+    while (ready.load(std::memory_order_acquire) != thread_count) {
+        std::this_thread::yield();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+}  // namespace orteaf::tests
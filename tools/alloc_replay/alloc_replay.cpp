@@ -0,0 +1,214 @@
+// Replays an allocation trace recorded with AllocationTraceRecorder against a
+// set of SegregatePool / HierarchicalSlotAllocator configurations and prints
+// throughput, peak resident memory and fragmentation for each of them.
+
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "orteaf/internal/execution/allocator/lowlevel/hierarchical_slot_allocator.h"
+#include "orteaf/internal/execution/allocator/policies/chunk_locator/direct_chunk_locator.h"
+#include "orteaf/internal/execution/allocator/policies/fast_free/fast_free_policies.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_bump_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/freelist/host_stack_freelist_policy.h"
+#include "orteaf/internal/execution/allocator/policies/large_alloc/direct_resource_large_alloc.h"
+#include "orteaf/internal/execution/allocator/policies/reuse/deferred_reuse_policy.h"
+#include "orteaf/internal/execution/allocator/policies/threading/threading_policies.h"
+#include "orteaf/internal/execution/allocator/pool/segregate_pool.h"
+#include "orteaf/internal/execution/allocator/resource/cpu/cpu_resource.h"
+#include "orteaf/internal/execution/allocator/trace/allocation_trace.h"
+#include "orteaf/internal/execution/allocator/trace/allocation_trace_replay.h"
+#include "orteaf/internal/execution/cpu/resource/cpu_heap_ops.h"
+
+namespace {
+
+namespace policies = ::orteaf::internal::execution::allocator::policies;
+namespace pool_ns = ::orteaf::internal::execution::allocator::pool;
+namespace trace = ::orteaf::internal::execution::allocator::trace;
+using ::orteaf::internal::execution::cpu::CpuResource;
+using ::orteaf::internal::execution::cpu::resource::CpuHeapOps;
+using Execution = ::orteaf::internal::execution::Execution;
+
+template <typename FastFree, typename Threading, template <typename> class FreeList>
+using CpuPool = pool_ns::SegregatePool<CpuResource, FastFree, Threading,
+                                       policies::DirectResourceLargeAllocPolicy<CpuResource>,
+                                       policies::DirectChunkLocatorPolicy<CpuResource>,
+                                       policies::DeferredReusePolicy<CpuResource>, FreeList<CpuResource>>;
+
+using StackPool = CpuPool<policies::FastFreePolicy, policies::NoLockThreadingPolicy,
+                          policies::HostStackFreelistPolicy>;
+using BumpPool = CpuPool<policies::FastFreePolicy, policies::NoLockThreadingPolicy,
+                         policies::HostBumpFreelistPolicy>;
+using GeometricPool = CpuPool<policies::GeometricFastFreePolicy, policies::NoLockThreadingPolicy,
+                              policies::HostStackFreelistPolicy>;
+using ShardedPool = CpuPool<policies::FastFreePolicy, policies::SizeClassShardedThreadingPolicy,
+                            policies::HostStackFreelistPolicy>;
+using SlotAllocator = policies::HierarchicalSlotAllocator<CpuHeapOps, Execution::Cpu>;
+
+struct Options {
+    std::string trace_path;
+    std::vector<std::string> targets{"segregate", "segregate-bump", "segregate-geometric",
+                                     "segregate-sharded", "hierarchical"};
+    std::size_t chunk_size{16 * 1024 * 1024};
+    std::size_t min_block_size{64};
+    std::size_t max_block_size{16 * 1024 * 1024};
+    std::vector<std::size_t> levels{64 * 1024 * 1024, 2 * 1024 * 1024, 64 * 1024, 4096};
+    std::size_t sample_interval{256};
+    bool json{false};
+};
+
+void printUsage() {
+    std::cerr << "Usage: alloc_replay <trace> [options]\n"
+                 "  --targets=a,b,...   segregate, segregate-bump, segregate-geometric,\n"
+                 "                      segregate-sharded, hierarchical (default: all)\n"
+                 "  --chunk-size=N      SegregatePool chunk size in bytes\n"
+                 "  --min-block=N       SegregatePool min block size in bytes\n"
+                 "  --max-block=N       SegregatePool max block size in bytes\n"
+                 "  --levels=a,b,...    HierarchicalSlotAllocator levels (largest first)\n"
+                 "  --sample-interval=N resident memory sampling interval in ops\n"
+                 "  --json              print one JSON object per target\n";
+}
+
+std::vector<std::string> splitList(const std::string& value) {
+    std::vector<std::string> out;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            out.push_back(item);
+        }
+    }
+    return out;
+}
+
+std::size_t parseSize(const std::string& value) { return static_cast<std::size_t>(std::stoull(value)); }
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const auto eq = arg.find('=');
+        const std::string key = arg.substr(0, eq);
+        const std::string value = eq == std::string::npos ? std::string{} : arg.substr(eq + 1);
+        if (key == "--targets") {
+            options.targets = splitList(value);
+        } else if (key == "--chunk-size") {
+            options.chunk_size = parseSize(value);
+        } else if (key == "--min-block") {
+            options.min_block_size = parseSize(value);
+        } else if (key == "--max-block") {
+            options.max_block_size = parseSize(value);
+        } else if (key == "--levels") {
+            options.levels.clear();
+            for (const auto& level : splitList(value)) {
+                options.levels.push_back(parseSize(level));
+            }
+        } else if (key == "--sample-interval") {
+            options.sample_interval = parseSize(value);
+        } else if (key == "--json") {
+            options.json = true;
+        } else if (!arg.starts_with("--") && options.trace_path.empty()) {
+            options.trace_path = arg;
+        } else {
+            std::cerr << "Unknown option: " << arg << "\n";
+            return false;
+        }
+    }
+    return !options.trace_path.empty();
+}
+
+template <typename Pool>
+trace::AllocationReplayReport replayPool(const trace::AllocationTrace& recorded, const Options& options) {
+    Pool pool;
+    typename Pool::Config cfg{};
+    cfg.chunk_size = options.chunk_size;
+    cfg.min_block_size = options.min_block_size;
+    cfg.max_block_size = options.max_block_size;
+    cfg.fast_free.resource = pool.resource();
+    cfg.threading.resource = pool.resource();
+    cfg.large_alloc.resource = pool.resource();
+    cfg.chunk_locator.resource = pool.resource();
+    cfg.reuse.resource = pool.resource();
+    cfg.freelist.resource = pool.resource();
+    pool.initialize(cfg);
+
+    trace::SegregatePoolReplayTarget<Pool> target(pool);
+    auto report = trace::replayAllocationTrace(recorded, target, {options.sample_interval});
+    typename Pool::LaunchParams params{};
+    pool.releaseChunk(params);
+    return report;
+}
+
+trace::AllocationReplayReport replayHierarchical(const trace::AllocationTrace& recorded,
+                                                 const Options& options) {
+    CpuHeapOps heap_ops;
+    SlotAllocator allocator;
+    SlotAllocator::Config cfg{};
+    cfg.levels = options.levels;
+    cfg.initial_bytes = options.levels.front();
+    cfg.expand_bytes = options.levels.front();
+    allocator.initialize(cfg, &heap_ops);
+
+    trace::HierarchicalSlotReplayTarget<SlotAllocator> target(allocator);
+    return trace::replayAllocationTrace(recorded, target, {options.sample_interval});
+}
+
+bool runTarget(const std::string& name, const trace::AllocationTrace& recorded, const Options& options,
+               trace::AllocationReplayReport& report) {
+    if (name == "segregate") {
+        report = replayPool<StackPool>(recorded, options);
+    } else if (name == "segregate-bump") {
+        report = replayPool<BumpPool>(recorded, options);
+    } else if (name == "segregate-geometric") {
+        report = replayPool<GeometricPool>(recorded, options);
+    } else if (name == "segregate-sharded") {
+        report = replayPool<ShardedPool>(recorded, options);
+    } else if (name == "hierarchical") {
+        report = replayHierarchical(recorded, options);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) try {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    CpuResource::initialize();
+    const trace::AllocationTrace recorded = trace::readAllocationTrace(options.trace_path);
+    if (!options.json) {
+        std::cout << "trace: " << recorded.events.size() << " events, " << recorded.id_count
+                  << " allocations, " << recorded.thread_count << " threads\n";
+    }
+
+    for (const auto& name : options.targets) {
+        trace::AllocationReplayReport report{};
+        if (!runTarget(name, recorded, options, report)) {
+            std::cerr << "Unknown target: " << name << "\n";
+            return 1;
+        }
+        if (options.json) {
+            std::cout << "{\"target\":\"" << name << "\",\"report\":" << report.toJson() << "}\n";
+            continue;
+        }
+        std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(2)
+                  << " ops/s=" << std::setw(12) << report.opsPerSecond()
+                  << " peak_live=" << report.peak_live_bytes
+                  << " peak_resident=" << report.peak_resident_bytes
+                  << " fragmentation=" << std::setprecision(4) << report.fragmentation()
+                  << " failed=" << report.failed_allocations << "\n";
+    }
+    return 0;
+} catch (const std::exception& e) {
+    std::cerr << "alloc_replay error: " << e.what() << "\n";
+    return 1;
+}